@@ -6,17 +6,27 @@
 #ifndef GDCORE_EffectsCodeGenerator_H
 #define GDCORE_EffectsCodeGenerator_H
 
+#include <functional>
 #include <set>
 #include <utility>
 #include <vector>
 #include "GDCore/String.h"
 namespace gd {
+class Effect;
 class Project;
 class Platform;
 }  // namespace gd
 
 namespace gd {
 
+/**
+ * \brief Call the worker on all the effects of the project (effects of the
+ * layers and of the objects).
+ */
+void GD_CORE_API ExposeProjectEffects(
+    const gd::Project& project,
+    const std::function<void(const gd::Effect& effect)>& worker);
+
 /**
  * \brief Internal class used to generate code from events
  */
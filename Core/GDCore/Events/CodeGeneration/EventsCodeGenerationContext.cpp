@@ -54,6 +54,7 @@ void EventsCodeGenerationContext::ObjectsListNeeded(
   if (!IsToBeDeclared(objectName))
     objectsListsToBeDeclared.insert(objectName);
 
+  objectsListsNotOnlyRead.insert(objectName);
   depthOfLastUse[objectName] = GetContextDepth();
 }
 
@@ -62,6 +63,7 @@ void EventsCodeGenerationContext::ObjectsListWithoutPickingNeeded(
   if (!IsToBeDeclared(objectName))
     objectsListsWithoutPickingToBeDeclared.insert(objectName);
 
+  objectsListsNotOnlyRead.insert(objectName);
   depthOfLastUse[objectName] = GetContextDepth();
 }
 
@@ -70,9 +72,38 @@ void EventsCodeGenerationContext::EmptyObjectsListNeeded(
   if (!IsToBeDeclared(objectName))
     emptyObjectsListsToBeDeclared.insert(objectName);
 
+  objectsListsNotOnlyRead.insert(objectName);
   depthOfLastUse[objectName] = GetContextDepth();
 }
 
+void EventsCodeGenerationContext::ObjectsListNeededForReading(
+    const gd::String& objectName) {
+  if (!IsToBeDeclared(objectName))
+    objectsListsToBeDeclared.insert(objectName);
+
+  depthOfLastUse[objectName] = GetContextDepth();
+}
+
+std::set<gd::String>
+EventsCodeGenerationContext::GetObjectsListsToBeDeclaredOnlyRead() const {
+  std::set<gd::String> objectsListsOnlyRead;
+  for (auto& objectName : objectsListsToBeDeclared) {
+    if (objectsListsNotOnlyRead.find(objectName) ==
+        objectsListsNotOnlyRead.end())
+      objectsListsOnlyRead.insert(objectName);
+  }
+
+  return objectsListsOnlyRead;
+}
+
+void EventsCodeGenerationContext::SetObjectsListDeclaredElsewhere(
+    const gd::String& objectName) {
+  objectsListsToBeDeclared.erase(objectName);
+  objectsListsWithoutPickingToBeDeclared.erase(objectName);
+  emptyObjectsListsToBeDeclared.erase(objectName);
+  alreadyDeclaredObjectsLists.insert(objectName);
+}
+
 std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
     const {
   std::set<gd::String> allObjectListsToBeDeclared(
@@ -198,6 +198,29 @@ class GD_CORE_API EventsCodeGenerationContext {
   unsigned int GetLastDepthObjectListWasNeeded(
       const gd::String& objectName) const;
 
+  /**
+   * \brief Call this when an instruction in the event needs an objects list
+   * only to read its instances (for example, in an expression), without
+   * picking, creating or modifying any of them.
+   *
+   * The list is declared as with ObjectsListNeeded.
+   */
+  void ObjectsListNeededForReading(const gd::String& objectName);
+
+  /**
+   * \brief Return the objects lists which will be declared by the current
+   * context and which are only read by the instructions of the context (see
+   * ObjectsListNeededForReading).
+   */
+  std::set<gd::String> GetObjectsListsToBeDeclaredOnlyRead() const;
+
+  /**
+   * \brief Don't declare \a objectName in this context anymore, as its
+   * declaration is made elsewhere by the event (for example, once before a
+   * loop).
+   */
+  void SetObjectsListDeclaredElsewhere(const gd::String& objectName);
+
   /**
    * \brief Check if twos context have the same list for an object.
    *
@@ -260,6 +283,10 @@ class GD_CORE_API EventsCodeGenerationContext {
                                       ///< but not filled with scene's
                                       ///< objects and not filled with any
                                       ///< previously existing objects list.
+  std::set<gd::String>
+      objectsListsNotOnlyRead;  ///< Objects lists that were needed in this
+                                ///< context by an instruction that can pick
+                                ///< or modify them.
   std::map<gd::String, unsigned int>
       depthOfLastUse;  ///< The context depth when an object was last used.
   gd::String
@@ -6,10 +6,13 @@
 #ifndef GDCORE_EVENTSCODEGENERATOR_H
 #define GDCORE_EVENTSCODEGENERATOR_H
 
+#include <map>
+#include <memory>
 #include <set>
 #include <utility>
 #include <vector>
 
+#include "GDCore/Events/CodeGeneration/EventsFunctionInliner.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/String.h"
@@ -25,6 +28,8 @@ class ObjectMetadata;
 class BehaviorMetadata;
 class InstructionMetadata;
 class EventsCodeGenerationContext;
+class EventsCodeReport;
+class DeadEventsProjectFacts;
 class ExpressionCodeGenerationInformation;
 class InstructionMetadata;
 class Platform;
@@ -65,6 +70,10 @@ class GD_CORE_API EventsCodeGenerator {
    * \brief Preprocess an events list (replacing for example links with the
    * linked events).
    *
+   * When generating code for runtime (i.e: not for a preview) of a layout,
+   * events that can never run are also removed (see
+   * gd::DeadEventsEliminator).
+   *
    * This should be called before any code generation.
    */
   void PreprocessEventList(gd::EventsList& listEvent);
@@ -265,6 +274,39 @@ class GD_CORE_API EventsCodeGenerator {
     compilationForRuntime = compilationForRuntime_;
   }
 
+  /**
+   * \brief Set the report to be filled with statistics about the code
+   * generated for each event (nullptr by default, meaning no report).
+   */
+  void SetCodeReport(gd::EventsCodeReport* codeReport_) {
+    codeReport = codeReport_;
+  }
+
+  /**
+   * \brief Get the report filled with statistics about the generated code, if
+   * any.
+   */
+  gd::EventsCodeReport* GetCodeReport() const { return codeReport; }
+
+  /**
+   * \brief Set the facts about the whole project used to remove the events
+   * that can never run, so that they are collected once for all the layouts
+   * of an export (nullptr by default, meaning that they are collected each
+   * time a layout is preprocessed).
+   */
+  void SetDeadEventsProjectFacts(
+      const gd::DeadEventsProjectFacts* deadEventsProjectFacts_) {
+    deadEventsProjectFacts = deadEventsProjectFacts_;
+  }
+
+  /**
+   * \brief Count a loop over the instances of an objects list generated by
+   * an event, for the statistics of gd::EventsCodeReport.
+   *
+   * \note Object and behavior instructions are already counted.
+   */
+  void CountInstancesLoop() { instancesLoopsCount++; }
+
   /**
    * \brief Report that an error occurred during code generation ( Event code
    * won't be generated )
@@ -317,6 +359,38 @@ class GD_CORE_API EventsCodeGenerator {
    */
   const gd::Platform& GetPlatform() const { return platform; }
 
+  /**
+   * \brief Allow the expressions made with the events functions of the
+   * project to be inlined in the generated code, when they are simple enough.
+   *
+   * \see gd::EventsFunctionInliner
+   */
+  void SetProjectForEventsFunctionsInlining(const gd::Project& project_) {
+    eventsFunctionsInliningProject = &project_;
+    inlinableExpressions.clear();
+  }
+
+  /**
+   * \brief Get the project whose events functions can be inlined, if any.
+   */
+  const gd::Project* GetProjectForEventsFunctionsInlining() const {
+    return eventsFunctionsInliningProject;
+  }
+
+  /**
+   * \brief Get the expression of the events function with the given name, if
+   * it can be inlined.
+   *
+   * The expression of a function is parsed and checked only once during the
+   * code generation, whatever the number of calls to the function.
+   *
+   * \return The expression, or nullptr if the function can't be inlined or if
+   * inlining is not enabled.
+   * \see gd::EventsFunctionInliner
+   */
+  const gd::EventsFunctionInliner::InlinableExpression* GetInlinableExpression(
+      const gd::String& functionName);
+
   /**
    * \brief Convert a group name to the full list of objects contained in the
    * group.
@@ -436,6 +510,11 @@ class GD_CORE_API EventsCodeGenerator {
   size_t GenerateSingleUsageUniqueIdForEventsList();
 
  protected:
+  /**
+   * \brief Call the preprocessing method of each event, recursively.
+   */
+  void PreprocessEvents(gd::EventsList& listEvent);
+
   /**
    * \brief Generate the code for a single parameter.
    *
@@ -546,6 +625,24 @@ class GD_CORE_API EventsCodeGenerator {
    */
   virtual gd::String GenerateBadObject() { return "fakeNullObject"; }
 
+  /**
+   * \brief Generate the code converting a number inlined from an events
+   * function (its returned value or one of its arguments), as it would be
+   * converted when calling the function.
+   */
+  virtual gd::String GenerateInlinedNumberCoercion(const gd::String& code) {
+    return "(" + code + ")";
+  }
+
+  /**
+   * \brief Generate the code converting a string inlined from an events
+   * function (its returned value or one of its arguments), as it would be
+   * converted when calling the function.
+   */
+  virtual gd::String GenerateInlinedStringCoercion(const gd::String& code) {
+    return "(" + code + ")";
+  }
+
   /**
    * \brief Call a function of the current object.
    * \note The current object is the object being manipulated by a condition or
@@ -737,6 +834,14 @@ class GD_CORE_API EventsCodeGenerator {
                              ///< references. If false, they should not be used.
   gd::Project* project;      ///< The project being used.
   const gd::Layout* scene;   ///< The scene being generated.
+  const gd::Project*
+      eventsFunctionsInliningProject;  ///< The project whose events functions
+                                       ///< can be inlined, if any.
+  std::map<gd::String,
+           std::unique_ptr<gd::EventsFunctionInliner::InlinableExpression>>
+      inlinableExpressions;  ///< The expressions of the events functions
+                             ///< already checked for inlining, by function
+                             ///< name (nullptr if not inlinable).
 
   bool errorOccurred;          ///< Must be set to true if an error occured.
   bool compilationForRuntime;  ///< Is set to true if the code generation is
@@ -759,6 +864,15 @@ class GD_CORE_API EventsCodeGenerator {
       instructionUniqueIds;  ///< The unique ids generated for instructions.
   size_t eventsListNextUniqueId;  ///< The next identifier to use for an events
                                   ///< list function name.
+
+  gd::EventsCodeReport* codeReport;  ///< The report to fill, if any.
+  const gd::DeadEventsProjectFacts*
+      deadEventsProjectFacts;  ///< The facts shared by the layouts of an
+                               ///< export, if any.
+  size_t instancesLoopsCount;  ///< The number of loops over instances lists
+                               ///< generated so far.
+  size_t objectsListsCopiesCount;  ///< The number of objects lists copies
+                                   ///< generated so far.
 };
 
 }  // namespace gd
@@ -0,0 +1,127 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/EventsCodeReport.h"
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/IDE/Events/EventsPositionFinder.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+void AddAllEvents(gd::EventsList& events,
+                  std::vector<gd::BaseEvent*>& allEvents) {
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    allEvents.push_back(&events[i]);
+    if (events[i].CanHaveSubEvents())
+      AddAllEvents(events[i].GetSubEvents(), allEvents);
+  }
+}
+}  // namespace
+
+void EventsCodeReport::RegisterEventsPositions(gd::EventsList& events) {
+  std::vector<gd::BaseEvent*> allEvents;
+  AddAllEvents(events, allEvents);
+
+  gd::EventsPositionFinder positionFinder;
+  for (auto event : allEvents) positionFinder.AddEventToSearch(event);
+  positionFinder.Launch(events);
+
+  const auto& foundPositions = positionFinder.GetPositions();
+  for (std::size_t i = 0; i < allEvents.size(); ++i)
+    positions[allEvents[i]] = foundPositions[i];
+}
+
+void EventsCodeReport::BeginEvent(const gd::BaseEvent& event,
+                                  std::size_t codeOutsideMainSize,
+                                  std::size_t instancesLoopsCount,
+                                  std::size_t objectsListsCopiesCount) {
+  auto it = positions.find(&event);
+
+  EventReport eventReport;
+  eventReport.position = it != positions.end() ? it->second : gd::String::npos;
+  eventReport.depth = pendingEvents.size();
+  eventReport.codeSize = 0;
+  eventReport.objectsListsCopiesCount = 0;
+  eventReport.instancesLoopsCount = 0;
+  eventsReports.push_back(eventReport);
+
+  PendingEvent pendingEvent;
+  pendingEvent.reportIndex = eventsReports.size() - 1;
+  pendingEvent.codeOutsideMainSize = codeOutsideMainSize;
+  pendingEvent.instancesLoopsCount = instancesLoopsCount;
+  pendingEvent.objectsListsCopiesCount = objectsListsCopiesCount;
+  pendingEvent.subEventsCodeSize = 0;
+  pendingEvent.subEventsInstancesLoopsCount = 0;
+  pendingEvent.subEventsObjectsListsCopiesCount = 0;
+  pendingEvents.push_back(pendingEvent);
+}
+
+void EventsCodeReport::EndEvent(std::size_t eventCodeSize,
+                                std::size_t codeOutsideMainSize,
+                                std::size_t instancesLoopsCount,
+                                std::size_t objectsListsCopiesCount) {
+  if (pendingEvents.empty()) return;
+  PendingEvent pendingEvent = pendingEvents.back();
+  pendingEvents.pop_back();
+
+  // The totals include the code of the sub events (generated either inside
+  // the event code or outside the main events list, as a function).
+  std::size_t totalCodeSize =
+      eventCodeSize + codeOutsideMainSize - pendingEvent.codeOutsideMainSize;
+  std::size_t totalInstancesLoopsCount =
+      instancesLoopsCount - pendingEvent.instancesLoopsCount;
+  std::size_t totalObjectsListsCopiesCount =
+      objectsListsCopiesCount - pendingEvent.objectsListsCopiesCount;
+
+  EventReport& eventReport = eventsReports[pendingEvent.reportIndex];
+  eventReport.codeSize = totalCodeSize >= pendingEvent.subEventsCodeSize
+                             ? totalCodeSize - pendingEvent.subEventsCodeSize
+                             : 0;
+  eventReport.instancesLoopsCount =
+      totalInstancesLoopsCount - pendingEvent.subEventsInstancesLoopsCount;
+  eventReport.objectsListsCopiesCount =
+      totalObjectsListsCopiesCount -
+      pendingEvent.subEventsObjectsListsCopiesCount;
+
+  if (!pendingEvents.empty()) {
+    PendingEvent& parentEvent = pendingEvents.back();
+    parentEvent.subEventsCodeSize += totalCodeSize;
+    parentEvent.subEventsInstancesLoopsCount += totalInstancesLoopsCount;
+    parentEvent.subEventsObjectsListsCopiesCount +=
+        totalObjectsListsCopiesCount;
+  }
+}
+
+std::size_t EventsCodeReport::GetTotalCodeSize() const {
+  std::size_t totalCodeSize = 0;
+  for (auto& eventReport : eventsReports) totalCodeSize += eventReport.codeSize;
+
+  return totalCodeSize;
+}
+
+void EventsCodeReport::SerializeTo(SerializerElement& element) const {
+  element.SetAttribute("totalCodeSize", (int)GetTotalCodeSize());
+
+  SerializerElement& eventsElement = element.AddChild("events");
+  eventsElement.ConsiderAsArrayOf("event");
+  for (auto& eventReport : eventsReports) {
+    SerializerElement& eventElement = eventsElement.AddChild("event");
+    eventElement.SetAttribute("position",
+                              eventReport.position != gd::String::npos
+                                  ? (int)eventReport.position
+                                  : -1);
+    eventElement.SetAttribute("depth", (int)eventReport.depth);
+    eventElement.SetAttribute("codeSize", (int)eventReport.codeSize);
+    eventElement.SetAttribute("objectsListsCopiesCount",
+                              (int)eventReport.objectsListsCopiesCount);
+    eventElement.SetAttribute("instancesLoopsCount",
+                              (int)eventReport.instancesLoopsCount);
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,138 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EVENTSCODEREPORT_H
+#define GDCORE_EVENTSCODEREPORT_H
+
+#include <map>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class EventsList;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Statistics about the code generated for each event of an events list
+ * (a scene, external events or an events function).
+ *
+ * Pass it to gd::EventsCodeGenerator::SetCodeReport before generating the code.
+ * Events are reported with their position in the flattened events list (see
+ * gd::EventsPositionFinder), so that the expensive ones can be found in the
+ * editor.
+ *
+ * All the statistics of an event are excluding the ones of its sub events.
+ *
+ * \ingroup Events
+ */
+class GD_CORE_API EventsCodeReport {
+ public:
+  /**
+   * \brief The statistics of the code generated for an event.
+   */
+  struct EventReport {
+    std::size_t position;  ///< The position of the event in the flattened
+                           ///< events list, or gd::String::npos if the event
+                           ///< was not part of the list (for example, events
+                           ///< inserted by a link to external events).
+    std::size_t depth;     ///< The nesting depth of the event (0 for events
+                           ///< at the root of the list).
+    std::size_t codeSize;  ///< The size, in bytes, of the generated code.
+    std::size_t objectsListsCopiesCount;  ///< The number of objects lists
+                                          ///< copied when the event is run.
+    std::size_t instancesLoopsCount;  ///< The number of loops over objects
+                                      ///< instances lists.
+  };
+
+  EventsCodeReport(){};
+  virtual ~EventsCodeReport(){};
+
+  /**
+   * \brief Store the positions of all the events of the list, as it is before
+   * any preprocessing.
+   *
+   * \note Code generators are calling this on their copy of the events list,
+   * which has the same structure as the original events list.
+   */
+  void RegisterEventsPositions(gd::EventsList& events);
+
+  /**
+   * \brief Called by the code generator before generating the code of an
+   * event.
+   *
+   * \param codeOutsideMainSize The size of the code generated outside of the
+   * events list so far.
+   * \param instancesLoopsCount The number of instances loops generated so far.
+   * \param objectsListsCopiesCount The number of objects lists copies
+   * generated so far.
+   */
+  void BeginEvent(const gd::BaseEvent& event,
+                  std::size_t codeOutsideMainSize,
+                  std::size_t instancesLoopsCount,
+                  std::size_t objectsListsCopiesCount);
+
+  /**
+   * \brief Called by the code generator after generating the code of the event
+   * passed to the last call to BeginEvent.
+   *
+   * \param eventCodeSize The size of the code generated for the event in the
+   * events list.
+   * \param codeOutsideMainSize The size of the code generated outside of the
+   * events list so far.
+   * \param instancesLoopsCount The number of instances loops generated so far.
+   * \param objectsListsCopiesCount The number of objects lists copies
+   * generated so far.
+   */
+  void EndEvent(std::size_t eventCodeSize,
+                std::size_t codeOutsideMainSize,
+                std::size_t instancesLoopsCount,
+                std::size_t objectsListsCopiesCount);
+
+  /**
+   * \brief Return the reports of the events, in the order their code was
+   * generated.
+   */
+  const std::vector<EventReport>& GetEventsReports() const {
+    return eventsReports;
+  }
+
+  /**
+   * \brief Return the size, in bytes, of the code generated for all the
+   * events.
+   */
+  std::size_t GetTotalCodeSize() const;
+
+  /**
+   * \brief Serialize the reports of the events.
+   */
+  void SerializeTo(SerializerElement& element) const;
+
+ private:
+  /**
+   * \brief An event being generated, with the counters at the time its
+   * generation started and the totals of its sub events.
+   */
+  struct PendingEvent {
+    std::size_t reportIndex;
+    std::size_t codeOutsideMainSize;
+    std::size_t instancesLoopsCount;
+    std::size_t objectsListsCopiesCount;
+    std::size_t subEventsCodeSize;
+    std::size_t subEventsInstancesLoopsCount;
+    std::size_t subEventsObjectsListsCopiesCount;
+  };
+
+  std::map<const gd::BaseEvent*, std::size_t> positions;
+  std::vector<EventReport> eventsReports;
+  std::vector<PendingEvent> pendingEvents;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSCODEREPORT_H
@@ -0,0 +1,221 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#include "GDCore/Events/CodeGeneration/EventsFunctionInliner.h"
+
+#include <map>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+
+namespace gd {
+
+const std::size_t EventsFunctionInliner::maxNodesCount = 32;
+
+namespace {
+/**
+ * \brief Check that an expression only uses the parameters of a function and
+ * functions without side effects on objects or variables, and list the
+ * parameters used.
+ */
+class InlinableExpressionChecker : public ExpressionParser2NodeWorker {
+ public:
+  InlinableExpressionChecker(
+      const gd::Project& project_,
+      const std::map<gd::String, gd::String>& parametersTypes_)
+      : project(project_),
+        parametersTypes(parametersTypes_),
+        inlinable(true),
+        nodesCount(0){};
+  virtual ~InlinableExpressionChecker(){};
+
+  bool IsInlinable() const {
+    return inlinable && nodesCount <= EventsFunctionInliner::maxNodesCount;
+  }
+  std::vector<gd::String>& GetArgumentsUses() { return argumentsUses; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    nodesCount++;
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    nodesCount++;
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    nodesCount++;
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override { nodesCount++; }
+  void OnVisitTextNode(TextNode& node) override { nodesCount++; }
+  void OnVisitVariableNode(VariableNode& node) override { inlinable = false; }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    inlinable = false;
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    inlinable = false;
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    inlinable = false;
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    inlinable = false;
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override { inlinable = false; }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    nodesCount++;
+    if (!node.objectName.empty() ||
+        gd::MetadataProvider::IsBadExpressionMetadata(
+            node.expressionMetadata) ||
+        EventsFunctionInliner::IsEventsFunction(project, node.functionName)) {
+      inlinable = false;
+      return;
+    }
+
+    if (node.functionName == "GetArgumentAsNumber" ||
+        node.functionName == "GetArgumentAsString") {
+      // The parameter must be given by its name, and have the type read.
+      TextNode* parameterNameNode =
+          node.parameters.size() == 1
+              ? dynamic_cast<TextNode*>(node.parameters[0].get())
+              : nullptr;
+      auto it = parameterNameNode ? parametersTypes.find(parameterNameNode->text)
+                                  : parametersTypes.end();
+      if (it == parametersTypes.end() ||
+          it->second != (node.functionName == "GetArgumentAsNumber"
+                             ? "expression"
+                             : "string")) {
+        inlinable = false;
+        return;
+      }
+
+      argumentsUses.push_back(parameterNameNode->text);
+      return;
+    }
+
+    // Custom code generators are given the parameters as strings, so the
+    // arguments could not be put in place of the parameters.
+    if (node.expressionMetadata.codeExtraInformation.HasCustomCodeGenerator()) {
+      inlinable = false;
+      return;
+    }
+
+    for (auto& parameter : node.parameters) parameter->Visit(*this);
+  }
+
+ private:
+  const gd::Project& project;
+  const std::map<gd::String, gd::String>& parametersTypes;
+  bool inlinable;
+  std::size_t nodesCount;
+  std::vector<gd::String> argumentsUses;
+};
+}  // namespace
+
+const gd::EventsFunction* EventsFunctionInliner::GetEventsFunction(
+    const gd::Project& project, const gd::String& functionName) {
+  const gd::String& separator = gd::PlatformExtension::GetNamespaceSeparator();
+  std::size_t separatorPosition = functionName.find(separator);
+  if (separatorPosition == gd::String::npos) return nullptr;
+
+  gd::String extensionName = functionName.substr(0, separatorPosition);
+  gd::String eventsFunctionName =
+      functionName.substr(separatorPosition + separator.size());
+  if (!project.HasEventsFunctionsExtensionNamed(extensionName)) return nullptr;
+
+  const gd::EventsFunctionsExtension& extension =
+      project.GetEventsFunctionsExtension(extensionName);
+  if (!extension.HasEventsFunctionNamed(eventsFunctionName)) return nullptr;
+
+  return &extension.GetEventsFunction(eventsFunctionName);
+}
+
+bool EventsFunctionInliner::IsEventsFunction(const gd::Project& project,
+                                             const gd::String& functionName) {
+  return GetEventsFunction(project, functionName) != nullptr;
+}
+
+std::unique_ptr<EventsFunctionInliner::InlinableExpression>
+EventsFunctionInliner::GetInlinableExpression(const gd::Platform& platform,
+                                              const gd::Project& project,
+                                              const gd::String& functionName) {
+  const gd::EventsFunction* eventsFunction =
+      GetEventsFunction(project, functionName);
+  if (!eventsFunction) return nullptr;
+
+  bool isNumber =
+      eventsFunction->GetFunctionType() == gd::EventsFunction::Expression;
+  if (!isNumber && eventsFunction->GetFunctionType() !=
+                       gd::EventsFunction::StringExpression)
+    return nullptr;
+
+  // Only numbers and strings can be given as parameters.
+  std::map<gd::String, gd::String> parametersTypes;
+  for (const auto& parameter : eventsFunction->GetParameters()) {
+    if (parameter.IsCodeOnly() ||
+        (parameter.GetType() != "expression" &&
+         parameter.GetType() != "string"))
+      return nullptr;
+
+    parametersTypes[parameter.GetName()] = parameter.GetType();
+  }
+
+  // The events must be a single action returning the expression.
+  const gd::EventsList& events = eventsFunction->GetEvents();
+  if (events.GetEventsCount() != 1 || events.GetEvent(0).IsDisabled())
+    return nullptr;
+
+  const gd::StandardEvent* event =
+      dynamic_cast<const gd::StandardEvent*>(&events.GetEvent(0));
+  if (!event || !event->GetConditions().empty() ||
+      event->GetActions().size() != 1 || event->HasSubEvents())
+    return nullptr;
+
+  const gd::Instruction& action = event->GetActions()[0];
+  if (action.GetType() != (isNumber ? "SetReturnNumber" : "SetReturnString") ||
+      action.GetParametersCount() < 1)
+    return nullptr;
+
+  // Parse the expression without any object, as it must not use any.
+  gd::ObjectsContainer globalObjectsAndGroups;
+  gd::ObjectsContainer objectsAndGroups;
+  gd::ExpressionParser2 parser(
+      platform, globalObjectsAndGroups, objectsAndGroups);
+  auto node = parser.ParseExpression(isNumber ? "number" : "string",
+                                     action.GetParameter(0).GetPlainString());
+  if (!node) return nullptr;
+
+  gd::ExpressionValidator validator;
+  node->Visit(validator);
+  if (!validator.GetErrors().empty()) return nullptr;
+
+  InlinableExpressionChecker checker(project, parametersTypes);
+  node->Visit(checker);
+  if (!checker.IsInlinable()) return nullptr;
+
+  std::unique_ptr<InlinableExpression> inlinableExpression(
+      new InlinableExpression);
+  inlinableExpression->eventsFunction = eventsFunction;
+  inlinableExpression->node = std::move(node);
+  inlinableExpression->argumentsUses = std::move(checker.GetArgumentsUses());
+  return inlinableExpression;
+}
+
+}  // namespace gd
+#endif
@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#ifndef GDCORE_EVENTSFUNCTIONINLINER_H
+#define GDCORE_EVENTSFUNCTIONINLINER_H
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/String.h"
+namespace gd {
+class EventsFunction;
+class Platform;
+class Project;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the expressions made with events functions that can be inlined
+ * in the code calling them.
+ *
+ * An expression can be inlined if its events are only a single action
+ * returning an expression, and if this expression is small and only uses the
+ * parameters of the function (no objects, no variables and no other events
+ * function). The code generator then generates this expression, with the
+ * arguments used in place of the parameters, instead of the function call.
+ *
+ * \see gd::ExpressionCodeGenerator
+ * \ingroup Events
+ */
+class GD_CORE_API EventsFunctionInliner {
+ public:
+  /**
+   * \brief An expression returned by an events function, that can be inlined.
+   */
+  struct InlinableExpression {
+    const gd::EventsFunction* eventsFunction;
+    std::unique_ptr<gd::ExpressionNode> node;  ///< The parsed expression.
+    std::vector<gd::String>
+        argumentsUses;  ///< The names of the parameters, in the order they
+                        ///< are used by the expression.
+  };
+
+  /**
+   * \brief Return the expression returned by the events function with the
+   * given name (for example, "MyExtension::MyFunction"), if the function can
+   * be inlined.
+   *
+   * \return The expression, or nullptr if the function can't be inlined (or
+   * is not an events function).
+   */
+  static std::unique_ptr<InlinableExpression> GetInlinableExpression(
+      const gd::Platform& platform,
+      const gd::Project& project,
+      const gd::String& functionName);
+
+  /**
+   * \brief Return true if the function with the given name is an events
+   * function of the project.
+   */
+  static bool IsEventsFunction(const gd::Project& project,
+                               const gd::String& functionName);
+
+  static const std::size_t maxNodesCount;  ///< The maximum number of nodes
+                                           ///< of an inlinable expression.
+
+ private:
+  static const gd::EventsFunction* GetEventsFunction(
+      const gd::Project& project, const gd::String& functionName);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSFUNCTIONINLINER_H
+#endif
@@ -11,6 +11,7 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/EventsFunctionInliner.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
@@ -23,6 +24,7 @@
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/EventsFunction.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 
@@ -156,11 +158,86 @@ void ExpressionCodeGenerator::OnVisitFunctionCallNode(FunctionCallNode& node) {
           node.type, node.objectName, node.parameters, node.expressionMetadata);
     }
   } else {
+    gd::String inlinedCode;
+    if (GenerateInlinedEventsFunctionCode(node, inlinedCode)) {
+      output += inlinedCode;
+      return;
+    }
+
     output +=
         GenerateFreeFunctionCode(node.parameters, node.expressionMetadata);
   }
 }
 
+bool ExpressionCodeGenerator::GenerateInlinedEventsFunctionCode(
+    FunctionCallNode& node, gd::String& code) {
+  // When generating an inlined expression, the parameters of the function
+  // are replaced by the code of the arguments.
+  if (inlinedArgumentsCode && (node.functionName == "GetArgumentAsNumber" ||
+                               node.functionName == "GetArgumentAsString")) {
+    // They are converted like the arguments given to the function would be.
+    const TextNode& parameterNameNode =
+        static_cast<const TextNode&>(*node.parameters[0]);
+    const gd::String& argumentCode =
+        inlinedArgumentsCode->find(parameterNameNode.text)->second;
+    code = node.functionName == "GetArgumentAsNumber"
+               ? codeGenerator.GenerateInlinedNumberCoercion(argumentCode)
+               : codeGenerator.GenerateInlinedStringCoercion(argumentCode);
+    return true;
+  }
+
+  // *Optimization*: small expressions made with events are inlined, to avoid
+  // the cost of the call of the function (and of its context).
+  const gd::EventsFunctionInliner::InlinableExpression* inlinableExpression =
+      codeGenerator.GetInlinableExpression(node.functionName);
+  if (!inlinableExpression) return false;
+
+  const auto& parameters = inlinableExpression->eventsFunction->GetParameters();
+  if (node.parameters.size() != parameters.size()) return false;
+
+  // Arguments must still be evaluated once and in the same order, unless they
+  // are literals.
+  std::map<gd::String, gd::String> argumentsCode;
+  std::size_t nextArgumentIndex = 0;
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    ExpressionNode& argument = *node.parameters[i];
+    bool isLiteral = dynamic_cast<NumberNode*>(&argument) ||
+                     dynamic_cast<TextNode*>(&argument);
+    if (!isLiteral) {
+      std::size_t usesCount = 0;
+      for (std::size_t j = 0; j < inlinableExpression->argumentsUses.size();
+           ++j) {
+        if (inlinableExpression->argumentsUses[j] != parameters[i].GetName())
+          continue;
+
+        if (j < nextArgumentIndex) return false;
+        nextArgumentIndex = j + 1;
+        usesCount++;
+      }
+      if (usesCount != 1) return false;
+    }
+
+    ExpressionCodeGenerator generator(codeGenerator, context);
+    argument.Visit(generator);
+    argumentsCode[parameters[i].GetName()] = generator.GetOutput();
+  }
+
+  // The files of the function are still included, as the extension could
+  // rely on them being loaded.
+  codeGenerator.AddIncludeFiles(
+      node.expressionMetadata.codeExtraInformation.GetIncludeFiles());
+
+  ExpressionCodeGenerator generator(codeGenerator, context);
+  generator.inlinedArgumentsCode = &argumentsCode;
+  inlinableExpression->node->Visit(generator);
+  code = inlinableExpression->eventsFunction->GetFunctionType() ==
+                 gd::EventsFunction::Expression
+             ? codeGenerator.GenerateInlinedNumberCoercion(generator.GetOutput())
+             : codeGenerator.GenerateInlinedStringCoercion(
+                   generator.GetOutput());
+  return true;
+}
+
 gd::String ExpressionCodeGenerator::GenerateFreeFunctionCode(
     const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
     const ExpressionMetadata& expressionMetadata) {
@@ -212,7 +289,7 @@ gd::String ExpressionCodeGenerator::GenerateObjectFunctionCode(
   std::vector<gd::String> realObjects =
       codeGenerator.ExpandObjectsName(objectName, context);
   for (std::size_t i = 0; i < realObjects.size(); ++i) {
-    context.ObjectsListNeeded(realObjects[i]);
+    context.ObjectsListNeededForReading(realObjects[i]);
 
     gd::String objectType = gd::GetTypeOfObject(
         globalObjectsAndGroups, objectsAndGroups, realObjects[i]);
@@ -276,7 +353,7 @@ gd::String ExpressionCodeGenerator::GenerateBehaviorFunctionCode(
       codeGenerator.GetPlatform(), behaviorType);
 
   for (std::size_t i = 0; i < realObjects.size(); ++i) {
-    context.ObjectsListNeeded(realObjects[i]);
+    context.ObjectsListNeededForReading(realObjects[i]);
 
     codeGenerator.AddIncludeFiles(autoInfo.includeFiles);
     functionOutput = codeGenerator.GenerateObjectBehaviorFunctionCall(
@@ -306,6 +383,7 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
     auto& parameterMetadata = expressionMetadata.parameters[i];
     if (!parameterMetadata.IsCodeOnly()) {
       ExpressionCodeGenerator generator(codeGenerator, context);
+      generator.inlinedArgumentsCode = inlinedArgumentsCode;
       if (nonCodeOnlyParameterIndex < parameters.size()) {
         parameters[nonCodeOnlyParameterIndex]->Visit(generator);
         parametersCode += generator.GetOutput();
@@ -7,6 +7,7 @@
 #ifndef GDCORE_ExpressionCodeGenerator_H
 #define GDCORE_ExpressionCodeGenerator_H
 
+#include <map>
 #include <memory>
 #include <vector>
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
@@ -37,7 +38,9 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
  public:
   ExpressionCodeGenerator(EventsCodeGenerator& codeGenerator_,
                           EventsCodeGenerationContext& context_)
-      : codeGenerator(codeGenerator_), context(context_){};
+      : codeGenerator(codeGenerator_),
+        context(context_),
+        inlinedArgumentsCode(nullptr){};
   virtual ~ExpressionCodeGenerator(){};
 
   /**
@@ -78,6 +81,16 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
   void OnVisitEmptyNode(EmptyNode& node) override;
 
  private:
+  /**
+   * \brief Generate the code of the expression returned by an events function,
+   * with the arguments in place of the parameters, if the function can be
+   * inlined.
+   *
+   * \return true if the code was generated.
+   * \see gd::EventsFunctionInliner
+   */
+  bool GenerateInlinedEventsFunctionCode(FunctionCallNode& node,
+                                         gd::String& code);
   gd::String GenerateFreeFunctionCode(
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
       const ExpressionMetadata& expressionMetadata);
@@ -103,6 +116,9 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
   gd::String output;
   EventsCodeGenerator& codeGenerator;
   EventsCodeGenerationContext& context;
+  const std::map<gd::String, gd::String>*
+      inlinedArgumentsCode;  ///< The code of the arguments of the inlined
+                             ///< events function, if inlining one.
 };
 
 }  // namespace gd
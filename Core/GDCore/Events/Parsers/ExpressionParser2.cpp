@@ -256,4 +256,237 @@ std::unique_ptr<NumberNode> ExpressionParser2::ReadNumber() {
   return number;
 }
 
+namespace {
+/**
+ * \brief Move the locations of the nodes (and of their diagnostics) that are
+ * at or after a position.
+ */
+class ExpressionLocationsShifter : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionLocationsShifter(size_t fromPosition_, std::ptrdiff_t offset_)
+      : fromPosition(fromPosition_), offset(offset_){};
+  virtual ~ExpressionLocationsShifter(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    Shift(node);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    Shift(node);
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    Shift(node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override { Shift(node); }
+  void OnVisitTextNode(TextNode& node) override { Shift(node); }
+  void OnVisitVariableNode(VariableNode& node) override {
+    Shift(node);
+    node.nameLocation.Shift(fromPosition, offset);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    Shift(node);
+    node.nameLocation.Shift(fromPosition, offset);
+    node.dotLocation.Shift(fromPosition, offset);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    Shift(node);
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override { Shift(node); }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    Shift(node);
+    node.objectNameLocation.Shift(fromPosition, offset);
+    node.objectNameDotLocation.Shift(fromPosition, offset);
+    node.objectFunctionOrBehaviorNameLocation.Shift(fromPosition, offset);
+    node.behaviorNameNamespaceSeparatorLocation.Shift(fromPosition, offset);
+    node.behaviorFunctionNameLocation.Shift(fromPosition, offset);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    Shift(node);
+    node.functionNameLocation.Shift(fromPosition, offset);
+    node.objectNameLocation.Shift(fromPosition, offset);
+    node.objectNameDotLocation.Shift(fromPosition, offset);
+    node.behaviorNameLocation.Shift(fromPosition, offset);
+    node.behaviorNameNamespaceSeparatorLocation.Shift(fromPosition, offset);
+    node.openingParenthesisLocation.Shift(fromPosition, offset);
+    node.closingParenthesisLocation.Shift(fromPosition, offset);
+    for (auto& parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override { Shift(node); }
+
+ private:
+  void Shift(ExpressionNode& node) {
+    node.location.Shift(fromPosition, offset);
+    if (node.diagnostic) node.diagnostic->ShiftPositions(fromPosition, offset);
+  }
+
+  size_t fromPosition;
+  std::ptrdiff_t offset;
+};
+
+/**
+ * \brief Find the parameters of the functions containing a position, from
+ * the outermost to the innermost.
+ */
+class FunctionParametersAtPositionFinder : public ExpressionParser2NodeWorker {
+ public:
+  FunctionParametersAtPositionFinder(size_t searchedPosition_)
+      : searchedPosition(searchedPosition_){};
+  virtual ~FunctionParametersAtPositionFinder(){};
+
+  const std::vector<std::pair<FunctionCallNode*, size_t>>& GetParameters() {
+    return parameters;
+  }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    if (searchedPosition <
+        node.rightHandSide->location.GetStartPosition())
+      node.leftHandSide->Visit(*this);
+    else
+      node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    // The parameter containing the position is the last one starting before.
+    for (size_t i = node.parameters.size(); i > 0; --i) {
+      ExpressionNode& parameter = *node.parameters[i - 1];
+      if (parameter.location.GetStartPosition() <= searchedPosition) {
+        parameters.push_back(std::make_pair(&node, i - 1));
+        parameter.Visit(*this);
+        return;
+      }
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+ private:
+  size_t searchedPosition;
+  std::vector<std::pair<FunctionCallNode*, size_t>> parameters;
+};
+}  // namespace
+
+gd::String ExpressionParser2::GetReparsableParameterType(
+    const FunctionCallNode& function, size_t parameterIndex) {
+  // Find the metadata of the parameter like Parameters does: code only
+  // parameters are not written.
+  const std::vector<gd::ParameterMetadata>& parameters =
+      function.expressionMetadata.parameters;
+  size_t writtenParameterIndex = 0;
+  for (size_t i =
+           WrittenParametersFirstIndex(function.objectName, function.behaviorName);
+       i < parameters.size();
+       ++i) {
+    if (parameters[i].IsCodeOnly()) continue;
+
+    if (writtenParameterIndex == parameterIndex) {
+      // Other parameters can change how the next ones are parsed (objects)
+      // or depend on the previous ones (variables of objects).
+      const gd::String& type = parameters[i].GetType();
+      if (gd::ParameterMetadata::IsExpression("number", type)) return "number";
+      if (gd::ParameterMetadata::IsExpression("string", type)) return "string";
+      return "";
+    }
+    writtenParameterIndex++;
+  }
+
+  return "";
+}
+
+ExpressionNode& ExpressionParser2::ParseExpressionIncrementally(
+    const gd::String& type,
+    std::unique_ptr<ExpressionNode>& node,
+    const gd::String& previousExpression,
+    size_t editPosition,
+    size_t removedLength,
+    const gd::String& insertedText,
+    const gd::String& objectName) {
+  gd::String newExpression = previousExpression.substr(0, editPosition) +
+                             insertedText +
+                             previousExpression.substr(editPosition +
+                                                       removedLength);
+  size_t editEndPosition = editPosition + removedLength;
+  std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(insertedText.size()) -
+                          static_cast<std::ptrdiff_t>(removedLength);
+
+  if (node) {
+    FunctionParametersAtPositionFinder finder(editPosition);
+    node->Visit(finder);
+    const auto& parameters = finder.GetParameters();
+
+    // Try the innermost parameter first.
+    for (auto it = parameters.rbegin(); it != parameters.rend(); ++it) {
+      FunctionCallNode& function = *it->first;
+      size_t parameterIndex = it->second;
+      gd::String parameterType =
+          GetReparsableParameterType(function, parameterIndex);
+      if (parameterType.empty()) continue;
+
+      const ExpressionNode& parameter = *function.parameters[parameterIndex];
+      size_t parameterStartPosition = parameter.location.GetStartPosition();
+      if (editPosition < parameterStartPosition) continue;
+
+      // Find where the parsing of the previous parameter stopped (the location
+      // of the nodes can't be used, as erroneous nodes can end after it). The
+      // edit must be before.
+      expression = previousExpression;
+      currentPosition = parameterStartPosition;
+      Expression(parameterType);
+      SkipAllWhitespaces();
+      size_t previousEndPosition = GetCurrentPosition();
+      if (editEndPosition > previousEndPosition) continue;
+
+      expression = newExpression;
+      currentPosition = parameterStartPosition;
+
+      // A closing parenthesis would end the parameters instead.
+      SkipAllWhitespaces();
+      if (!IsEndReached() && CheckIfChar(IsClosingParenthesis)) continue;
+
+      auto newParameter = Expression(parameterType);
+      SkipAllWhitespaces();
+
+      // If the parameter stops at the same place as before, the rest of the
+      // expression is parsed as before.
+      if (GetCurrentPosition() != previousEndPosition + offset) continue;
+
+      ExpressionLocationsShifter shifter(previousEndPosition, offset);
+      node->Visit(shifter);
+      function.parameters[parameterIndex] = std::move(newParameter);
+      return *function.parameters[parameterIndex];
+    }
+  }
+
+  node = ParseExpression(type, newExpression, objectName);
+  return *node;
+}
+
 }  // namespace gd
@@ -67,6 +67,44 @@ class GD_CORE_API ExpressionParser2 {
     return Start(type, objectName);
   }
 
+  /**
+   * Update the tree of an expression after a part of its text was replaced,
+   * parsing again only the part of the expression that was changed.
+   *
+   * The innermost parameter (a number or a string) of a function containing
+   * the edit is parsed again, if it still ends where it was ending before the
+   * edit (otherwise, the enclosing parameters are tried). The other nodes are
+   * kept, with their locations updated. If no parameter can be parsed again,
+   * the whole expression is parsed again.
+   *
+   * \note This only avoids parsing again (and allocating) the nodes that were
+   * not edited. The text of the new expression is still built in full, the
+   * previous parameter is parsed again to find where it ended and the
+   * locations of the whole tree are visited to be shifted: each call remains
+   * linear in the length of the expression.
+   *
+   * \param type Type of the expression, as given to ParseExpression.
+   * \param node The tree of the expression before the edit, updated (or
+   * replaced) by the tree of the expression after the edit.
+   * \param previousExpression The expression before the edit.
+   * \param editPosition The position of the first replaced character.
+   * \param removedLength The number of characters removed.
+   * \param insertedText The text inserted at \a editPosition.
+   * \param objectName As given to ParseExpression.
+   *
+   * \return The node that was parsed again, which is the only one that can
+   * have new diagnostics (it's the root of the tree if the whole expression
+   * was parsed again).
+   */
+  ExpressionNode &ParseExpressionIncrementally(
+      const gd::String &type,
+      std::unique_ptr<ExpressionNode> &node,
+      const gd::String &previousExpression,
+      size_t editPosition,
+      size_t removedLength,
+      const gd::String &insertedText,
+      const gd::String &objectName = "");
+
   /**
    * Given an object name (or empty if none) and a behavior name (or empty if
    * none), return the index of the first parameter that is inside the
@@ -708,6 +746,14 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
+  /**
+   * Return the type ("number" or "string") of the parameter written at the
+   * given index of a function, or an empty string if the parameter can't be
+   * parsed again alone.
+   */
+  static gd::String GetReparsableParameterType(
+      const FunctionCallNode &function, size_t parameterIndex);
+
   /** \name Validators
    * Return a diagnostic if any error is found
    */
@@ -6,6 +6,7 @@
 #ifndef GDCORE_EXPRESSIONPARSER2NODES_H
 #define GDCORE_EXPRESSIONPARSER2NODES_H
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -33,6 +34,16 @@ struct GD_CORE_API ExpressionParserLocation {
   size_t GetEndPosition() const { return endPosition; }
   bool IsValid() const { return isValid; }
 
+  /**
+   * \brief Move the positions that are at or after \a fromPosition by \a
+   * offset characters.
+   */
+  void Shift(size_t fromPosition, std::ptrdiff_t offset) {
+    if (!isValid) return;
+    if (startPosition >= fromPosition) startPosition += offset;
+    if (endPosition >= fromPosition) endPosition += offset;
+  }
+
  private:
   bool isValid;
   size_t startPosition;
@@ -48,6 +59,7 @@ struct GD_CORE_API ExpressionParserDiagnostic {
   virtual const gd::String &GetMessage() { return noMessage; }
   virtual size_t GetStartPosition() { return 0; }
   virtual size_t GetEndPosition() { return 0; }
+  virtual void ShiftPositions(size_t fromPosition, std::ptrdiff_t offset){};
 
  private:
   static gd::String noMessage;
@@ -74,6 +86,9 @@ struct GD_CORE_API ExpressionParserError : public ExpressionParserDiagnostic {
   const gd::String &GetMessage() override { return message; }
   size_t GetStartPosition() override { return location.GetStartPosition(); }
   size_t GetEndPosition() override { return location.GetEndPosition(); }
+  void ShiftPositions(size_t fromPosition, std::ptrdiff_t offset) override {
+    location.Shift(fromPosition, offset);
+  }
 
  private:
   gd::String type;
@@ -5,6 +5,9 @@
  */
 
 #include "AbstractFileSystem.h"
+
+#include <set>
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/String.h"
 
@@ -18,4 +21,65 @@ gd::String gd::AbstractFileSystem::NormalizeSeparator(gd::String filename) {
   return filename.FindAndReplace("\\", "/");
 }
 
+bool AbstractFileSystem::ClearDirExcept(
+    const gd::String& directory, const std::vector<gd::String>& filesToKeep) {
+  return ClearDir(directory);
+}
+
+bool AbstractFileSystem::AppendToFile(const gd::String& file,
+                                      const gd::String& content) {
+  // Slow fallback, see the warning in the header: file systems are expected
+  // to override this.
+  gd::String existingContent = FileExists(file) ? ReadFile(file) : "";
+  return WriteToFile(file, existingContent + content);
+}
+
+std::vector<AbstractFileSystem::FileCopyError> AbstractFileSystem::CopyFiles(
+    const std::vector<FileCopy>& copies) {
+  std::set<gd::String> directories;
+  for (auto& copy : copies) directories.insert(DirNameFrom(copy.destination));
+  for (auto& directory : directories) {
+    if (!DirExists(directory)) MkDir(directory);
+  }
+
+  std::vector<FileCopyError> errors;
+  for (auto& copy : copies) {
+    if (!CopyFile(copy.file, copy.destination)) {
+      FileCopyError error;
+      error.file = copy.file;
+      error.destination = copy.destination;
+      error.message = "Unable to copy the file.";
+      errors.push_back(error);
+    }
+  }
+
+  return errors;
+}
+
+bool AbstractFileSystem::GetFileStats(const gd::String& file,
+                                      double& size,
+                                      double& modificationTime) {
+  return false;
+}
+
+gd::String AbstractFileSystem::GetFileHash(const gd::String& file) {
+  return "";
+}
+
+bool AbstractFileSystem::GetImageSize(const gd::String& file,
+                                      unsigned int& width,
+                                      unsigned int& height) {
+  return false;
+}
+
+bool AbstractFileSystem::WriteAtlasImage(
+    const gd::String& file,
+    unsigned int width,
+    unsigned int height,
+    const std::vector<ImagePlacement>& images) {
+  return false;
+}
+
+bool AbstractFileSystem::RemoveFile(const gd::String& file) { return false; }
+
 }  // namespace gd
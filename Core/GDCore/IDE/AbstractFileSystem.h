@@ -23,6 +23,39 @@ namespace gd {
  */
 class GD_CORE_API AbstractFileSystem {
  public:
+  /**
+   * \brief A file to be copied by CopyFiles.
+   */
+  struct FileCopy {
+    FileCopy(const gd::String& file_, const gd::String& destination_)
+        : file(file_), destination(destination_){};
+
+    gd::String file;
+    gd::String destination;
+  };
+
+  /**
+   * \brief The error returned by CopyFiles for a file that could not be
+   * copied.
+   */
+  struct FileCopyError {
+    gd::String file;
+    gd::String destination;
+    gd::String message;
+  };
+
+  /**
+   * \brief An image to be drawn by WriteAtlasImage, at the given position.
+   */
+  struct ImagePlacement {
+    ImagePlacement(const gd::String& file_, unsigned int x_, unsigned int y_)
+        : file(file_), x(x_), y(y_){};
+
+    gd::String file;
+    unsigned int x;
+    unsigned int y;
+  };
+
   virtual ~AbstractFileSystem();
 
   /**
@@ -59,6 +92,17 @@ class GD_CORE_API AbstractFileSystem {
    */
   virtual bool ClearDir(const gd::String& directory) = 0;
 
+  /**
+   * \brief Clear the directory given as parameter, removing all the files
+   * except the given ones (as absolute filenames).
+   *
+   * The default implementation removes all the files with ClearDir: file
+   * systems should override it, so that the files kept by incremental copies
+   * (see gd::ProjectResourcesCopier) are not copied again.
+   */
+  virtual bool ClearDirExcept(const gd::String& directory,
+                              const std::vector<gd::String>& filesToKeep);
+
   /**
    * \brief Get a directory suitable for temporary files.
    */
@@ -100,6 +144,20 @@ class GD_CORE_API AbstractFileSystem {
   virtual bool CopyFile(const gd::String& file,
                         const gd::String& destination) = 0;
 
+  /**
+   * \brief Copy a batch of files, creating the directories of the destinations
+   * if they don't exist.
+   *
+   * The default implementation checks each directory once, then copies the
+   * files one after the other with CopyFile. File systems able to copy files
+   * concurrently should override it, so that copying many files is not bound
+   * by the latency of each copy.
+   *
+   * \return The errors, one for each file that could not be copied.
+   */
+  virtual std::vector<FileCopyError> CopyFiles(
+      const std::vector<FileCopy>& copies);
+
   /**
    * \brief Write the content of a string to a file.
    * \return true if the operation succeeded.
@@ -107,6 +165,79 @@ class GD_CORE_API AbstractFileSystem {
   virtual bool WriteToFile(const gd::String& file,
                            const gd::String& content) = 0;
 
+  /**
+   * \brief Write the content of a string at the end of a file.
+   *
+   * \warning The default implementation reads the whole file and writes it
+   * back, so that appending repeatedly to a file costs a time quadratic in its
+   * final size. File systems used for exports must override it to really
+   * append the content (the exporters append each layout to the data file).
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool AppendToFile(const gd::String& file,
+                            const gd::String& content);
+
+  /**
+   * \brief Get the size (in bytes) and the last modification time (in
+   * milliseconds since the epoch) of a file.
+   *
+   * The default implementation returns false: file systems able to stat files
+   * should override it, so that unchanged files are not copied again by
+   * incremental copies (see gd::ProjectResourcesCopier).
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool GetFileStats(const gd::String& file,
+                            double& size,
+                            double& modificationTime);
+
+  /**
+   * \brief Return a hash of the content of a file, so that files with the same
+   * content can be detected.
+   *
+   * The default implementation returns an empty string, meaning that the hash
+   * is not available.
+   */
+  virtual gd::String GetFileHash(const gd::String& file);
+
+  /**
+   * \brief Get the size, in pixels, of an image file.
+   *
+   * The default implementation returns false: file systems able to read images
+   * should override it (along with WriteAtlasImage) to support texture atlases
+   * (see gd::TextureAtlasPacker).
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool GetImageSize(const gd::String& file,
+                            unsigned int& width,
+                            unsigned int& height);
+
+  /**
+   * \brief Write a PNG image of the given size, made of the given images
+   * (the rest of the image being transparent).
+   *
+   * The default implementation returns false (see GetImageSize).
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool WriteAtlasImage(const gd::String& file,
+                               unsigned int width,
+                               unsigned int height,
+                               const std::vector<ImagePlacement>& images);
+
+  /**
+   * \brief Remove a file.
+   *
+   * The default implementation returns false: file systems able to remove
+   * files should override it, so that images packed in texture atlases are
+   * not left in the exported game (see gd::TextureAtlasPacker).
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool RemoveFile(const gd::String& file);
+
   /**
    * \brief Read the content of a file.
    * \return The content of the file.
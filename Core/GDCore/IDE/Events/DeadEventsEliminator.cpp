@@ -0,0 +1,504 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/DeadEventsEliminator.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "GDCore/Events/Builtin/CommentEvent.h"
+#include "GDCore/Events/Builtin/ForEachChildVariableEvent.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/RepeatEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Builtin/WhileEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/SourceFile.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * Events that are known to only run their conditions and actions.
+ * Any other event (JavaScript code...) can run arbitrary code.
+ */
+bool IsAnalyzableEvent(gd::BaseEvent& event) {
+  return dynamic_cast<gd::StandardEvent*>(&event) ||
+         dynamic_cast<gd::CommentEvent*>(&event) ||
+         dynamic_cast<gd::GroupEvent*>(&event) ||
+         dynamic_cast<gd::LinkEvent*>(&event) ||
+         dynamic_cast<gd::WhileEvent*>(&event) ||
+         dynamic_cast<gd::RepeatEvent*>(&event) ||
+         dynamic_cast<gd::ForEachEvent*>(&event) ||
+         dynamic_cast<gd::ForEachChildVariableEvent*>(&event);
+}
+
+/**
+ * Events that never run their actions and sub events if one of their
+ * (top level) conditions is false.
+ */
+bool IsPrunableEvent(gd::BaseEvent& event) {
+  return dynamic_cast<gd::StandardEvent*>(&event) ||
+         dynamic_cast<gd::WhileEvent*>(&event) ||
+         dynamic_cast<gd::RepeatEvent*>(&event) ||
+         dynamic_cast<gd::ForEachEvent*>(&event) ||
+         dynamic_cast<gd::ForEachChildVariableEvent*>(&event);
+}
+
+/**
+ * Conditions that read a scene variable without modifying it.
+ */
+bool IsReadOnlySceneVariableCondition(const gd::String& type) {
+  return type == "VarScene" || type == "VarSceneTxt" ||
+         type == "SceneVariableAsBoolean" || type == "VariableChildExists";
+}
+
+gd::String GetVariableRootName(const gd::String& variableName) {
+  return variableName.substr(0, variableName.find_first_of(".["));
+}
+
+bool ParseNumberLiteral(const gd::String& expression, double& value) {
+  gd::String trimmed = expression.Trim();
+  if (trimmed.empty()) return false;
+
+  const std::string& raw = trimmed.Raw();
+  std::size_t start = raw[0] == '-' ? 1 : 0;
+  if (start == raw.size()) return false;
+  bool hasDigit = false;
+  for (std::size_t i = start; i < raw.size(); ++i) {
+    if (raw[i] >= '0' && raw[i] <= '9')
+      hasDigit = true;
+    else if (raw[i] != '.')
+      return false;
+  }
+  if (!hasDigit || std::count(raw.begin(), raw.end(), '.') > 1) return false;
+
+  value = trimmed.To<double>();
+  return true;
+}
+
+bool ParseStringLiteral(const gd::String& expression, gd::String& value) {
+  gd::String trimmed = expression.Trim();
+  const std::string& raw = trimmed.Raw();
+  if (raw.size() < 2 || raw.front() != '"' || raw.back() != '"') return false;
+
+  std::string content = raw.substr(1, raw.size() - 2);
+  if (content.find_first_of("\"\\") != std::string::npos) return false;
+
+  value = gd::String::FromUTF8(content);
+  return true;
+}
+
+/**
+ * Evaluate a comparison, returning false if the operator is unknown.
+ */
+template <typename T>
+bool EvaluateComparison(const T& lhs,
+                        const gd::String& relationalOperator,
+                        const T& rhs,
+                        bool& result) {
+  gd::String op = relationalOperator.Trim();
+  if (op == "=" || op == "==")
+    result = lhs == rhs;
+  else if (op == "!=")
+    result = lhs != rhs;
+  else if (op == "<")
+    result = lhs < rhs;
+  else if (op == ">")
+    result = lhs > rhs;
+  else if (op == "<=")
+    result = lhs <= rhs;
+  else if (op == ">=")
+    result = lhs >= rhs;
+  else
+    return false;
+
+  return true;
+}
+
+/**
+ * \brief Browse the events of the whole project to find what can be created or
+ * modified, and if some code can't be analyzed.
+ */
+class DeadEventsFactsCollector : public ArbitraryEventsWorker {
+ public:
+  DeadEventsFactsCollector(const gd::Platform& platform_)
+      : platform(platform_), hasArbitraryCode(false){};
+  virtual ~DeadEventsFactsCollector(){};
+
+  bool HasArbitraryCode() const { return hasArbitraryCode; }
+  std::set<gd::String>& GetPossiblyCreatedObjectsOrGroups() {
+    return possiblyCreatedObjectsOrGroups;
+  }
+  std::set<gd::String>& GetModifiedSceneVariables() {
+    return modifiedSceneVariables;
+  }
+
+ private:
+  bool DoVisitEvent(gd::BaseEvent& event) override {
+    if (!IsAnalyzableEvent(event)) hasArbitraryCode = true;
+
+    gd::ForEachChildVariableEvent* forEachChildVariableEvent =
+        dynamic_cast<gd::ForEachChildVariableEvent*>(&event);
+    if (forEachChildVariableEvent) {
+      modifiedSceneVariables.insert(GetVariableRootName(
+          forEachChildVariableEvent->GetValueIteratorVariableName()));
+      modifiedSceneVariables.insert(GetVariableRootName(
+          forEachChildVariableEvent->GetKeyIteratorVariableName()));
+    }
+
+    return false;
+  }
+
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override {
+    const gd::InstructionMetadata& metadata =
+        isCondition ? MetadataProvider::GetConditionMetadata(
+                          platform, instruction.GetType())
+                    : MetadataProvider::GetActionMetadata(
+                          platform, instruction.GetType());
+    if (MetadataProvider::IsBadInstructionMetadata(metadata)) return false;
+
+    bool isObjectOrBehaviorInstruction =
+        metadata.IsObjectInstruction() || metadata.IsBehaviorInstruction();
+    for (std::size_t i = 0; i < metadata.parameters.size() &&
+                            i < instruction.GetParametersCount();
+         ++i) {
+      const gd::String& type = metadata.parameters[i].type;
+      const gd::String& value = instruction.GetParameter(i).GetPlainString();
+
+      if (type == "scenevar" &&
+          !(isCondition &&
+            IsReadOnlySceneVariableCondition(instruction.GetType())))
+        modifiedSceneVariables.insert(GetVariableRootName(value));
+
+      // Any object given to an action can be created by it (think of the
+      // "Create" action, or of a function of an extension).
+      if (!isCondition && gd::ParameterMetadata::IsObject(type) &&
+          !(i == 0 && isObjectOrBehaviorInstruction))
+        possiblyCreatedObjectsOrGroups.insert(value);
+    }
+
+    return false;
+  }
+
+  const gd::Platform& platform;
+  bool hasArbitraryCode;
+  std::set<gd::String> possiblyCreatedObjectsOrGroups;
+  std::set<gd::String> modifiedSceneVariables;
+};
+
+}  // namespace
+
+DeadEventsProjectFacts::DeadEventsProjectFacts(const gd::Platform& platform,
+                                               gd::Project& project)
+    : hasArbitraryCode(false) {
+  DeadEventsFactsCollector collector(platform);
+  gd::WholeProjectRefactorer::ExposeProjectEvents(project, collector);
+
+  hasArbitraryCode = collector.HasArbitraryCode();
+  for (const auto& sourceFile : project.GetAllSourceFiles()) {
+    if (sourceFile) hasArbitraryCode = true;
+  }
+
+  possiblyCreatedObjectsOrGroups.swap(
+      collector.GetPossiblyCreatedObjectsOrGroups());
+  modifiedSceneVariables.swap(collector.GetModifiedSceneVariables());
+}
+
+DeadEventsProjectFacts::~DeadEventsProjectFacts() {}
+
+DeadEventsEliminator::DeadEventsEliminator(
+    const gd::Platform& platform_,
+    gd::Project& project_,
+    const gd::Layout& layout_,
+    const gd::DeadEventsProjectFacts& projectFacts_)
+    : platform(platform_),
+      project(project_),
+      layout(layout_),
+      projectFacts(projectFacts_),
+      hasArbitraryCode(projectFacts_.HasArbitraryCode()),
+      removedEventsCount(0),
+      removedActionsCount(0) {}
+
+DeadEventsEliminator::~DeadEventsEliminator() {}
+
+bool DeadEventsEliminator::DoVisitEvent(gd::BaseEvent& event) {
+  // Disabled events are not generated anyway.
+  if (event.IsDisabled() || !IsPrunableEvent(event)) return false;
+
+  if (!hasArbitraryCode) {
+    gd::ForEachEvent* forEachEvent = dynamic_cast<gd::ForEachEvent*>(&event);
+    if (forEachEvent && IsDeadObjectOrGroup(forEachEvent->GetObjectToPick())) {
+      removedEventsCount++;
+      return true;
+    }
+  }
+
+  // Conditions are evaluated in order: the event can only be removed if the
+  // conditions before an always false one would not have done anything.
+  for (gd::InstructionsList* conditions : event.GetAllConditionsVectors()) {
+    for (std::size_t i = 0; i < conditions->size(); ++i) {
+      if (IsAlwaysFalse((*conditions)[i])) {
+        removedEventsCount++;
+        return true;
+      }
+      if (!IsKnownPure((*conditions)[i])) return false;
+    }
+  }
+
+  return false;
+}
+
+bool DeadEventsEliminator::DoVisitInstruction(gd::Instruction& instruction,
+                                              bool isCondition) {
+  if (isCondition || hasArbitraryCode) return false;
+
+  // An action on an object without instances does nothing.
+  if (IsApplyingOnDeadObject(instruction, false)) {
+    removedActionsCount++;
+    return true;
+  }
+
+  return false;
+}
+
+bool DeadEventsEliminator::IsAlwaysFalse(const gd::Instruction& condition) {
+  const gd::String& type = condition.GetType();
+  const std::vector<gd::Expression>& parameters = condition.GetParameters();
+
+  if (type == "BuiltinCommonInstructions::Always" || type == "Toujours")
+    return condition.IsInverted();
+
+  if (type == "BuiltinCommonInstructions::And") {
+    if (condition.IsInverted()) return false;
+
+    const gd::InstructionsList& subConditions = condition.GetSubInstructions();
+    for (std::size_t i = 0; i < subConditions.size(); ++i) {
+      if (IsAlwaysFalse(subConditions[i])) return true;
+    }
+    return false;
+  }
+  if (type == "BuiltinCommonInstructions::Or") {
+    if (condition.IsInverted()) return false;
+
+    const gd::InstructionsList& subConditions = condition.GetSubInstructions();
+    if (subConditions.empty()) return false;
+    for (std::size_t i = 0; i < subConditions.size(); ++i) {
+      if (!IsAlwaysFalse(subConditions[i])) return false;
+    }
+    return true;
+  }
+
+  bool result = false;
+  if ((type == "BuiltinCommonInstructions::CompareNumbers" ||
+       type == "Egal") &&
+      parameters.size() >= 3) {
+    double lhs = 0, rhs = 0;
+    if (ParseNumberLiteral(parameters[0].GetPlainString(), lhs) &&
+        ParseNumberLiteral(parameters[2].GetPlainString(), rhs) &&
+        EvaluateComparison(lhs, parameters[1].GetPlainString(), rhs, result))
+      return result == condition.IsInverted();
+  }
+  if ((type == "BuiltinCommonInstructions::CompareStrings" ||
+       type == "StrEqual") &&
+      parameters.size() >= 3) {
+    gd::String lhs, rhs;
+    gd::String op = parameters[1].GetPlainString().Trim();
+    if ((op == "=" || op == "!=") &&
+        ParseStringLiteral(parameters[0].GetPlainString(), lhs) &&
+        ParseStringLiteral(parameters[2].GetPlainString(), rhs) &&
+        EvaluateComparison(lhs, op, rhs, result))
+      return result == condition.IsInverted();
+  }
+
+  if (hasArbitraryCode) return false;
+
+  // A scene variable never modified keeps its initial value.
+  if ((type == "VarScene" || type == "VarSceneTxt") &&
+      parameters.size() >= 3) {
+    const gd::String& variableName = parameters[0].GetPlainString();
+    if (variableName.empty() ||
+        variableName.find_first_of(".[") != gd::String::npos ||
+        projectFacts.GetModifiedSceneVariables().count(variableName))
+      return false;
+
+    bool hasVariable = layout.GetVariables().Has(variableName);
+    if (type == "VarScene") {
+      double initialValue = 0, rhs = 0;
+      if (hasVariable) {
+        const gd::Variable& variable = layout.GetVariables().Get(variableName);
+        if (variable.GetType() != gd::Variable::Number) return false;
+        initialValue = variable.GetValue();
+      }
+      if (ParseNumberLiteral(parameters[2].GetPlainString(), rhs) &&
+          EvaluateComparison(
+              initialValue, parameters[1].GetPlainString(), rhs, result))
+        return result == condition.IsInverted();
+    } else if (hasVariable) {
+      const gd::Variable& variable = layout.GetVariables().Get(variableName);
+      gd::String rhs;
+      gd::String op = parameters[1].GetPlainString().Trim();
+      if (variable.GetType() == gd::Variable::String &&
+          (op == "=" || op == "!=") &&
+          ParseStringLiteral(parameters[2].GetPlainString(), rhs) &&
+          EvaluateComparison(variable.GetString(), op, rhs, result))
+        return result == condition.IsInverted();
+    }
+    return false;
+  }
+
+  // Object conditions are false when there are no instances, even if
+  // inverted, as no instances can be picked.
+  return IsApplyingOnDeadObject(condition, true);
+}
+
+bool DeadEventsEliminator::IsKnownPure(const gd::Instruction& condition) {
+  const gd::String& type = condition.GetType();
+  const std::vector<gd::Expression>& parameters = condition.GetParameters();
+  double number = 0;
+  gd::String string;
+
+  if (type == "BuiltinCommonInstructions::Always" || type == "Toujours")
+    return true;
+
+  if (type == "BuiltinCommonInstructions::And" ||
+      type == "BuiltinCommonInstructions::Or") {
+    const gd::InstructionsList& subConditions = condition.GetSubInstructions();
+    for (std::size_t i = 0; i < subConditions.size(); ++i) {
+      if (!IsKnownPure(subConditions[i])) return false;
+    }
+    return true;
+  }
+
+  // Expressions can call functions with side effects: only literals are
+  // known to be pure.
+  if ((type == "BuiltinCommonInstructions::CompareNumbers" ||
+       type == "Egal") &&
+      parameters.size() >= 3)
+    return ParseNumberLiteral(parameters[0].GetPlainString(), number) &&
+           ParseNumberLiteral(parameters[2].GetPlainString(), number);
+  if ((type == "BuiltinCommonInstructions::CompareStrings" ||
+       type == "StrEqual") &&
+      parameters.size() >= 3)
+    return ParseStringLiteral(parameters[0].GetPlainString(), string) &&
+           ParseStringLiteral(parameters[2].GetPlainString(), string);
+
+  if (IsReadOnlySceneVariableCondition(type) && !parameters.empty()) {
+    if (parameters[0].GetPlainString().find_first_of("[") != gd::String::npos)
+      return false;
+    if (type == "VarScene")
+      return parameters.size() >= 3 &&
+             ParseNumberLiteral(parameters[2].GetPlainString(), number);
+    if (type == "VarSceneTxt")
+      return parameters.size() >= 3 &&
+             ParseStringLiteral(parameters[2].GetPlainString(), string);
+    return type == "SceneVariableAsBoolean";
+  }
+
+  return false;
+}
+
+bool DeadEventsEliminator::IsApplyingOnDeadObject(
+    const gd::Instruction& instruction, bool isCondition) {
+  if (instruction.GetParametersCount() == 0) return false;
+
+  const gd::InstructionMetadata& metadata =
+      isCondition ? MetadataProvider::GetConditionMetadata(
+                        platform, instruction.GetType())
+                  : MetadataProvider::GetActionMetadata(
+                        platform, instruction.GetType());
+  if (MetadataProvider::IsBadInstructionMetadata(metadata) ||
+      metadata.codeExtraInformation.HasCustomCodeGenerator())
+    return false;
+  if (!metadata.IsObjectInstruction() && !metadata.IsBehaviorInstruction())
+    return false;
+
+  return IsDeadObjectOrGroup(instruction.GetParameter(0).GetPlainString());
+}
+
+bool DeadEventsEliminator::IsDeadObjectOrGroup(
+    const gd::String& objectOrGroupName) {
+  const gd::ObjectGroupsContainer& layoutGroups = layout.GetObjectGroups();
+  const gd::ObjectGroupsContainer& globalGroups = project.GetObjectGroups();
+  if (layoutGroups.Has(objectOrGroupName) ||
+      globalGroups.Has(objectOrGroupName)) {
+    if (projectFacts.GetPossiblyCreatedObjectsOrGroups().count(
+            objectOrGroupName))
+      return false;
+
+    const gd::ObjectGroup& group = layoutGroups.Has(objectOrGroupName)
+                                       ? layoutGroups.Get(objectOrGroupName)
+                                       : globalGroups.Get(objectOrGroupName);
+    for (const gd::String& objectName : group.GetAllObjectsNames()) {
+      if (!IsDeadObject(objectName)) return false;
+    }
+    return true;
+  }
+
+  // Unknown objects are left to the code generator.
+  if (!layout.HasObjectNamed(objectOrGroupName) &&
+      !project.HasObjectNamed(objectOrGroupName))
+    return false;
+
+  return IsDeadObject(objectOrGroupName);
+}
+
+bool DeadEventsEliminator::IsDeadObject(const gd::String& objectName) {
+  auto it = deadObjectsCache.find(objectName);
+  if (it != deadObjectsCache.end()) return it->second;
+
+  auto isDead = [&]() {
+    const std::set<gd::String>& possiblyCreatedObjectsOrGroups =
+        projectFacts.GetPossiblyCreatedObjectsOrGroups();
+    if (possiblyCreatedObjectsOrGroups.count(objectName)) return false;
+
+    // The object can be created through a group containing it.
+    const gd::ObjectGroupsContainer& layoutGroups = layout.GetObjectGroups();
+    const gd::ObjectGroupsContainer& globalGroups = project.GetObjectGroups();
+    for (const gd::String& name : possiblyCreatedObjectsOrGroups) {
+      if ((layoutGroups.Has(name) && layoutGroups.Get(name).Find(objectName)) ||
+          (globalGroups.Has(name) && globalGroups.Get(name).Find(objectName)))
+        return false;
+    }
+
+    if (layout.GetInitialInstances().HasInstancesOfObject(objectName))
+      return false;
+
+    // External layouts can be instantiated in any scene, by an action or by
+    // the game at startup.
+    for (std::size_t i = 0; i < project.GetExternalLayoutsCount(); ++i) {
+      if (project.GetExternalLayout(i).GetInitialInstances().HasInstancesOfObject(
+              objectName))
+        return false;
+    }
+
+    return true;
+  };
+
+  bool dead = isDead();
+  deadObjectsCache[objectName] = dead;
+  return dead;
+}
+
+}  // namespace gd
@@ -0,0 +1,158 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_DEADEVENTSELIMINATOR_H
+#define GDCORE_DEADEVENTSELIMINATOR_H
+#include <map>
+#include <set>
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class Instruction;
+class Layout;
+class Platform;
+class Project;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief What the events of a whole project can create or modify, as needed
+ * by gd::DeadEventsEliminator.
+ *
+ * Collecting them browses all the events of the project: this should be done
+ * once for an export, and shared by the eliminators of all the layouts.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API DeadEventsProjectFacts {
+ public:
+  DeadEventsProjectFacts(const gd::Platform& platform, gd::Project& project);
+  virtual ~DeadEventsProjectFacts();
+
+  /**
+   * \brief Return true if something in the project can run code that can't be
+   * analyzed (like JavaScript events or external source files).
+   */
+  bool HasArbitraryCode() const { return hasArbitraryCode; }
+
+  /**
+   * \brief Return the objects or groups used as a parameter of an action, and
+   * which could be created by it.
+   */
+  const std::set<gd::String>& GetPossiblyCreatedObjectsOrGroups() const {
+    return possiblyCreatedObjectsOrGroups;
+  }
+
+  /**
+   * \brief Return the root names of the scene variables possibly modified by
+   * an instruction.
+   */
+  const std::set<gd::String>& GetModifiedSceneVariables() const {
+    return modifiedSceneVariables;
+  }
+
+ private:
+  bool hasArbitraryCode;
+  std::set<gd::String> possiblyCreatedObjectsOrGroups;
+  std::set<gd::String> modifiedSceneVariables;
+};
+
+/**
+ * \brief Remove from an events list the events that can be proven to never
+ * run, and the actions that can be proven to never do anything.
+ *
+ * The analysis is static and conservative. Are considered as dead:
+ * - events having a condition that is always false: a comparison between two
+ * literals that is false, an inverted "Always" condition, or a comparison of a
+ * scene variable that is never modified in the project against a literal,
+ * - events and object/behavior actions applying on objects that have no
+ * instances in the layout (or in external layouts) and that are never created,
+ * - sub events of the removed events.
+ *
+ * Object and variable based rules are disabled if the project contains any
+ * event that can run arbitrary code (like JavaScript events) or any external
+ * source file, as the analysis can't know what they do.
+ *
+ * An always false condition only removes its event if all the conditions
+ * evaluated before it are known to have no side effects (comparisons of
+ * literals or of scene variables).
+ *
+ * \note This should only be used on a copy of the events, after they were
+ * preprocessed (so that links to external events are already replaced), and
+ * only for exports for runtime (not previews where the debugger can modify
+ * the game state).
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API DeadEventsEliminator : public ArbitraryEventsWorker {
+ public:
+  /**
+   * \brief Create the eliminator for the events of a layout, using the facts
+   * collected on the whole project to know the objects that can have
+   * instances and the scene variables that can be modified.
+   */
+  DeadEventsEliminator(const gd::Platform& platform_,
+                       gd::Project& project_,
+                       const gd::Layout& layout_,
+                       const gd::DeadEventsProjectFacts& projectFacts_);
+  virtual ~DeadEventsEliminator();
+
+  /**
+   * \brief Return the number of events removed by the worker.
+   */
+  std::size_t GetRemovedEventsCount() const { return removedEventsCount; }
+
+  /**
+   * \brief Return the number of actions removed by the worker.
+   */
+  std::size_t GetRemovedActionsCount() const { return removedActionsCount; }
+
+ private:
+  bool DoVisitEvent(gd::BaseEvent& event) override;
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override;
+
+  /**
+   * \brief Return true if the condition can be proven to be always false.
+   */
+  bool IsAlwaysFalse(const gd::Instruction& condition);
+
+  /**
+   * \brief Return true if the condition is known to have no side effects.
+   */
+  bool IsKnownPure(const gd::Instruction& condition);
+
+  /**
+   * \brief Return true if the object (or all the objects of the group) can be
+   * proven to never have any instance in the layout.
+   */
+  bool IsDeadObjectOrGroup(const gd::String& objectOrGroupName);
+  bool IsDeadObject(const gd::String& objectName);
+
+  /**
+   * \brief Return true if the object/behavior instruction is applying on an
+   * object that can be proven to never have any instance.
+   */
+  bool IsApplyingOnDeadObject(const gd::Instruction& instruction,
+                              bool isCondition);
+
+  const gd::Platform& platform;
+  gd::Project& project;
+  const gd::Layout& layout;
+  const gd::DeadEventsProjectFacts& projectFacts;
+
+  bool hasArbitraryCode;  ///< True if something in the project can run code
+                          ///< that can't be analyzed.
+  std::map<gd::String, bool> deadObjectsCache;
+
+  std::size_t removedEventsCount;
+  std::size_t removedActionsCount;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_DEADEVENTSELIMINATOR_H
@@ -0,0 +1,126 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsExpressionsValidator.h"
+
+#include <memory>
+#include <vector>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+EventsExpressionsValidator::EventsExpressionsValidator(
+    const gd::Platform& platform_)
+    : platform(platform_),
+      parserGlobalObjectsContainer(nullptr),
+      parserObjectsContainer(nullptr) {}
+
+EventsExpressionsValidator::~EventsExpressionsValidator() {}
+
+void EventsExpressionsValidator::DoVisitEventList(gd::EventsList& events) {
+  // Sub events are visited just after their parent event. Otherwise, this is
+  // the events list given to Launch.
+  bool isSubEvents = false;
+  if (!eventsLists.empty()) {
+    const gd::EventsList& parentEvents = *eventsLists.back().first;
+    std::size_t parentPosition = eventsLists.back().second;
+    isSubEvents = parentPosition < parentEvents.size() &&
+                  parentEvents[parentPosition].CanHaveSubEvents() &&
+                  &parentEvents[parentPosition].GetSubEvents() == &events;
+  }
+  if (!isSubEvents) eventsLists.clear();
+
+  // Positions are incremented before visiting each event.
+  eventsLists.push_back(std::make_pair(&events, static_cast<std::size_t>(-1)));
+}
+
+bool EventsExpressionsValidator::DoVisitEvent(gd::BaseEvent& event) {
+  // Events are visited depth first: leave the lists (of sub events) that
+  // were entirely visited.
+  while (!eventsLists.empty()) {
+    const gd::EventsList& events = *eventsLists.back().first;
+    std::size_t position = eventsLists.back().second + 1;
+    if (position < events.size() && &events[position] == &event) {
+      eventsLists.back().second = position;
+      break;
+    }
+
+    eventsLists.pop_back();
+  }
+
+  currentEventPath.clear();
+  for (const auto& eventsList : eventsLists)
+    currentEventPath.push_back(eventsList.second);
+
+  return false;
+}
+
+bool EventsExpressionsValidator::DoVisitInstruction(
+    gd::Instruction& instruction, bool isCondition) {
+  if (!parser || parserGlobalObjectsContainer != &GetGlobalObjectsContainer() ||
+      parserObjectsContainer != &GetObjectsContainer()) {
+    parserGlobalObjectsContainer = &GetGlobalObjectsContainer();
+    parserObjectsContainer = &GetObjectsContainer();
+    parser = gd::make_unique<gd::ExpressionParser2>(
+        platform, *parserGlobalObjectsContainer, *parserObjectsContainer);
+  }
+
+  const gd::InstructionMetadata& metadata =
+      GetInstructionMetadata(instruction.GetType(), isCondition);
+  for (std::size_t pNb = 0; pNb < metadata.parameters.size() &&
+                            pNb < instruction.GetParametersCount();
+       ++pNb) {
+    const gd::String& type = metadata.parameters[pNb].GetType();
+    gd::String expressionType =
+        gd::ParameterMetadata::IsExpression("number", type)
+            ? "number"
+            : (gd::ParameterMetadata::IsExpression("string", type) ? "string"
+                                                                    : "");
+    if (expressionType.empty()) continue;
+
+    auto node = parser->ParseExpression(
+        expressionType, instruction.GetParameter(pNb).GetPlainString());
+    if (!node) continue;
+
+    gd::ExpressionValidator validator;
+    node->Visit(validator);
+    for (auto* error : validator.GetErrors()) {
+      diagnostics.push_back(EventsExpressionDiagnostic(currentEventPath,
+                                                       instruction,
+                                                       isCondition,
+                                                       pNb,
+                                                       error->GetMessage(),
+                                                       error->GetStartPosition(),
+                                                       error->GetEndPosition()));
+    }
+  }
+
+  return false;
+}
+
+const gd::InstructionMetadata&
+EventsExpressionsValidator::GetInstructionMetadata(const gd::String& type,
+                                                   bool isCondition) {
+  auto& instructionsMetadata =
+      isCondition ? conditionsMetadata : actionsMetadata;
+  auto it = instructionsMetadata.find(type);
+  if (it != instructionsMetadata.end()) return *it->second;
+
+  const gd::InstructionMetadata& metadata =
+      isCondition ? gd::MetadataProvider::GetConditionMetadata(platform, type)
+                  : gd::MetadataProvider::GetActionMetadata(platform, type);
+  instructionsMetadata[type] = &metadata;
+  return metadata;
+}
+
+}  // namespace gd
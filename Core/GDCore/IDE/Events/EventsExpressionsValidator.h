@@ -0,0 +1,136 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EVENTSEXPRESSIONSVALIDATOR_H
+#define GDCORE_EVENTSEXPRESSIONSVALIDATOR_H
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class EventsList;
+class ExpressionParser2;
+class Instruction;
+class InstructionMetadata;
+class ObjectsContainer;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An error found in an expression of an events list by
+ * gd::EventsExpressionsValidator.
+ */
+class GD_CORE_API EventsExpressionDiagnostic {
+ public:
+  EventsExpressionDiagnostic(const std::vector<std::size_t>& eventPath_,
+                             const gd::Instruction& instruction_,
+                             bool isCondition_,
+                             std::size_t parameterIndex_,
+                             const gd::String& message_,
+                             std::size_t startPosition_,
+                             std::size_t endPosition_)
+      : eventPath(eventPath_),
+        instruction(&instruction_),
+        isCondition(isCondition_),
+        parameterIndex(parameterIndex_),
+        message(message_),
+        startPosition(startPosition_),
+        endPosition(endPosition_){};
+
+  /**
+   * \brief Return the positions of the event in the events list and in the
+   * sub events of its parents (the first position is the one in the events
+   * list given to the validator).
+   */
+  const std::vector<std::size_t>& GetEventPath() const { return eventPath; }
+
+  /**
+   * \brief Return the instruction containing the expression.
+   * \warning The instruction is only valid until the events are modified.
+   */
+  const gd::Instruction& GetInstruction() const { return *instruction; }
+
+  bool IsCondition() const { return isCondition; }
+
+  std::size_t GetParameterIndex() const { return parameterIndex; }
+
+  const gd::String& GetMessage() const { return message; }
+
+  /**
+   * \brief Return the position of the error in the expression.
+   */
+  std::size_t GetStartPosition() const { return startPosition; }
+
+  std::size_t GetEndPosition() const { return endPosition; }
+
+ private:
+  std::vector<std::size_t> eventPath;
+  const gd::Instruction* instruction;
+  bool isCondition;
+  std::size_t parameterIndex;
+  gd::String message;
+  std::size_t startPosition;
+  std::size_t endPosition;
+};
+
+/**
+ * \brief Validate all the number and string expressions of the instructions
+ * of an events list, and list the errors found.
+ *
+ * This is equivalent to parsing each expression with gd::ExpressionParser2 and
+ * visiting it with gd::ExpressionValidator, but a single parser is used and
+ * the metadata of the instructions are only searched once for each type,
+ * which makes validating a whole events sheet cheap.
+ *
+ * \see gd::ExpressionValidator
+ * \ingroup IDE
+ */
+class GD_CORE_API EventsExpressionsValidator
+    : public ArbitraryEventsWorkerWithContext {
+ public:
+  EventsExpressionsValidator(const gd::Platform& platform_);
+  virtual ~EventsExpressionsValidator();
+
+  /**
+   * \brief Return the errors found in the events. Errors of successive
+   * launches are accumulated.
+   */
+  const std::vector<EventsExpressionDiagnostic>& GetDiagnostics() const {
+    return diagnostics;
+  }
+
+ private:
+  void DoVisitEventList(gd::EventsList& events) override;
+  bool DoVisitEvent(gd::BaseEvent& event) override;
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override;
+
+  const gd::InstructionMetadata& GetInstructionMetadata(
+      const gd::String& type, bool isCondition);
+
+  const gd::Platform& platform;
+  std::unique_ptr<gd::ExpressionParser2> parser;
+  const gd::ObjectsContainer* parserGlobalObjectsContainer;
+  const gd::ObjectsContainer* parserObjectsContainer;
+  std::map<gd::String, const gd::InstructionMetadata*> conditionsMetadata;
+  std::map<gd::String, const gd::InstructionMetadata*> actionsMetadata;
+
+  /// The events lists being visited, with the position of the event being
+  /// visited in each of them.
+  std::vector<std::pair<const gd::EventsList*, std::size_t>> eventsLists;
+  std::vector<std::size_t> currentEventPath;
+
+  std::vector<EventsExpressionDiagnostic> diagnostics;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSEXPRESSIONSVALIDATOR_H
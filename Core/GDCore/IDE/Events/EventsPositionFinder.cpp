@@ -15,9 +15,9 @@ class EventsList;
 
 namespace gd {
 bool EventsPositionFinder::DoVisitEvent(gd::BaseEvent& event) {
-  auto it = std::find(searchedEvents.begin(), searchedEvents.end(), &event);
+  auto it = searchedEvents.find(&event);
   if (it != searchedEvents.end()) {
-    positions[it - searchedEvents.begin()] = index;
+    positions[it->second] = index;
   }
   index++;
   return false;
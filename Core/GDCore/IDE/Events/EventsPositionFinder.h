@@ -1,5 +1,6 @@
 #ifndef EventsPositionFinder_H
 #define EventsPositionFinder_H
+#include <unordered_map>
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/String.h"
@@ -31,14 +32,15 @@ class GD_CORE_API EventsPositionFinder : public ArbitraryEventsWorker {
    * Add an event for which the position must be reported in `GetPositions`.
    */
   void AddEventToSearch(gd::BaseEvent* event) {
-    searchedEvents.push_back(event);
+    searchedEvents.emplace(event, positions.size());
     positions.push_back(gd::String::npos);
   }
 
  private:
   bool DoVisitEvent(gd::BaseEvent& event) override;
 
-  std::vector<gd::BaseEvent*> searchedEvents;
+  std::unordered_map<gd::BaseEvent*, std::size_t>
+      searchedEvents;  ///< The searched events, with their index in positions.
   std::vector<std::size_t> positions;
   std::size_t index;
 };
@@ -6,7 +6,15 @@
 
 #include "GDCore/IDE/Events/EventsRefactorer.h"
 
+#include <algorithm>
 #include <memory>
+#if !defined(EMSCRIPTEN)
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Event.h"
@@ -18,7 +26,12 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
 #include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
 #include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
 
 using namespace std;
@@ -677,6 +690,28 @@ bool EventsRefactorer::ReplaceStringInConditions(
   return somethingModified;
 }
 
+gd::String EventsRefactorer::PrepareSearch(gd::String search, bool matchCase) {
+  const gd::String& ignored_characters = EventsRefactorer::searchIgnoredCharacters;
+
+  search.replace_if(search.begin(),
+                    search.end(),
+                    [ignored_characters](const char &c) {
+                      return ignored_characters.find(c) != gd::String::npos;
+                    },
+                    "");
+  search = search.LeftTrim().RightTrim();
+  search.RemoveConsecutiveOccurrences(search.begin(), search.end(), ' ');
+
+  return matchCase ? search : search.CaseFold();
+}
+
+bool EventsRefactorer::ContainsSearch(const gd::String& str,
+                                      const gd::String& preparedSearch,
+                                      bool matchCase) {
+  return (matchCase ? str.find(preparedSearch)
+                    : str.CaseFold().find(preparedSearch)) != gd::String::npos;
+}
+
 vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     const gd::Platform& platform,
     gd::EventsList& events,
@@ -687,18 +722,166 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     bool inEventStrings,
     bool inEventSentences) {
   vector<EventsSearchResult> results;
+  SearchInEventsList(platform,
+                     events,
+                     PrepareSearch(search, matchCase),
+                     matchCase,
+                     inConditions,
+                     inActions,
+                     inEventStrings,
+                     inEventSentences,
+                     results);
 
-  const gd::String& ignored_characters = EventsRefactorer::searchIgnoredCharacters;
+  return results;
+}
 
-  search.replace_if(search.begin(),
-                    search.end(),
-                    [ignored_characters](const char &c) {
-                      return ignored_characters.find(c) != gd::String::npos;
-                    },
-                    "");
-  search = search.LeftTrim().RightTrim();
-  search.RemoveConsecutiveOccurrences(search.begin(), search.end(), ' ');
+void EventsRefactorer::SearchInProjectEvents(
+    const gd::Platform& platform,
+    gd::Project& project,
+    gd::String search,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    bool inEventSentences,
+    std::function<void(const EventsListSearchResults&)> onResults) {
+  gd::String preparedSearch = PrepareSearch(search, matchCase);
+
+  // List all the events lists, like WholeProjectRefactorer::ExposeProjectEvents.
+  std::vector<EventsListSearchResults> eventsListsResults;
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    auto& layout = project.GetLayout(s);
+    eventsListsResults.push_back(
+        EventsListSearchResults(EventsListSearchResults::Layout,
+                                layout.GetName(),
+                                "",
+                                "",
+                                layout.GetEvents()));
+  }
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    auto& externalEvents = project.GetExternalEvents(s);
+    eventsListsResults.push_back(
+        EventsListSearchResults(EventsListSearchResults::ExternalEvents,
+                                externalEvents.GetName(),
+                                "",
+                                "",
+                                externalEvents.GetEvents()));
+  }
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    auto& eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    for (auto&& eventsFunction : eventsFunctionsExtension.GetInternalVector()) {
+      eventsListsResults.push_back(EventsListSearchResults(
+          EventsListSearchResults::ExtensionEventsFunction,
+          eventsFunction->GetName(),
+          eventsFunctionsExtension.GetName(),
+          "",
+          eventsFunction->GetEvents()));
+    }
+
+    for (auto&& eventsBasedBehavior :
+         eventsFunctionsExtension.GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      for (auto&& eventsFunction :
+           eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+        eventsListsResults.push_back(EventsListSearchResults(
+            EventsListSearchResults::BehaviorEventsFunction,
+            eventsFunction->GetName(),
+            eventsFunctionsExtension.GetName(),
+            eventsBasedBehavior->GetName(),
+            eventsFunction->GetEvents()));
+      }
+    }
+  }
+
+  auto searchInEventsList = [&](EventsListSearchResults& eventsListResults) {
+    SearchInEventsList(platform,
+                       eventsListResults.GetEventsList(),
+                       preparedSearch,
+                       matchCase,
+                       inConditions,
+                       inActions,
+                       inEventStrings,
+                       inEventSentences,
+                       eventsListResults.results);
+  };
+
+#if !defined(EMSCRIPTEN)
+  // Workers take the next events list to be searched, and give the searched
+  // lists to the calling thread which reports the results.
+  std::mutex searchedListsMutex;
+  std::condition_variable searchedListsCondition;
+  std::deque<std::size_t> searchedLists;
+  std::atomic<std::size_t> nextListIndex(0);
+  auto searchEventsLists = [&]() {
+    std::size_t listIndex;
+    while ((listIndex = nextListIndex++) < eventsListsResults.size()) {
+      searchInEventsList(eventsListsResults[listIndex]);
+
+      std::lock_guard<std::mutex> lock(searchedListsMutex);
+      searchedLists.push_back(listIndex);
+      searchedListsCondition.notify_one();
+    }
+  };
+
+  // The formatter of sentences is a lazily created singleton: create it
+  // before the workers use it.
+  gd::InstructionSentenceFormatter::Get();
+
+  std::size_t workersCount =
+      std::min(static_cast<std::size_t>(
+                   std::max(std::thread::hardware_concurrency(), 1u)),
+               eventsListsResults.size());
+  std::vector<std::thread> workers;
+  auto stopWorkers = [&]() {
+    nextListIndex = eventsListsResults.size();
+    for (auto& worker : workers) worker.join();
+  };
+
+  try {
+    for (std::size_t i = 0; i < workersCount; ++i)
+      workers.push_back(std::thread(searchEventsLists));
+
+    for (std::size_t reportedCount = 0;
+         reportedCount < eventsListsResults.size();
+         ++reportedCount) {
+      std::size_t listIndex;
+      {
+        std::unique_lock<std::mutex> lock(searchedListsMutex);
+        searchedListsCondition.wait(lock,
+                                    [&]() { return !searchedLists.empty(); });
+        listIndex = searchedLists.front();
+        searchedLists.pop_front();
+      }
+
+      if (!eventsListsResults[listIndex].GetResults().empty())
+        onResults(eventsListsResults[listIndex]);
+    }
+  } catch (...) {
+    // Workers must be joined before the lists they search are destroyed,
+    // even if a worker can't be started or onResults throws.
+    stopWorkers();
+    throw;
+  }
+  stopWorkers();
+#else
+  for (auto& eventsListResults : eventsListsResults) {
+    searchInEventsList(eventsListResults);
+    if (!eventsListResults.GetResults().empty()) onResults(eventsListResults);
+  }
+#endif
+}
 
+void EventsRefactorer::SearchInEventsList(
+    const gd::Platform& platform,
+    gd::EventsList& events,
+    const gd::String& preparedSearch,
+    bool matchCase,
+    bool inConditions,
+    bool inActions,
+    bool inEventStrings,
+    bool inEventSentences,
+    std::vector<EventsSearchResult>& results) {
   for (std::size_t i = 0; i < events.size(); ++i) {
     bool eventAddedInResults = false;
 
@@ -707,8 +890,11 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
           events[i].GetAllConditionsVectors();
       for (std::size_t j = 0; j < conditionsVectors.size(); ++j) {
         if (!eventAddedInResults &&
-            SearchStringInConditions(
-                platform, *conditionsVectors[j], search, matchCase, inEventSentences)) {
+            SearchStringInConditions(platform,
+                                     *conditionsVectors[j],
+                                     preparedSearch,
+                                     matchCase,
+                                     inEventSentences)) {
           results.push_back(EventsSearchResult(
               std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
               &events,
@@ -722,8 +908,11 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
           events[i].GetAllActionsVectors();
       for (std::size_t j = 0; j < actionsVectors.size(); ++j) {
         if (!eventAddedInResults &&
-            SearchStringInActions(
-                platform, *actionsVectors[j], search, matchCase, inEventSentences)) {
+            SearchStringInActions(platform,
+                                  *actionsVectors[j],
+                                  preparedSearch,
+                                  matchCase,
+                                  inEventSentences)) {
           results.push_back(EventsSearchResult(
               std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
               &events,
@@ -734,7 +923,7 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
 
     if (inEventStrings) {
       if (!eventAddedInResults &&
-          SearchStringInEvent(events[i], search, matchCase)) {
+          SearchStringInEvent(events[i], preparedSearch, matchCase)) {
         results.push_back(EventsSearchResult(
             std::weak_ptr<gd::BaseEvent>(events.GetEventSmartPtr(i)),
             &events,
@@ -743,51 +932,43 @@ vector<EventsSearchResult> EventsRefactorer::SearchInEvents(
     }
 
     if (events[i].CanHaveSubEvents()) {
-      vector<EventsSearchResult> subResults =
-          SearchInEvents(platform,
+      SearchInEventsList(platform,
                          events[i].GetSubEvents(),
-                         search,
+                         preparedSearch,
                          matchCase,
                          inConditions,
                          inActions,
                          inEventStrings,
-                         inEventSentences);
-      std::copy(
-          subResults.begin(), subResults.end(), std::back_inserter(results));
+                         inEventSentences,
+                         results);
     }
   }
-
-  return results;
 }
 
 bool EventsRefactorer::SearchStringInActions(
     const gd::Platform& platform,
     gd::InstructionsList& actions,
-    gd::String search,
+    const gd::String& preparedSearch,
     bool matchCase,
     bool inSentences) {
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
     for (std::size_t pNb = 0; pNb < actions[aId].GetParameters().size();
          ++pNb) {
-      size_t foundPosition =
-          matchCase
-              ? actions[aId].GetParameter(pNb).GetPlainString().find(search)
-              : actions[aId]
-                    .GetParameter(pNb)
-                    .GetPlainString()
-                    .FindCaseInsensitive(search);
-
-      if (foundPosition != gd::String::npos) return true;
+      if (ContainsSearch(actions[aId].GetParameter(pNb).GetPlainString(),
+                         preparedSearch,
+                         matchCase))
+        return true;
     }
 
-    if (inSentences && SearchStringInFormattedText(
-                           platform, actions[aId], search, matchCase, false))
+    if (inSentences &&
+        SearchStringInFormattedText(
+            platform, actions[aId], preparedSearch, matchCase, false))
       return true;
 
     if (!actions[aId].GetSubInstructions().empty() &&
         SearchStringInActions(platform,
                               actions[aId].GetSubInstructions(),
-                              search,
+                              preparedSearch,
                               matchCase,
                               inSentences))
       return true;
@@ -799,7 +980,7 @@ bool EventsRefactorer::SearchStringInActions(
 bool EventsRefactorer::SearchStringInFormattedText(
     const gd::Platform& platform,
     gd::Instruction& instruction,
-    gd::String search,
+    const gd::String& preparedSearch,
     bool matchCase,
     bool isCondition) {
   const auto& metadata = isCondition
@@ -821,41 +1002,33 @@ bool EventsRefactorer::SearchStringInFormattedText(
   completeSentence.RemoveConsecutiveOccurrences(
       completeSentence.begin(), completeSentence.end(), ' ');
 
-  size_t foundPosition = matchCase
-                             ? completeSentence.find(search)
-                             : completeSentence.FindCaseInsensitive(search);
-
-  return foundPosition != gd::String::npos;
+  return ContainsSearch(completeSentence, preparedSearch, matchCase);
 }
 
 bool EventsRefactorer::SearchStringInConditions(
     const gd::Platform& platform,
     gd::InstructionsList& conditions,
-    gd::String search,
+    const gd::String& preparedSearch,
     bool matchCase,
     bool inSentences) {
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
     for (std::size_t pNb = 0; pNb < conditions[cId].GetParameters().size();
          ++pNb) {
-      size_t foundPosition =
-          matchCase
-              ? conditions[cId].GetParameter(pNb).GetPlainString().find(search)
-              : conditions[cId]
-                    .GetParameter(pNb)
-                    .GetPlainString()
-                    .FindCaseInsensitive(search);
-
-      if (foundPosition != gd::String::npos) return true;
+      if (ContainsSearch(conditions[cId].GetParameter(pNb).GetPlainString(),
+                         preparedSearch,
+                         matchCase))
+        return true;
     }
 
-    if (inSentences && SearchStringInFormattedText(
-                           platform, conditions[cId], search, matchCase, true))
+    if (inSentences &&
+        SearchStringInFormattedText(
+            platform, conditions[cId], preparedSearch, matchCase, true))
       return true;
 
     if (!conditions[cId].GetSubInstructions().empty() &&
         SearchStringInConditions(platform,
                                  conditions[cId].GetSubInstructions(),
-                                 search,
+                                 preparedSearch,
                                  matchCase,
                                  inSentences))
       return true;
@@ -865,14 +1038,10 @@ bool EventsRefactorer::SearchStringInConditions(
 }
 
 bool EventsRefactorer::SearchStringInEvent(gd::BaseEvent& event,
-                                           gd::String search,
+                                           const gd::String& preparedSearch,
                                            bool matchCase) {
-  for (gd::String str : event.GetAllSearchableStrings()) {
-    if (matchCase) {
-      if (str.find(search) != gd::String::npos) return true;
-    } else {
-      if (str.FindCaseInsensitive(search) != gd::String::npos) return true;
-    }
+  for (const gd::String& str : event.GetAllSearchableStrings()) {
+    if (ContainsSearch(str, preparedSearch, matchCase)) return true;
   }
 
   return false;
@@ -5,6 +5,7 @@
  */
 #ifndef GDCORE_EVENTSREFACTORER_H
 #define GDCORE_EVENTSREFACTORER_H
+#include <functional>
 #include <memory>
 #include <vector>
 #include "GDCore/Events/Instruction.h"
@@ -15,6 +16,7 @@ class EventsList;
 class ObjectsContainer;
 class Platform;
 class ExternalEvents;
+class Project;
 class BaseEvent;
 class Instruction;
 typedef std::shared_ptr<gd::BaseEvent> BaseEventSPtr;
@@ -59,6 +61,67 @@ class GD_CORE_API EventsSearchResult {
   const gd::BaseEvent & GetEvent() const { return *event.lock(); }
 };
 
+/**
+ * \brief The results of a search in an events list of a project, returned by
+ * EventsRefactorer::SearchInProjectEvents.
+ */
+class GD_CORE_API EventsListSearchResults {
+ public:
+  enum EventsListType {
+    Layout,
+    ExternalEvents,
+    ExtensionEventsFunction,
+    BehaviorEventsFunction
+  };
+
+  EventsListSearchResults(EventsListType type_,
+                          const gd::String& name_,
+                          const gd::String& extensionName_,
+                          const gd::String& behaviorName_,
+                          gd::EventsList& eventsList_)
+      : type(type_),
+        name(name_),
+        extensionName(extensionName_),
+        behaviorName(behaviorName_),
+        eventsList(&eventsList_){};
+
+  /**
+   * \brief Return the kind of events list that was searched.
+   */
+  EventsListType GetType() const { return type; }
+
+  /**
+   * \brief Return the name of the layout, external events or events function.
+   */
+  const gd::String& GetName() const { return name; }
+
+  /**
+   * \brief Return the name of the extension of the events function (empty
+   * for layouts and external events).
+   */
+  const gd::String& GetExtensionName() const { return extensionName; }
+
+  /**
+   * \brief Return the name of the behavior of the events function (empty if
+   * the events function is not a behavior function).
+   */
+  const gd::String& GetBehaviorName() const { return behaviorName; }
+
+  gd::EventsList& GetEventsList() const { return *eventsList; }
+
+  const std::vector<EventsSearchResult>& GetResults() const { return results; }
+
+ private:
+  EventsListType type;
+  gd::String name;
+  gd::String extensionName;
+  gd::String behaviorName;
+  gd::EventsList* eventsList;
+  std::vector<EventsSearchResult> results;
+
+  friend class EventsRefactorer;
+};
+
 /**
  * \brief Class containing functions to do refactoring tasks on events.
  *
@@ -107,6 +170,26 @@ class GD_CORE_API EventsRefactorer {
                                                         bool inEventStrings,
                                                         bool inEventSentences);
 
+  /**
+   * Search for a gd::String in the events of all the layouts, external events
+   * and events functions of the project.
+   *
+   * \param onResults Called with the results of each events list containing
+   * the string, as soon as they are found. It's always called from the thread
+   * calling this function, but in native builds, events lists are searched
+   * concurrently and results are not given in the order of the project.
+   */
+  static void SearchInProjectEvents(
+      const gd::Platform& platform,
+      gd::Project& project,
+      gd::String search,
+      bool matchCase,
+      bool inConditions,
+      bool inActions,
+      bool inEventStrings,
+      bool inEventSentences,
+      std::function<void(const EventsListSearchResults&)> onResults);
+
   /**
    * Replace all occurrences of a gd::String in events
    */
@@ -208,23 +291,44 @@ class GD_CORE_API EventsRefactorer {
                                      gd::String newString,
                                      bool matchCase);
 
+  /**
+   * Remove the ignored characters and the consecutive spaces of a search and,
+   * if the case does not matter, case fold it.
+   *
+   * Searched strings are case folded only once before being compared to a
+   * prepared search.
+   */
+  static gd::String PrepareSearch(gd::String search, bool matchCase);
+  static bool ContainsSearch(const gd::String& str,
+                             const gd::String& preparedSearch,
+                             bool matchCase);
+
+  static void SearchInEventsList(const gd::Platform& platform,
+                                 gd::EventsList& events,
+                                 const gd::String& preparedSearch,
+                                 bool matchCase,
+                                 bool inConditions,
+                                 bool inActions,
+                                 bool inEventStrings,
+                                 bool inEventSentences,
+                                 std::vector<EventsSearchResult>& results);
   static bool SearchStringInFormattedText(const gd::Platform& platform,
                                           gd::Instruction& instruction,
-                                          gd::String search,
+                                          const gd::String& preparedSearch,
                                           bool matchCase,
                                           bool isCondition);
   static bool SearchStringInActions(const gd::Platform& platform,
                                     gd::InstructionsList& actions,
-                                    gd::String search,
+                                    const gd::String& preparedSearch,
                                     bool matchCase,
                                     bool inSentences);
   static bool SearchStringInConditions(const gd::Platform& platform,
                                        gd::InstructionsList& conditions,
-                                       gd::String search,
+                                       const gd::String& preparedSearch,
                                        bool matchCase,
                                        bool inSentences);
   static bool SearchStringInEvent(gd::BaseEvent& events,
-                                  gd::String search,
+                                  const gd::String& preparedSearch,
                                   bool matchCase);
 
   static const gd::String searchIgnoredCharacters;
@@ -0,0 +1,386 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ExpressionCompletionIndex.h"
+
+#include <algorithm>
+
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace gd {
+
+const gd::ExpressionMetadata ExpressionCompletion::badExpressionMetadata;
+
+const gd::ExpressionMetadata& ExpressionCompletion::GetExpressionMetadata()
+    const {
+  return expressionMetadata ? *expressionMetadata : badExpressionMetadata;
+}
+
+namespace {
+bool StartsWith(const gd::String& str, const gd::String& prefix) {
+  return str.Raw().compare(0, prefix.Raw().size(), prefix.Raw()) == 0;
+}
+
+/**
+ * \brief Check if a variable name can be written as is in an expression
+ * (same characters as the ones refused by the IDE).
+ */
+bool IsValidVariableName(const gd::String& name) {
+  return name.Raw().find_first_of(",.\"()[]{}+-<>?^=:!/* '") ==
+         std::string::npos;
+}
+}  // namespace
+
+void ExpressionCompletionIndex::SortedNames::Add(
+    const gd::String& name, const gd::ExpressionMetadata* expressionMetadata) {
+  const gd::String& separator = gd::PlatformExtension::GetNamespaceSeparator();
+  std::size_t separatorPosition = name.Raw().rfind(separator.Raw());
+
+  Entry entry;
+  entry.name = name;
+  entry.lowerCaseName = name.LowerCase();
+  entry.searchedName =
+      separatorPosition == std::string::npos
+          ? entry.lowerCaseName
+          : gd::String::FromUTF8(name.Raw().substr(separatorPosition +
+                                                   separator.Raw().size()))
+                .LowerCase();
+  entry.expressionMetadata = expressionMetadata;
+  entries.push_back(std::move(entry));
+}
+
+void ExpressionCompletionIndex::SortedNames::Sort() {
+  std::sort(entries.begin(),
+            entries.end(),
+            [](const Entry& entry, const Entry& otherEntry) {
+              if (entry.searchedName != otherEntry.searchedName)
+                return entry.searchedName < otherEntry.searchedName;
+              return entry.name < otherEntry.name;
+            });
+}
+
+void ExpressionCompletionIndex::SortedNames::FindCompletions(
+    ExpressionCompletionDescription::CompletionKind completionKind,
+    const gd::String& prefix,
+    bool isExact,
+    bool hideExactMatch,
+    std::size_t maxCount,
+    std::vector<ExpressionCompletion>& completions) const {
+  if (isExact) {
+    for (const Entry& entry : entries) {
+      if (entry.name == prefix) {
+        completions.push_back(ExpressionCompletion(
+            completionKind, entry.name, entry.expressionMetadata));
+        return;
+      }
+    }
+    return;
+  }
+
+  gd::String lowerCasePrefix = prefix.LowerCase();
+  std::size_t count = 0;
+  auto addCompletion = [&](const Entry& entry) {
+    if (hideExactMatch && entry.name == prefix) return;
+
+    completions.push_back(ExpressionCompletion(
+        completionKind, entry.name, entry.expressionMetadata));
+    count++;
+  };
+
+  // Names starting with the prefix are contiguous, as names are sorted.
+  auto it = std::lower_bound(entries.begin(),
+                             entries.end(),
+                             lowerCasePrefix,
+                             [](const Entry& entry, const gd::String& prefix) {
+                               return entry.searchedName < prefix;
+                             });
+  for (; it != entries.end() && count < maxCount &&
+         StartsWith(it->searchedName, lowerCasePrefix);
+       ++it) {
+    addCompletion(*it);
+  }
+
+  // Then the names containing the prefix somewhere else.
+  if (lowerCasePrefix.empty()) return;
+  for (auto it = entries.begin(); it != entries.end() && count < maxCount;
+       ++it) {
+    if (!StartsWith(it->searchedName, lowerCasePrefix) &&
+        it->lowerCaseName.Raw().find(lowerCasePrefix.Raw()) !=
+            std::string::npos)
+      addCompletion(*it);
+  }
+}
+
+void ExpressionCompletionIndex::AddExpressions(
+    ExpressionsByType& expressions,
+    std::map<gd::String, gd::ExpressionMetadata>& numberExpressions,
+    std::map<gd::String, gd::ExpressionMetadata>& stringExpressions,
+    const gd::ObjectMetadata* objectMetadata) {
+  auto isListed = [&objectMetadata](const gd::ExpressionMetadata& metadata) {
+    return metadata.IsShown() &&
+           (!objectMetadata ||
+            !objectMetadata->IsUnsupportedBaseObjectCapability(
+                metadata.GetRequiredBaseObjectCapability()));
+  };
+
+  for (const auto& it : numberExpressions) {
+    if (!isListed(it.second)) continue;
+
+    expressions.numbers.Add(it.first, &it.second);
+    expressions.numbersAndStrings.Add(it.first, &it.second);
+  }
+  for (const auto& it : stringExpressions) {
+    if (!isListed(it.second)) continue;
+
+    expressions.strings.Add(it.first, &it.second);
+    expressions.numbersAndStrings.Add(it.first, &it.second);
+  }
+}
+
+void ExpressionCompletionIndex::SortExpressions(
+    ExpressionsByType& expressions) {
+  expressions.numbers.Sort();
+  expressions.strings.Sort();
+  expressions.numbersAndStrings.Sort();
+}
+
+void ExpressionCompletionIndex::AddVariables(SortedNames& names,
+                                             const gd::String& name,
+                                             const gd::Variable& variable) {
+  names.Add(name);
+  if (variable.GetType() != gd::Variable::Structure) return;
+
+  // Children are not listed if they can't be accessed with a dot.
+  for (const auto& child : variable.GetAllChildren()) {
+    if (IsValidVariableName(child.first))
+      AddVariables(names, name + "." + child.first, *child.second);
+  }
+}
+
+void ExpressionCompletionIndex::AddVariables(
+    SortedNames& names, const gd::VariablesContainer& variables) {
+  for (std::size_t i = 0; i < variables.Count(); ++i) {
+    // Invalid names would not be parsed correctly anyway.
+    if (IsValidVariableName(variables.GetNameAt(i)))
+      AddVariables(names, variables.GetNameAt(i), variables.Get(i));
+  }
+  names.Sort();
+}
+
+void ExpressionCompletionIndex::IndexPlatform(const gd::Platform& platform) {
+  freeExpressions = ExpressionsByType();
+  objectsExpressions.clear();
+  behaviorsExpressions.clear();
+
+  std::map<gd::String, gd::PlatformExtension*> objectsExtensions;
+  for (const auto& extension : platform.GetAllPlatformExtensions()) {
+    AddExpressions(freeExpressions,
+                   extension->GetAllExpressions(),
+                   extension->GetAllStrExpressions());
+
+    for (const gd::String& objectType :
+         extension->GetExtensionObjectsTypes()) {
+      objectsExtensions[objectType] = extension.get();
+      AddExpressions(objectsExpressions[objectType],
+                     extension->GetAllExpressionsForObject(objectType),
+                     extension->GetAllStrExpressionsForObject(objectType));
+    }
+    for (const gd::String& behaviorType : extension->GetBehaviorsTypes()) {
+      AddExpressions(behaviorsExpressions[behaviorType],
+                     extension->GetAllExpressionsForBehavior(behaviorType),
+                     extension->GetAllStrExpressionsForBehavior(behaviorType));
+    }
+  }
+
+  // The expressions of the base object (an empty type) are added to the ones
+  // of each object, if supported by the object.
+  auto baseObjectExtensionIt = objectsExtensions.find("");
+  if (baseObjectExtensionIt != objectsExtensions.end()) {
+    gd::PlatformExtension& baseObjectExtension =
+        *baseObjectExtensionIt->second;
+    for (auto& it : objectsExpressions) {
+      const gd::String& objectType = it.first;
+      if (objectType.empty()) continue;
+
+      AddExpressions(
+          it.second,
+          baseObjectExtension.GetAllExpressionsForObject(""),
+          baseObjectExtension.GetAllStrExpressionsForObject(""),
+          &objectsExtensions[objectType]->GetObjectMetadata(objectType));
+    }
+  }
+
+  SortExpressions(freeExpressions);
+  for (auto& it : objectsExpressions) SortExpressions(it.second);
+  for (auto& it : behaviorsExpressions) SortExpressions(it.second);
+}
+
+void ExpressionCompletionIndex::IndexObjects(
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer) {
+  objectsAndGroups = SortedNames();
+  objectsTypes.clear();
+  behaviorsTypes.clear();
+  objectsBehaviors.clear();
+  objectsVariables.clear();
+
+  auto addObjectOrGroup = [&](const gd::String& name) {
+    // Objects of the scene hide the global objects with the same name.
+    if (objectsTypes.find(name) != objectsTypes.end()) return false;
+
+    objectsAndGroups.Add(name);
+    objectsTypes[name] = gd::GetTypeOfObject(
+        globalObjectsContainer, objectsContainer, name, true);
+
+    SortedNames& behaviors = objectsBehaviors[name];
+    for (const gd::String& behaviorName : gd::GetBehaviorsOfObject(
+             globalObjectsContainer, objectsContainer, name, true)) {
+      behaviors.Add(behaviorName);
+      if (behaviorsTypes.find(behaviorName) == behaviorsTypes.end())
+        behaviorsTypes[behaviorName] = gd::GetTypeOfBehavior(
+            globalObjectsContainer, objectsContainer, behaviorName, true);
+    }
+    behaviors.Sort();
+    return true;
+  };
+
+  for (const gd::ObjectsContainer* container :
+       {&objectsContainer, &globalObjectsContainer}) {
+    for (const auto& object : container->GetObjects()) {
+      if (!addObjectOrGroup(object->GetName())) continue;
+
+      AddVariables(objectsVariables[object->GetName()],
+                   object->GetVariables());
+    }
+
+    const gd::ObjectGroupsContainer& groups = container->GetObjectGroups();
+    for (std::size_t i = 0; i < groups.size(); ++i)
+      addObjectOrGroup(groups.Get(i).GetName());
+  }
+  objectsAndGroups.Sort();
+}
+
+void ExpressionCompletionIndex::IndexVariables(
+    const gd::VariablesContainer& globalVariablesContainer,
+    const gd::VariablesContainer& sceneVariablesContainer) {
+  globalVariables = SortedNames();
+  sceneVariables = SortedNames();
+
+  AddVariables(globalVariables, globalVariablesContainer);
+  AddVariables(sceneVariables, sceneVariablesContainer);
+}
+
+void ExpressionCompletionIndex::FindExpressionCompletions(
+    const ExpressionsByType& expressions,
+    const ExpressionCompletionDescription& description,
+    std::size_t maxCount,
+    std::vector<ExpressionCompletion>& completions) {
+  const gd::String& type = description.GetType();
+  const SortedNames* names =
+      type == "number"
+          ? &expressions.numbers
+          : type == "string"
+                ? &expressions.strings
+                : type == "number|string" ? &expressions.numbersAndStrings
+                                          : nullptr;
+  if (!names) return;
+
+  names->FindCompletions(ExpressionCompletionDescription::Expression,
+                         description.GetPrefix(),
+                         description.IsExact(),
+                         false,
+                         maxCount,
+                         completions);
+}
+
+std::vector<ExpressionCompletion> ExpressionCompletionIndex::GetCompletions(
+    const ExpressionCompletionDescription& description,
+    std::size_t maxCount) const {
+  std::vector<ExpressionCompletion> completions;
+  const gd::String& objectName = description.GetObjectName();
+
+  auto findIn = [&](const std::map<gd::String, SortedNames>& namesMap,
+                    const gd::String& key) {
+    auto it = namesMap.find(key);
+    if (it == namesMap.end()) return;
+
+    it->second.FindCompletions(description.GetCompletionKind(),
+                               description.GetPrefix(),
+                               false,
+                               false,
+                               maxCount,
+                               completions);
+  };
+
+  switch (description.GetCompletionKind()) {
+    case ExpressionCompletionDescription::Object:
+      // Objects already fully typed are not suggested.
+      objectsAndGroups.FindCompletions(ExpressionCompletionDescription::Object,
+                                       description.GetPrefix(),
+                                       false,
+                                       true,
+                                       maxCount,
+                                       completions);
+      break;
+    case ExpressionCompletionDescription::Behavior:
+      findIn(objectsBehaviors, objectName);
+      break;
+    case ExpressionCompletionDescription::Variable:
+      if (description.GetType() == "globalvar" ||
+          description.GetType() == "scenevar") {
+        (description.GetType() == "globalvar" ? globalVariables
+                                              : sceneVariables)
+            .FindCompletions(ExpressionCompletionDescription::Variable,
+                             description.GetPrefix(),
+                             false,
+                             false,
+                             maxCount,
+                             completions);
+      } else if (description.GetType() == "objectvar") {
+        findIn(objectsVariables, objectName);
+      }
+      break;
+    case ExpressionCompletionDescription::Expression: {
+      if (objectName.empty()) {
+        FindExpressionCompletions(
+            freeExpressions, description, maxCount, completions);
+        break;
+      }
+
+      const std::map<gd::String, gd::String>& types =
+          description.GetBehaviorName().empty() ? objectsTypes
+                                                : behaviorsTypes;
+      const std::map<gd::String, ExpressionsByType>& expressionsByTypes =
+          description.GetBehaviorName().empty() ? objectsExpressions
+                                                : behaviorsExpressions;
+      auto typeIt = types.find(description.GetBehaviorName().empty()
+                                   ? objectName
+                                   : description.GetBehaviorName());
+      // Unknown objects can still use the expressions of the base object.
+      auto expressionsIt = expressionsByTypes.find(
+          typeIt != types.end() ? typeIt->second : "");
+      if (expressionsIt != expressionsByTypes.end())
+        FindExpressionCompletions(
+            expressionsIt->second, description, maxCount, completions);
+      break;
+    }
+    case ExpressionCompletionDescription::Text:
+      break;
+  }
+
+  return completions;
+}
+
+}  // namespace gd
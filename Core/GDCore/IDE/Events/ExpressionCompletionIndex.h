@@ -0,0 +1,201 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONCOMPLETIONINDEX_H
+#define GDCORE_EXPRESSIONCOMPLETIONINDEX_H
+
+#include <map>
+#include <vector>
+
+#include "GDCore/IDE/Events/ExpressionCompletionFinder.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class ExpressionMetadata;
+class ObjectMetadata;
+class ObjectsContainer;
+class Platform;
+class Variable;
+class VariablesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A completion found by gd::ExpressionCompletionIndex, ready to be
+ * shown to the user.
+ */
+struct GD_CORE_API ExpressionCompletion {
+ public:
+  ExpressionCompletion(
+      ExpressionCompletionDescription::CompletionKind completionKind_,
+      const gd::String& completion_,
+      const gd::ExpressionMetadata* expressionMetadata_ = nullptr)
+      : completionKind(completionKind_),
+        completion(completion_),
+        expressionMetadata(expressionMetadata_) {}
+
+  /** \brief Return the kind of the completion */
+  ExpressionCompletionDescription::CompletionKind GetCompletionKind() const {
+    return completionKind;
+  }
+
+  /**
+   * \brief Return the text to be inserted (the name of the expression, object,
+   * behavior or variable).
+   */
+  const gd::String& GetCompletion() const { return completion; }
+
+  /**
+   * \brief Check if the completion is an expression, with its metadata.
+   */
+  bool HasExpressionMetadata() const { return expressionMetadata != nullptr; }
+
+  /**
+   * \brief Return the metadata of the expression, if the completion is an
+   * expression. Returns an empty metadata otherwise.
+   */
+  const gd::ExpressionMetadata& GetExpressionMetadata() const;
+
+ private:
+  ExpressionCompletionDescription::CompletionKind completionKind;
+  gd::String completion;
+  const gd::ExpressionMetadata* expressionMetadata;
+
+  static const gd::ExpressionMetadata badExpressionMetadata;
+};
+
+/**
+ * \brief An index of the names that can be completed in an expression
+ * (expressions, objects, behaviors and variables), used to find the
+ * completions corresponding to a gd::ExpressionCompletionDescription.
+ *
+ * The names are lower cased and sorted once, when indexed, so that finding
+ * completions only looks at the names of the relevant kind (and type of
+ * object or behavior) instead of scanning all the extensions on every
+ * keystroke. Completions are ranked: names starting with the searched prefix
+ * (ignoring the namespace and the case) first, by alphabetical order, then
+ * names containing it.
+ *
+ * The index keeps pointers to the metadata of the platform: index the
+ * platform again when extensions are added or removed. Objects and variables
+ * must be indexed again when they are changed.
+ *
+ * \see gd::ExpressionCompletionFinder
+ */
+class GD_CORE_API ExpressionCompletionIndex {
+ public:
+  ExpressionCompletionIndex(){};
+  virtual ~ExpressionCompletionIndex(){};
+
+  /**
+   * \brief Index the free, object and behavior expressions of the platform.
+   *
+   * Object expressions include the expressions of the base object that are
+   * supported by the object.
+   */
+  void IndexPlatform(const gd::Platform& platform);
+
+  /**
+   * \brief Index the objects and groups that can be used, with their
+   * behaviors and variables.
+   */
+  void IndexObjects(const gd::ObjectsContainer& globalObjectsContainer,
+                    const gd::ObjectsContainer& objectsContainer);
+
+  /**
+   * \brief Index the global and scene variables (and their children, when
+   * they are structures).
+   */
+  void IndexVariables(const gd::VariablesContainer& globalVariables,
+                      const gd::VariablesContainer& sceneVariables);
+
+  /**
+   * \brief Return at most \a maxCount completions for the given description,
+   * best ranked first.
+   *
+   * Texts are not indexed, as they depend on the parameter being completed.
+   */
+  std::vector<ExpressionCompletion> GetCompletions(
+      const ExpressionCompletionDescription& description,
+      std::size_t maxCount) const;
+
+ private:
+  /**
+   * \brief Names sorted by their lower cased name without namespace.
+   */
+  class SortedNames {
+   public:
+    void Add(const gd::String& name,
+             const gd::ExpressionMetadata* expressionMetadata = nullptr);
+    void Sort();
+
+    void FindCompletions(
+        ExpressionCompletionDescription::CompletionKind completionKind,
+        const gd::String& prefix,
+        bool isExact,
+        bool hideExactMatch,
+        std::size_t maxCount,
+        std::vector<ExpressionCompletion>& completions) const;
+
+   private:
+    struct Entry {
+      gd::String name;
+      gd::String searchedName;  ///< The name without namespace, lower cased.
+      gd::String lowerCaseName;
+      const gd::ExpressionMetadata* expressionMetadata;
+    };
+
+    std::vector<Entry> entries;
+  };
+
+  /**
+   * \brief Expressions, by the type they return.
+   */
+  struct ExpressionsByType {
+    SortedNames numbers;
+    SortedNames strings;
+    SortedNames numbersAndStrings;
+  };
+
+  static void AddExpressions(
+      ExpressionsByType& expressions,
+      std::map<gd::String, gd::ExpressionMetadata>& numberExpressions,
+      std::map<gd::String, gd::ExpressionMetadata>& stringExpressions,
+      const gd::ObjectMetadata* objectMetadata = nullptr);
+  static void AddVariables(SortedNames& names,
+                           const gd::VariablesContainer& variables);
+  static void AddVariables(SortedNames& names,
+                           const gd::String& name,
+                           const gd::Variable& variable);
+  static void SortExpressions(ExpressionsByType& expressions);
+  static void FindExpressionCompletions(
+      const ExpressionsByType& expressions,
+      const ExpressionCompletionDescription& description,
+      std::size_t maxCount,
+      std::vector<ExpressionCompletion>& completions);
+
+  ExpressionsByType freeExpressions;
+  std::map<gd::String, ExpressionsByType>
+      objectsExpressions;  ///< The expressions of each object type, including
+                           ///< the supported base object expressions.
+  std::map<gd::String, ExpressionsByType>
+      behaviorsExpressions;  ///< The expressions of each behavior type.
+
+  SortedNames objectsAndGroups;
+  std::map<gd::String, gd::String> objectsTypes;  ///< The type of each object
+                                                  ///< and group.
+  std::map<gd::String, gd::String> behaviorsTypes;  ///< The type of each
+                                                    ///< behavior name.
+  std::map<gd::String, SortedNames> objectsBehaviors;
+  std::map<gd::String, SortedNames> objectsVariables;
+
+  SortedNames globalVariables;
+  SortedNames sceneVariables;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONCOMPLETIONINDEX_H
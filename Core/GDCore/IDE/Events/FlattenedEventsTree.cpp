@@ -0,0 +1,267 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/FlattenedEventsTree.h"
+
+#include <vector>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+FlattenedEventsTree::FlattenedEventsTree(gd::EventsList& events_)
+    : events(events_) {
+  Update();
+}
+
+void FlattenedEventsTree::Update() {
+  rows.clear();
+  eventsListsParents.clear();
+  eventsListsParents[&events] = nullptr;
+  FlattenEventsList(events, 0, true, rows);
+  UpdateIndexes();
+}
+
+std::size_t FlattenedEventsTree::FlattenEventsList(
+    gd::EventsList& eventsList,
+    std::size_t depth,
+    bool visible,
+    std::vector<Row>& flattenedRows) {
+  std::size_t rowsCount = 0;
+  for (std::size_t i = 0; i < eventsList.size(); ++i) {
+    gd::BaseEvent& event = eventsList[i];
+    std::size_t position = flattenedRows.size();
+    flattenedRows.push_back(
+        Row{&event, &eventsList, depth, event.IsFolded(), visible, 1});
+
+    if (event.CanHaveSubEvents()) {
+      eventsListsParents[&event.GetSubEvents()] = &event;
+      flattenedRows[position].subtreeSize +=
+          FlattenEventsList(event.GetSubEvents(),
+                            depth + 1,
+                            visible && !event.IsFolded(),
+                            flattenedRows);
+    }
+    rowsCount += flattenedRows[position].subtreeSize;
+  }
+
+  return rowsCount;
+}
+
+std::size_t FlattenedEventsTree::GetPositionOf(
+    const gd::BaseEvent& event) const {
+  auto it = positions.find(&event);
+  return it != positions.end() ? it->second : gd::String::npos;
+}
+
+std::size_t FlattenedEventsTree::GetVisibleEventsCount() const {
+  std::size_t count = 0;
+  for (std::size_t i = rows.size(); i > 0; i -= i & (~i + 1))
+    count += visibleCounts[i];
+
+  return count;
+}
+
+std::size_t FlattenedEventsTree::GetPositionOfVisibleEvent(
+    std::size_t visibleIndex) const {
+  // Find the last position before which there are visibleIndex visible events.
+  std::size_t position = 0;
+  std::size_t remainingCount = visibleIndex;
+  std::size_t step = 1;
+  while (step * 2 <= rows.size()) step *= 2;
+  for (; step > 0; step /= 2) {
+    if (position + step <= rows.size() &&
+        visibleCounts[position + step] <= remainingCount) {
+      position += step;
+      remainingCount -= visibleCounts[position];
+    }
+  }
+
+  return position < rows.size() ? position : gd::String::npos;
+}
+
+std::size_t FlattenedEventsTree::GetVisibleIndexAt(std::size_t position) const {
+  if (position >= rows.size() || !rows[position].visible)
+    return gd::String::npos;
+
+  std::size_t count = 0;
+  for (std::size_t i = position; i > 0; i -= i & (~i + 1))
+    count += visibleCounts[i];
+
+  return count;
+}
+
+gd::BaseEvent& FlattenedEventsTree::InsertEvent(const gd::BaseEvent& event,
+                                                gd::EventsList& eventsList,
+                                                std::size_t position) {
+  gd::BaseEvent& insertedEvent = eventsList.InsertEvent(event, position);
+  std::size_t positionInList =
+      position < eventsList.size() ? position : eventsList.size() - 1;
+
+  std::vector<Row> subtreeRows;
+  subtreeRows.push_back(Row{&insertedEvent,
+                            &eventsList,
+                            0,
+                            insertedEvent.IsFolded(),
+                            true,
+                            1});
+  if (insertedEvent.CanHaveSubEvents()) {
+    eventsListsParents[&insertedEvent.GetSubEvents()] = &insertedEvent;
+    subtreeRows[0].subtreeSize += FlattenEventsList(
+        insertedEvent.GetSubEvents(), 1, true, subtreeRows);
+  }
+
+  InsertRows(subtreeRows, eventsList, positionInList);
+  return insertedEvent;
+}
+
+void FlattenedEventsTree::RemoveEvent(gd::EventsList& eventsList,
+                                      std::size_t position) {
+  if (position >= eventsList.size()) return;
+
+  std::size_t flattenedPosition = GetPositionOf(eventsList[position]);
+  if (flattenedPosition != gd::String::npos) {
+    for (const Row& row : RemoveRows(flattenedPosition)) {
+      if (row.event->CanHaveSubEvents())
+        eventsListsParents.erase(&row.event->GetSubEvents());
+    }
+    UpdateIndexes();
+  }
+
+  eventsList.RemoveEvent(position);
+}
+
+bool FlattenedEventsTree::MoveEventToAnotherEventsList(
+    const gd::BaseEvent& eventToMove,
+    gd::EventsList& newEventsList,
+    std::size_t newPosition) {
+  std::size_t flattenedPosition = GetPositionOf(eventToMove);
+  if (flattenedPosition == gd::String::npos) return false;
+
+  gd::EventsList& eventsList = *rows[flattenedPosition].eventsList;
+  if (!eventsList.MoveEventToAnotherEventsList(
+          eventToMove, newEventsList, newPosition))
+    return false;
+
+  std::vector<Row> subtreeRows = RemoveRows(flattenedPosition);
+  UpdateIndexes();
+
+  for (std::size_t i = 0; i < newEventsList.size(); ++i) {
+    if (&newEventsList[i] == &eventToMove) {
+      subtreeRows[0].eventsList = &newEventsList;
+      InsertRows(subtreeRows, newEventsList, i);
+      return true;
+    }
+  }
+
+  return true;
+}
+
+void FlattenedEventsTree::SetFolded(gd::BaseEvent& event, bool folded) {
+  event.SetFolded(folded);
+
+  std::size_t position = GetPositionOf(event);
+  if (position == gd::String::npos) return;
+
+  rows[position].folded = folded;
+  UpdateVisibility(position, rows[position].visible);
+}
+
+void FlattenedEventsTree::UpdateVisibility(std::size_t position,
+                                           bool visible) {
+  Row& row = rows[position];
+  if (row.visible != visible) {
+    row.visible = visible;
+    AddVisibleCount(position, visible ? 1 : -1);
+  }
+
+  bool subEventsVisible = visible && !row.folded;
+  std::size_t end = position + row.subtreeSize;
+  for (std::size_t subEventPosition = position + 1; subEventPosition < end;
+       subEventPosition += rows[subEventPosition].subtreeSize) {
+    UpdateVisibility(subEventPosition, subEventsVisible);
+  }
+}
+
+std::vector<std::size_t> FlattenedEventsTree::GetParentsPositions(
+    const gd::EventsList& eventsList) const {
+  std::vector<std::size_t> parentsPositions;
+  auto it = eventsListsParents.find(&eventsList);
+  while (it != eventsListsParents.end() && it->second) {
+    std::size_t parentPosition = GetPositionOf(*it->second);
+    if (parentPosition == gd::String::npos) break;
+
+    parentsPositions.push_back(parentPosition);
+    it = eventsListsParents.find(rows[parentPosition].eventsList);
+  }
+
+  return parentsPositions;
+}
+
+void FlattenedEventsTree::InsertRows(std::vector<Row>& subtreeRows,
+                                     gd::EventsList& eventsList,
+                                     std::size_t positionInList) {
+  std::vector<std::size_t> parentsPositions = GetParentsPositions(eventsList);
+
+  // Insert before the next event of the list or, if none, after the last sub
+  // event of the parent.
+  std::size_t position = rows.size();
+  if (positionInList + 1 < eventsList.size()) {
+    position = GetPositionOf(eventsList[positionInList + 1]);
+  } else if (!parentsPositions.empty()) {
+    position = parentsPositions[0] + rows[parentsPositions[0]].subtreeSize;
+  }
+
+  std::size_t depth =
+      parentsPositions.empty() ? 0 : rows[parentsPositions[0]].depth + 1;
+  bool visible = parentsPositions.empty() ||
+                 (rows[parentsPositions[0]].visible &&
+                  !rows[parentsPositions[0]].folded);
+
+  std::size_t previousDepth = subtreeRows[0].depth;
+  for (Row& row : subtreeRows) row.depth = row.depth - previousDepth + depth;
+  for (std::size_t parentPosition : parentsPositions)
+    rows[parentPosition].subtreeSize += subtreeRows.size();
+
+  rows.insert(rows.begin() + position, subtreeRows.begin(), subtreeRows.end());
+  UpdateIndexes();
+  UpdateVisibility(position, visible);
+}
+
+std::vector<FlattenedEventsTree::Row> FlattenedEventsTree::RemoveRows(
+    std::size_t position) {
+  std::vector<std::size_t> parentsPositions =
+      GetParentsPositions(*rows[position].eventsList);
+
+  std::size_t end = position + rows[position].subtreeSize;
+  std::vector<Row> removedRows(rows.begin() + position, rows.begin() + end);
+  for (std::size_t parentPosition : parentsPositions)
+    rows[parentPosition].subtreeSize -= removedRows.size();
+
+  rows.erase(rows.begin() + position, rows.begin() + end);
+  return removedRows;
+}
+
+void FlattenedEventsTree::UpdateIndexes() {
+  positions.clear();
+  for (std::size_t i = 0; i < rows.size(); ++i) positions[rows[i].event] = i;
+
+  // Build the Fenwick tree in linear time.
+  visibleCounts.assign(rows.size() + 1, 0);
+  for (std::size_t i = 1; i <= rows.size(); ++i) {
+    visibleCounts[i] += rows[i - 1].visible ? 1 : 0;
+    std::size_t parent = i + (i & (~i + 1));
+    if (parent <= rows.size()) visibleCounts[parent] += visibleCounts[i];
+  }
+}
+
+void FlattenedEventsTree::AddVisibleCount(std::size_t position, int count) {
+  for (std::size_t i = position + 1; i <= rows.size(); i += i & (~i + 1))
+    visibleCounts[i] += count;
+}
+
+}  // namespace gd
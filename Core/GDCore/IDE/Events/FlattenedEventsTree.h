@@ -0,0 +1,219 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_FLATTENEDEVENTSTREE_H
+#define GDCORE_FLATTENEDEVENTSTREE_H
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class EventsList;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A flattened view of a tree of events: all the events, in the order
+ * they are displayed (an event followed by its sub events), with their depth,
+ * folded state and number of sub events.
+ *
+ * Events can be found by their position in the flattened tree, by their
+ * position among the visible events (the ones not inside a folded event) or
+ * from the event itself, without browsing the events. This allows to only
+ * render the events visible on screen when scrolling.
+ *
+ * Events must be inserted, removed, moved and folded using this class, which
+ * updates the events lists and the flattened tree. Call Update if the events
+ * are modified in another way.
+ *
+ * \note Positions in the flattened tree are the ones returned by
+ * gd::EventsPositionFinder.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API FlattenedEventsTree {
+ public:
+  FlattenedEventsTree(gd::EventsList& events_);
+  virtual ~FlattenedEventsTree(){};
+
+  /**
+   * \brief Flatten again all the events.
+   */
+  void Update();
+
+  /** \name Events of the flattened tree
+   */
+  ///@{
+  /**
+   * \brief Return the number of events, including the sub events of folded
+   * events.
+   */
+  std::size_t GetEventsCount() const { return rows.size(); }
+
+  gd::BaseEvent& GetEventAt(std::size_t position) {
+    return *rows[position].event;
+  }
+
+  /**
+   * \brief Return the events list containing the event at the given position.
+   */
+  gd::EventsList& GetEventsListAt(std::size_t position) {
+    return *rows[position].eventsList;
+  }
+
+  /**
+   * \brief Return the depth of the event (0 for events that are not sub
+   * events).
+   */
+  std::size_t GetDepthAt(std::size_t position) const {
+    return rows[position].depth;
+  }
+
+  bool IsFoldedAt(std::size_t position) const { return rows[position].folded; }
+
+  /**
+   * \brief Return true if the event is not inside a folded event.
+   */
+  bool IsVisibleAt(std::size_t position) const {
+    return rows[position].visible;
+  }
+
+  /**
+   * \brief Return the number of events in the subtree of the event (the event
+   * and all its sub events, recursively).
+   */
+  std::size_t GetSubtreeSizeAt(std::size_t position) const {
+    return rows[position].subtreeSize;
+  }
+
+  /**
+   * \brief Return the position of the event in the flattened tree, or
+   * gd::String::npos if the event is not in the tree.
+   */
+  std::size_t GetPositionOf(const gd::BaseEvent& event) const;
+  ///@}
+
+  /** \name Visible events
+   */
+  ///@{
+  std::size_t GetVisibleEventsCount() const;
+
+  /**
+   * \brief Return the position in the flattened tree of the visible event
+   * having the given index (0 for the first visible event), or
+   * gd::String::npos if there is no such event.
+   */
+  std::size_t GetPositionOfVisibleEvent(std::size_t visibleIndex) const;
+
+  /**
+   * \brief Return the index among the visible events of the event at the given
+   * position, or gd::String::npos if the event is not visible.
+   */
+  std::size_t GetVisibleIndexAt(std::size_t position) const;
+  ///@}
+
+  /** \name Modifications
+   */
+  ///@{
+  /**
+   * \brief Insert a copy of the event in the events list, which must be in
+   * the tree.
+   */
+  gd::BaseEvent& InsertEvent(const gd::BaseEvent& event,
+                             gd::EventsList& eventsList,
+                             std::size_t position);
+
+  /**
+   * \brief Remove the event at the given position of the events list, which
+   * must be in the tree.
+   */
+  void RemoveEvent(gd::EventsList& eventsList, std::size_t position);
+
+  /**
+   * \brief Move an event to a position in another (or the same) events list,
+   * without invalidating it.
+   *
+   * \see gd::EventsList::MoveEventToAnotherEventsList
+   */
+  bool MoveEventToAnotherEventsList(const gd::BaseEvent& eventToMove,
+                                    gd::EventsList& newEventsList,
+                                    std::size_t newPosition);
+
+  /**
+   * \brief Fold or unfold the event, hiding or showing its sub events.
+   */
+  void SetFolded(gd::BaseEvent& event, bool folded);
+  ///@}
+
+ private:
+  struct Row {
+    gd::BaseEvent* event;
+    gd::EventsList* eventsList;  ///< The list containing the event.
+    std::size_t depth;
+    bool folded;
+    bool visible;
+    std::size_t subtreeSize;
+  };
+
+  /**
+   * \brief Add the rows of the events of the list (and their sub events).
+   * \return The number of rows added.
+   */
+  std::size_t FlattenEventsList(gd::EventsList& eventsList,
+                                std::size_t depth,
+                                bool visible,
+                                std::vector<Row>& flattenedRows);
+
+  /**
+   * \brief Set the visibility of the event at the given position, and update
+   * the one of its sub events.
+   */
+  void UpdateVisibility(std::size_t position, bool visible);
+
+  /**
+   * \brief Return the positions of the events containing the events list,
+   * from the innermost to the outermost.
+   */
+  std::vector<std::size_t> GetParentsPositions(
+      const gd::EventsList& eventsList) const;
+
+  /**
+   * \brief Insert the rows of an event and its sub events in the events list,
+   * before the next event of the list.
+   */
+  void InsertRows(std::vector<Row>& subtreeRows,
+                  gd::EventsList& eventsList,
+                  std::size_t positionInList);
+
+  /**
+   * \brief Remove the rows of the event at the given position and its sub
+   * events.
+   */
+  std::vector<Row> RemoveRows(std::size_t position);
+
+  /**
+   * \brief Update the positions of events and the counts of visible events
+   * after rows were inserted or removed.
+   */
+  void UpdateIndexes();
+
+  void AddVisibleCount(std::size_t position, int count);
+
+  gd::EventsList& events;
+  std::vector<Row> rows;
+  std::unordered_map<const gd::BaseEvent*, std::size_t> positions;
+  std::unordered_map<const gd::EventsList*, const gd::BaseEvent*>
+      eventsListsParents;  ///< The event containing each events list (nullptr
+                           ///< for the root list).
+  std::vector<std::size_t>
+      visibleCounts;  ///< A Fenwick tree of the visible rows, to find visible
+                      ///< events in logarithmic time.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_FLATTENEDEVENTSTREE_H
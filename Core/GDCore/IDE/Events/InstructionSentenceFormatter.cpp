@@ -23,10 +23,82 @@ namespace gd {
 
 InstructionSentenceFormatter *InstructionSentenceFormatter::_singleton = NULL;
 
+const std::size_t InstructionSentenceFormatter::maxFormattedTextsCount = 10000;
+
 std::vector<std::pair<gd::String, gd::TextFormatting> >
 InstructionSentenceFormatter::GetAsFormattedText(
     const Instruction &instr, const gd::InstructionMetadata &metadata) {
+  // The lock is only held to read or update the caches, so that other
+  // threads can format sentences meanwhile.
+  std::shared_ptr<const SentenceTemplate> sentenceTemplate;
+  std::size_t generation;
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    sentenceTemplate = GetSentenceTemplate(metadata);
+    generation = cacheGeneration;
+  }
+
+  std::vector<gd::String> parametersValues;
+  for (const SentencePart &part : *sentenceTemplate) {
+    if (part.parameterIndex != gd::String::npos)
+      parametersValues.push_back(
+          instr.GetParameter(part.parameterIndex).GetPlainString());
+  }
+
+  auto key =
+      std::make_pair(sentenceTemplate.get(), std::move(parametersValues));
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = formattedTexts.find(key);
+    if (it != formattedTexts.end()) return it->second;
+  }
+
   std::vector<std::pair<gd::String, gd::TextFormatting> > formattedStr;
+  std::size_t parameterValueIndex = 0;
+  for (const SentencePart &part : *sentenceTemplate) {
+    TextFormatting format;
+    if (part.parameterIndex == gd::String::npos) {
+      formattedStr.push_back(std::make_pair(part.text, format));
+      continue;
+    }
+
+    // Add the parameter
+    format.userData = part.parameterIndex;
+
+    gd::String text = key.second[parameterValueIndex++];
+    std::replace(text.Raw().begin(),
+                 text.Raw().end(),
+                 '\n',
+                 ' ');  // Using the raw std::string inside gd::String (no
+                        // problems because it's only ANSI characters)
+
+    formattedStr.push_back(std::make_pair(text, format));
+  }
+
+  // Formatted sentences are only kept for the instructions being displayed.
+  // They are not kept if the caches were cleared meanwhile, as the template
+  // could have been destroyed (and its address reused).
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  if (generation == cacheGeneration) {
+    if (formattedTexts.size() >= maxFormattedTextsCount)
+      formattedTexts.clear();
+    formattedTexts[std::move(key)] = formattedStr;
+  }
+
+  return formattedStr;
+}
+
+std::shared_ptr<const InstructionSentenceFormatter::SentenceTemplate>
+InstructionSentenceFormatter::GetSentenceTemplate(
+    const gd::InstructionMetadata &metadata) {
+  auto key = std::make_pair(metadata.GetSentence(), metadata.parameters.size());
+  auto it = sentenceTemplates.find(key);
+  if (it != sentenceTemplates.end()) return it->second;
+
+  std::shared_ptr<SentenceTemplate> sentenceTemplatePtr =
+      std::make_shared<SentenceTemplate>();
+  SentenceTemplate &sentenceTemplate = *sentenceTemplatePtr;
+  sentenceTemplates[key] = sentenceTemplatePtr;
 
   gd::String sentence = metadata.GetSentence();
   std::replace(sentence.Raw().begin(), sentence.Raw().end(), '\n', ' ');
@@ -53,40 +125,29 @@ InstructionSentenceFormatter::GetAsFormattedText(
       }
     }
 
-    // When a parameter is found, complete formatted gd::String.
+    // When a parameter is found, complete the template.
     if (parse) {
       if (firstParamPosition !=
           0)  // Add constant text before the parameter if any
       {
-        TextFormatting format;
-        formattedStr.push_back(
-            std::make_pair(sentence.substr(0, firstParamPosition), format));
+        sentenceTemplate.push_back(SentencePart{
+            sentence.substr(0, firstParamPosition), gd::String::npos});
       }
 
       // Add the parameter
-      TextFormatting format;
-      format.userData = firstParamIndex;
+      sentenceTemplate.push_back(SentencePart{"", firstParamIndex});
 
-      gd::String text = instr.GetParameter(firstParamIndex).GetPlainString();
-      std::replace(text.Raw().begin(),
-                   text.Raw().end(),
-                   '\n',
-                   ' ');  // Using the raw std::string inside gd::String (no
-                          // problems because it's only ANSI characters)
-
-      formattedStr.push_back(std::make_pair(text, format));
       gd::String placeholder =
           "_PARAM" + gd::String::From(firstParamIndex) + "_";
       sentence = sentence.substr(firstParamPosition + placeholder.length());
     } else if (!sentence.empty())  // No more parameter found: Add the end of
                                    // the sentence
     {
-      TextFormatting format;
-      formattedStr.push_back(std::make_pair(sentence, format));
+      sentenceTemplate.push_back(SentencePart{sentence, gd::String::npos});
     }
   }
 
-  return formattedStr;
+  return sentenceTemplatePtr;
 }
 
 gd::String InstructionSentenceFormatter::GetFullText(
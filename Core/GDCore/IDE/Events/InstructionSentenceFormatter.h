@@ -7,6 +7,8 @@
 #ifndef TRANSLATEACTION_H
 #define TRANSLATEACTION_H
 #include <map>
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 #include "GDCore/String.h"
@@ -21,6 +23,11 @@ namespace gd {
 /**
  * \brief Generate user friendly sentences and information from an action or
  * condition metadata.
+ *
+ * Sentences of the metadata are split into texts and parameters only once,
+ * and the formatted sentences are kept for the instructions having the same
+ * sentence and parameters, so that events sheets can be rendered again
+ * without doing the replacements again.
  */
 class GD_CORE_API InstructionSentenceFormatter {
  public:
@@ -41,6 +48,16 @@ class GD_CORE_API InstructionSentenceFormatter {
   gd::String GetFullText(const gd::Instruction &instr,
                          const gd::InstructionMetadata &metadata);
 
+  /**
+   * \brief Forget the sentences that were split and formatted.
+   */
+  void ClearCache() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    formattedTexts.clear();
+    sentenceTemplates.clear();
+    cacheGeneration++;
+  }
+
   static void DestroySingleton() {
     if (NULL != _singleton) {
       delete _singleton;
@@ -53,6 +70,40 @@ class GD_CORE_API InstructionSentenceFormatter {
  private:
   InstructionSentenceFormatter(){};
   static InstructionSentenceFormatter *_singleton;
+
+  /**
+   * \brief A part of a sentence: a text, or the index of the parameter to be
+   * displayed.
+   */
+  struct SentencePart {
+    gd::String text;
+    std::size_t parameterIndex;  ///< gd::String::npos for a text.
+  };
+  typedef std::vector<SentencePart> SentenceTemplate;
+
+  /**
+   * \brief Return the template of the sentence of the metadata, creating it
+   * if needed.
+   * \note cacheMutex must be locked by the caller.
+   */
+  std::shared_ptr<const SentenceTemplate> GetSentenceTemplate(
+      const gd::InstructionMetadata &metadata);
+
+  std::map<std::pair<gd::String, std::size_t>,
+           std::shared_ptr<const SentenceTemplate> >
+      sentenceTemplates;  ///< The templates, by sentence and number of
+                          ///< parameters. Shared so that they can be used
+                          ///< without the lock, even if the cache is cleared.
+  std::map<std::pair<const SentenceTemplate *, std::vector<gd::String> >,
+           std::vector<std::pair<gd::String, gd::TextFormatting> > >
+      formattedTexts;  ///< The formatted sentences, by template and values of
+                       ///< the displayed parameters.
+  static const std::size_t maxFormattedTextsCount;
+  std::size_t cacheGeneration = 0;  ///< Incremented when the caches are
+                                    ///< cleared.
+  std::mutex cacheMutex;  ///< Protect the caches, so that sentences can be
+                          ///< formatted from several threads. Only held to
+                          ///< read or update the caches.
 };
 
 }  // namespace gd
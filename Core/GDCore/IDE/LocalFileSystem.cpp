@@ -0,0 +1,527 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if !defined(EMSCRIPTEN)
+#include "GDCore/IDE/LocalFileSystem.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <system_error>
+#include <thread>
+
+#if defined(WINDOWS)
+#include <direct.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+namespace {
+#if defined(WINDOWS)
+typedef struct _stat64 FileStatus;
+int GetFileStatus(const gd::String& path, FileStatus* status) {
+  return _wstat64(path.ToWide().c_str(), status);
+}
+int MakeDirectory(const gd::String& path) {
+  return _wmkdir(path.ToWide().c_str());
+}
+int RemoveEmptyDirectory(const gd::String& path) {
+  return _wrmdir(path.ToWide().c_str());
+}
+int RemoveFileAt(const gd::String& path) {
+  return _wremove(path.ToWide().c_str());
+}
+FILE* OpenFile(const gd::String& path, const char* mode) {
+  return _wfopen(path.ToWide().c_str(), gd::String(mode).ToWide().c_str());
+}
+#else
+typedef struct stat FileStatus;
+int GetFileStatus(const gd::String& path, FileStatus* status) {
+  return stat(path.ToLocale().c_str(), status);
+}
+int MakeDirectory(const gd::String& path) {
+  return mkdir(path.ToLocale().c_str(), 0755);
+}
+int RemoveEmptyDirectory(const gd::String& path) {
+  return rmdir(path.ToLocale().c_str());
+}
+int RemoveFileAt(const gd::String& path) {
+  return remove(path.ToLocale().c_str());
+}
+FILE* OpenFile(const gd::String& path, const char* mode) {
+  return fopen(path.ToLocale().c_str(), mode);
+}
+#endif
+
+/**
+ * \brief Return the names of the entries of a directory (without "." and
+ * "..").
+ */
+std::vector<gd::String> ReadDirectoryEntries(const gd::String& path) {
+  std::vector<gd::String> entries;
+#if defined(WINDOWS)
+  _WDIR* directory = _wopendir(path.ToWide().c_str());
+  if (!directory) return entries;
+  while (struct _wdirent* entry = _wreaddir(directory)) {
+    gd::String name = gd::String::FromWide(entry->d_name);
+    if (name != "." && name != "..") entries.push_back(name);
+  }
+  _wclosedir(directory);
+#else
+  DIR* directory = opendir(path.ToLocale().c_str());
+  if (!directory) return entries;
+  while (struct dirent* entry = readdir(directory)) {
+    gd::String name = gd::String::FromLocale(entry->d_name);
+    if (name != "." && name != "..") entries.push_back(name);
+  }
+  closedir(directory);
+#endif
+  return entries;
+}
+
+bool IsDirectory(const gd::String& path) {
+  FileStatus status;
+  return GetFileStatus(path, &status) == 0 && S_ISDIR(status.st_mode);
+}
+
+bool IsSeparator(char32_t character) {
+  return character == U'/' || character == U'\\';
+}
+
+/**
+ * \brief Return the root of an absolute path ("/", or "C:/" on Windows), or an
+ * empty string if the path is not absolute.
+ */
+gd::String GetRoot(const gd::String& path) {
+  if (!path.empty() && IsSeparator(path[0])) return "/";
+#if defined(WINDOWS)
+  if (path.size() > 1 && path[1] == U':' &&
+      ((path[0] >= U'a' && path[0] <= U'z') ||
+       (path[0] >= U'A' && path[0] <= U'Z')))
+    return path.substr(0, 2) + "/";
+#endif
+
+  return "";
+}
+
+/**
+ * \brief Split a path into its components, resolving "." and "..".
+ */
+std::vector<gd::String> GetPathComponents(const gd::String& path) {
+  std::vector<gd::String> components;
+  for (auto& component : AbstractFileSystem::NormalizeSeparator(
+                             path.substr(GetRoot(path).size()))
+                             .Split(U'/')) {
+    if (component.empty() || component == ".") continue;
+    if (component == ".." && !components.empty() &&
+        components.back() != "..")
+      components.pop_back();
+    else
+      components.push_back(component);
+  }
+
+  return components;
+}
+
+gd::String JoinPathComponents(const gd::String& root,
+                              const std::vector<gd::String>& components) {
+  gd::String path = root;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    if (i != 0) path += "/";
+    path += components[i];
+  }
+
+  return path;
+}
+
+gd::String NormalizePath(const gd::String& path) {
+  return JoinPathComponents(GetRoot(path), GetPathComponents(path));
+}
+
+gd::String GetEntryPath(const gd::String& directory, const gd::String& name) {
+  return directory.empty() || IsSeparator(directory[directory.size() - 1])
+             ? directory + name
+             : directory + "/" + name;
+}
+
+/**
+ * \brief Remove the files of a directory (given as a normalized path), except
+ * the kept ones, and the directories left empty.
+ */
+bool ClearDirectoryExcept(const gd::String& directory,
+                          const std::set<gd::String>& keptFiles) {
+  bool succeeded = true;
+  for (auto& name : ReadDirectoryEntries(directory)) {
+    gd::String path = GetEntryPath(directory, name);
+    if (IsDirectory(path)) {
+      succeeded = ClearDirectoryExcept(path, keptFiles) && succeeded;
+      if (ReadDirectoryEntries(path).empty())
+        succeeded = RemoveEmptyDirectory(path) == 0 && succeeded;
+    } else if (keptFiles.find(path) == keptFiles.end()) {
+      succeeded = RemoveFileAt(path) == 0 && succeeded;
+    }
+  }
+
+  return succeeded;
+}
+
+gd::String GetErrorMessage(const gd::String& operation, int errorNumber) {
+  return operation + ": " + gd::String::FromLocale(std::strerror(errorNumber));
+}
+
+/**
+ * \brief Copy the content of a file, returning an error message if the copy
+ * failed.
+ */
+bool CopyFileContent(const gd::String& file,
+                     const gd::String& destination,
+                     gd::String& errorMessage) {
+  FILE* input = OpenFile(file, "rb");
+  if (!input) {
+    errorMessage = GetErrorMessage("Unable to open the file", errno);
+    return false;
+  }
+  FILE* output = OpenFile(destination, "wb");
+  if (!output) {
+    errorMessage = GetErrorMessage("Unable to create the destination", errno);
+    fclose(input);
+    return false;
+  }
+
+  bool succeeded = true;
+  char buffer[64 * 1024];
+  std::size_t readSize;
+  while ((readSize = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+    if (fwrite(buffer, 1, readSize, output) != readSize) {
+      errorMessage = GetErrorMessage("Unable to write the destination", errno);
+      succeeded = false;
+      break;
+    }
+  }
+  if (succeeded && ferror(input)) {
+    errorMessage = GetErrorMessage("Unable to read the file", errno);
+    succeeded = false;
+  }
+
+  fclose(input);
+  if (fclose(output) != 0 && succeeded) {
+    errorMessage = GetErrorMessage("Unable to write the destination", errno);
+    succeeded = false;
+  }
+  return succeeded;
+}
+
+/**
+ * \brief Join the threads when destroyed, so that threads are joined even if
+ * an exception is thrown (destroying a joinable std::thread terminates the
+ * program).
+ */
+class ThreadsJoiner {
+ public:
+  ThreadsJoiner(std::vector<std::thread>& threads_) : threads(threads_){};
+  ~ThreadsJoiner() {
+    for (auto& thread : threads)
+      if (thread.joinable()) thread.join();
+  }
+
+ private:
+  std::vector<std::thread>& threads;
+};
+
+bool WriteFileContent(const gd::String& file,
+                      const gd::String& content,
+                      const char* mode) {
+  FILE* output = OpenFile(file, mode);
+  if (!output) return false;
+
+  const std::string& rawContent = content.Raw();
+  bool succeeded = fwrite(rawContent.data(), 1, rawContent.size(), output) ==
+                   rawContent.size();
+  return fclose(output) == 0 && succeeded;
+}
+}  // namespace
+
+LocalFileSystem::LocalFileSystem()
+    : maxConcurrentCopies(std::max(1u, std::thread::hardware_concurrency())) {}
+
+LocalFileSystem::~LocalFileSystem() {}
+
+void LocalFileSystem::MkDir(const gd::String& path) {
+  gd::String root = GetRoot(path);
+  gd::String directory = root;
+  for (auto& component : GetPathComponents(path)) {
+    if (!directory.empty() && directory != root) directory += "/";
+    directory += component;
+    if (!IsDirectory(directory)) MakeDirectory(directory);
+  }
+}
+
+bool LocalFileSystem::DirExists(const gd::String& path) {
+  return IsDirectory(path);
+}
+
+bool LocalFileSystem::FileExists(const gd::String& path) {
+  FileStatus status;
+  return GetFileStatus(path, &status) == 0 && S_ISREG(status.st_mode);
+}
+
+bool LocalFileSystem::ClearDir(const gd::String& directory) {
+  bool succeeded = true;
+  for (auto& name : ReadDirectoryEntries(directory)) {
+    gd::String path = directory + "/" + name;
+    if (IsDirectory(path)) {
+      succeeded =
+          ClearDir(path) && RemoveEmptyDirectory(path) == 0 && succeeded;
+    } else {
+      succeeded = RemoveFileAt(path) == 0 && succeeded;
+    }
+  }
+
+  return succeeded;
+}
+
+bool LocalFileSystem::ClearDirExcept(
+    const gd::String& directory, const std::vector<gd::String>& filesToKeep) {
+  std::set<gd::String> keptFiles;
+  for (auto& file : filesToKeep) keptFiles.insert(NormalizePath(file));
+
+  return ClearDirectoryExcept(NormalizePath(directory), keptFiles);
+}
+
+gd::String LocalFileSystem::GetTempDir() {
+  for (const char* variable : {"TMPDIR", "TEMP", "TMP"}) {
+    const char* value = std::getenv(variable);
+    if (value && value[0] != '\0')
+      return NormalizeSeparator(gd::String::FromLocale(value));
+  }
+
+  return "/tmp";
+}
+
+gd::String LocalFileSystem::FileNameFrom(const gd::String& file) {
+  gd::String normalizedFile = NormalizeSeparator(file);
+  std::size_t lastSeparator = normalizedFile.rfind("/");
+  return lastSeparator != gd::String::npos
+             ? normalizedFile.substr(lastSeparator + 1)
+             : normalizedFile;
+}
+
+gd::String LocalFileSystem::DirNameFrom(const gd::String& file) {
+  gd::String normalizedFile = NormalizeSeparator(file);
+  std::size_t lastSeparator = normalizedFile.rfind("/");
+  if (lastSeparator == gd::String::npos) return "";
+  if (lastSeparator == 0) return "/";
+
+  return normalizedFile.substr(0, lastSeparator);
+}
+
+bool LocalFileSystem::MakeAbsolute(gd::String& filename,
+                                   const gd::String& baseDirectory) {
+  if (IsAbsolute(filename)) {
+    filename = JoinPathComponents(GetRoot(filename),
+                                  GetPathComponents(filename));
+    return true;
+  }
+
+  gd::String absoluteBaseDirectory = baseDirectory;
+  if (!IsAbsolute(absoluteBaseDirectory)) {
+    char currentDirectory[4096];
+    if (!getcwd(currentDirectory, sizeof(currentDirectory))) return false;
+    MakeAbsolute(absoluteBaseDirectory,
+                 NormalizeSeparator(gd::String::FromLocale(currentDirectory)));
+  }
+
+  filename = JoinPathComponents(
+      GetRoot(absoluteBaseDirectory),
+      GetPathComponents(absoluteBaseDirectory + "/" + filename));
+  return true;
+}
+
+bool LocalFileSystem::IsAbsolute(const gd::String& filename) {
+  return !GetRoot(filename).empty();
+}
+
+bool LocalFileSystem::MakeRelative(gd::String& filename,
+                                   const gd::String& baseDirectory) {
+  gd::String absoluteFilename = filename;
+  gd::String absoluteBaseDirectory = baseDirectory;
+  if (!MakeAbsolute(absoluteFilename, "") ||
+      !MakeAbsolute(absoluteBaseDirectory, ""))
+    return false;
+  if (GetRoot(absoluteFilename) != GetRoot(absoluteBaseDirectory))
+    return false;
+
+  std::vector<gd::String> fileComponents = GetPathComponents(absoluteFilename);
+  std::vector<gd::String> baseComponents =
+      GetPathComponents(absoluteBaseDirectory);
+  std::size_t commonCount = 0;
+  while (commonCount < fileComponents.size() &&
+         commonCount < baseComponents.size() &&
+         fileComponents[commonCount] == baseComponents[commonCount])
+    commonCount++;
+
+  std::vector<gd::String> relativeComponents;
+  for (std::size_t i = commonCount; i < baseComponents.size(); ++i)
+    relativeComponents.push_back("..");
+  for (std::size_t i = commonCount; i < fileComponents.size(); ++i)
+    relativeComponents.push_back(fileComponents[i]);
+
+  filename = JoinPathComponents("", relativeComponents);
+  return true;
+}
+
+bool LocalFileSystem::CopyFile(const gd::String& file,
+                               const gd::String& destination) {
+  gd::String errorMessage;
+  return CopyFileContent(file, destination, errorMessage);
+}
+
+std::vector<AbstractFileSystem::FileCopyError> LocalFileSystem::CopyFiles(
+    const std::vector<FileCopy>& copies) {
+  std::set<gd::String> directories;
+  for (auto& copy : copies) directories.insert(DirNameFrom(copy.destination));
+  for (auto& directory : directories) {
+    if (!IsDirectory(directory)) MkDir(directory);
+  }
+
+  // Each worker takes the next file to be copied until all files are copied.
+  std::vector<FileCopyError> errors;
+  std::mutex errorsMutex;
+  std::atomic<std::size_t> nextCopyIndex(0);
+  auto copyFiles = [&copies, &errors, &errorsMutex, &nextCopyIndex]() {
+    std::size_t copyIndex;
+    while ((copyIndex = nextCopyIndex++) < copies.size()) {
+      const FileCopy& copy = copies[copyIndex];
+      gd::String errorMessage;
+      if (!CopyFileContent(copy.file, copy.destination, errorMessage)) {
+        FileCopyError error;
+        error.file = copy.file;
+        error.destination = copy.destination;
+        error.message = errorMessage;
+
+        std::lock_guard<std::mutex> lock(errorsMutex);
+        errors.push_back(error);
+      }
+    }
+  };
+
+  std::size_t workersCount = std::min(maxConcurrentCopies, copies.size());
+  std::vector<std::thread> workers;
+  {
+    ThreadsJoiner workersJoiner(workers);
+    for (std::size_t i = 1; i < workersCount; ++i) {
+      try {
+        workers.push_back(std::thread(copyFiles));
+      } catch (const std::system_error&) {
+        break;  // Copy the files with the workers already started.
+      }
+    }
+    copyFiles();
+  }
+
+  return errors;
+}
+
+bool LocalFileSystem::WriteToFile(const gd::String& file,
+                                  const gd::String& content) {
+  return WriteFileContent(file, content, "wb");
+}
+
+bool LocalFileSystem::AppendToFile(const gd::String& file,
+                                   const gd::String& content) {
+  return WriteFileContent(file, content, "ab");
+}
+
+bool LocalFileSystem::RemoveFile(const gd::String& file) {
+  return RemoveFileAt(file) == 0;
+}
+
+gd::String LocalFileSystem::ReadFile(const gd::String& file) {
+  FILE* input = OpenFile(file, "rb");
+  if (!input) return "";
+
+  std::string content;
+  char buffer[64 * 1024];
+  std::size_t readSize;
+  while ((readSize = fread(buffer, 1, sizeof(buffer), input)) > 0)
+    content.append(buffer, readSize);
+  fclose(input);
+
+  return gd::String::FromUTF8(content);
+}
+
+std::vector<gd::String> LocalFileSystem::ReadDir(const gd::String& path,
+                                                 const gd::String& extension) {
+  gd::String upperCaseExtension = extension.UpperCase();
+  std::vector<gd::String> files;
+  for (auto& name : ReadDirectoryEntries(path)) {
+    gd::String upperCaseName = name.UpperCase();
+    if (upperCaseName.size() >= upperCaseExtension.size() &&
+        upperCaseName.substr(upperCaseName.size() -
+                             upperCaseExtension.size()) == upperCaseExtension)
+      files.push_back(path + "/" + name);
+  }
+
+  return files;
+}
+
+bool LocalFileSystem::GetFileStats(const gd::String& file,
+                                   double& size,
+                                   double& modificationTime) {
+  FileStatus status;
+  if (GetFileStatus(file, &status) != 0 || !S_ISREG(status.st_mode))
+    return false;
+
+  size = status.st_size;
+#if defined(LINUX)
+  modificationTime = status.st_mtim.tv_sec * 1000.0 +
+                     status.st_mtim.tv_nsec / 1000000.0;
+#else
+  modificationTime = status.st_mtime * 1000.0;
+#endif
+  return true;
+}
+
+gd::String LocalFileSystem::GetFileHash(const gd::String& file) {
+  FILE* input = OpenFile(file, "rb");
+  if (!input) return "";
+
+  std::uint64_t hash = 14695981039346656037ULL;
+  unsigned char buffer[64 * 1024];
+  std::size_t readSize;
+  while ((readSize = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+    for (std::size_t i = 0; i < readSize; ++i) {
+      hash ^= buffer[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  bool succeeded = !ferror(input);
+  fclose(input);
+  if (!succeeded) return "";
+
+  char hexadecimalHash[17];
+  snprintf(hexadecimalHash,
+           sizeof(hexadecimalHash),
+           "%016llx",
+           (unsigned long long)hash);
+  return hexadecimalHash;
+}
+
+}  // namespace gd
+#endif
@@ -0,0 +1,103 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if !defined(EMSCRIPTEN)
+#ifndef GDCORE_LOCALFILESYSTEM_H
+#define GDCORE_LOCALFILESYSTEM_H
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An implementation of gd::AbstractFileSystem using the files of the
+ * local disk, for native builds.
+ *
+ * Batches of files passed to CopyFiles can be copied concurrently by a bounded
+ * pool of threads (see SetMaxConcurrentCopies), which can help when each copy
+ * has a high latency (like on network shares).
+ *
+ * \note Not available in the web (Emscripten) build, where the file system is
+ * provided by JavaScript (see AbstractFileSystemJS).
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API LocalFileSystem : public AbstractFileSystem {
+ public:
+  LocalFileSystem();
+  virtual ~LocalFileSystem();
+
+  virtual void MkDir(const gd::String& path) override;
+  virtual bool DirExists(const gd::String& path) override;
+  virtual bool FileExists(const gd::String& path) override;
+  virtual bool ClearDir(const gd::String& directory) override;
+  virtual bool ClearDirExcept(
+      const gd::String& directory,
+      const std::vector<gd::String>& filesToKeep) override;
+  virtual gd::String GetTempDir() override;
+  virtual gd::String FileNameFrom(const gd::String& file) override;
+  virtual gd::String DirNameFrom(const gd::String& file) override;
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) override;
+  virtual bool IsAbsolute(const gd::String& filename) override;
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) override;
+  virtual bool CopyFile(const gd::String& file,
+                        const gd::String& destination) override;
+  virtual bool WriteToFile(const gd::String& file,
+                           const gd::String& content) override;
+  virtual bool AppendToFile(const gd::String& file,
+                            const gd::String& content) override;
+  virtual bool RemoveFile(const gd::String& file) override;
+  virtual gd::String ReadFile(const gd::String& file) override;
+  virtual std::vector<gd::String> ReadDir(
+      const gd::String& path, const gd::String& extension = "") override;
+  virtual bool GetFileStats(const gd::String& file,
+                            double& size,
+                            double& modificationTime) override;
+
+  /**
+   * \brief Return a hash (64 bits FNV-1a, in hexadecimal) of the content of
+   * the file.
+   */
+  virtual gd::String GetFileHash(const gd::String& file) override;
+
+  /**
+   * \brief Copy the files, with a pool of threads if more than one concurrent
+   * copy is allowed, after creating all the destination directories (once per
+   * directory).
+   */
+  virtual std::vector<FileCopyError> CopyFiles(
+      const std::vector<FileCopy>& copies) override;
+
+  /**
+   * \brief Set the maximum number of files copied at the same time by
+   * CopyFiles (by default, the number of threads supported by the hardware).
+   *
+   * \note Copying small files concurrently on a fast local disk can be slower
+   * (see the "LocalFileSystem - Benchmarks" test): set it to 1 to copy files
+   * one after the other.
+   */
+  LocalFileSystem& SetMaxConcurrentCopies(std::size_t count) {
+    maxConcurrentCopies = count > 0 ? count : 1;
+    return *this;
+  }
+
+  /**
+   * \brief Return the maximum number of files copied at the same time by
+   * CopyFiles.
+   */
+  std::size_t GetMaxConcurrentCopies() const { return maxConcurrentCopies; }
+
+ private:
+  std::size_t maxConcurrentCopies;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_LOCALFILESYSTEM_H
+#endif
@@ -7,6 +7,7 @@
 
 #include "ArbitraryResourceWorker.h"
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -104,15 +105,26 @@ ArbitraryResourceWorker::~ArbitraryResourceWorker() {}
 
 /**
  * Launch the specified resource worker on every resource referenced in the
- * events.
+ * events, without modifying them: the parameters updated by the worker are
+ * stored, to be applied by InstructionsParametersUpdater.
  */
 class ResourceWorkerInEventsWorker : public ArbitraryEventsWorker {
  public:
   ResourceWorkerInEventsWorker(const gd::Project& project_,
                                gd::ArbitraryResourceWorker& worker_)
-      : project(project_), worker(worker_){};
+      : project(project_), worker(worker_), instructionPosition(0){};
   virtual ~ResourceWorkerInEventsWorker() {};
 
+  /**
+   * \brief Return the parameters updated by the worker, by position of the
+   * instruction (in the order instructions are visited) and then by index of
+   * the parameter.
+   */
+  const std::map<std::size_t, std::map<std::size_t, gd::String>>&
+  GetUpdatedParameters() const {
+    return updatedParameters;
+  }
+
  private:
   bool DoVisitInstruction(gd::Instruction& instruction, bool isCondition) {
     const auto& platform = project.GetCurrentPlatform();
@@ -125,44 +137,90 @@ class ResourceWorkerInEventsWorker : public ArbitraryEventsWorker {
     gd::ParameterMetadataTools::IterateOverParametersWithIndex(
         instruction.GetParameters(),
         metadata.GetParameters(),
-        [this, &instruction](const gd::ParameterMetadata& parameterMetadata,
-                             const gd::String& parameterValue,
-                             size_t parameterIndex,
-                             const gd::String& lastObjectName) {
+        [this](const gd::ParameterMetadata& parameterMetadata,
+               const gd::String& parameterValue,
+               size_t parameterIndex,
+               const gd::String& lastObjectName) {
+          gd::String updatedParameterValue = parameterValue;
           if (parameterMetadata.GetType() ==
               "police") {  // Should be renamed fontResource
-            gd::String updatedParameterValue = parameterValue;
             worker.ExposeFont(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
           } else if (parameterMetadata.GetType() == "soundfile" ||
                      parameterMetadata.GetType() ==
                          "musicfile") {  // Should be renamed audioResource
-            gd::String updatedParameterValue = parameterValue;
             worker.ExposeAudio(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
           } else if (parameterMetadata.GetType() == "bitmapFontResource") {
-            gd::String updatedParameterValue = parameterValue;
             worker.ExposeBitmapFont(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
           } else if (parameterMetadata.GetType() == "imageResource") {
-            gd::String updatedParameterValue = parameterValue;
             worker.ExposeImage(updatedParameterValue);
-            instruction.SetParameter(parameterIndex, updatedParameterValue);
           }
+
+          if (updatedParameterValue != parameterValue)
+            updatedParameters[instructionPosition][parameterIndex] =
+                updatedParameterValue;
         });
 
+    instructionPosition++;
     return false;
   };
 
   const gd::Project& project;
   gd::ArbitraryResourceWorker& worker;
+  std::size_t instructionPosition;
+  std::map<std::size_t, std::map<std::size_t, gd::String>> updatedParameters;
+};
+
+/**
+ * Apply the parameters updated by a ResourceWorkerInEventsWorker, to the same
+ * events (or a copy of them).
+ */
+class InstructionsParametersUpdater : public ArbitraryEventsWorker {
+ public:
+  InstructionsParametersUpdater(
+      const std::map<std::size_t, std::map<std::size_t, gd::String>>&
+          updatedParameters_)
+      : updatedParameters(updatedParameters_), instructionPosition(0){};
+  virtual ~InstructionsParametersUpdater() {};
+
+ private:
+  bool DoVisitInstruction(gd::Instruction& instruction, bool isCondition) {
+    auto it = updatedParameters.find(instructionPosition++);
+    if (it != updatedParameters.end()) {
+      for (auto& parameter : it->second)
+        instruction.SetParameter(parameter.first, parameter.second);
+    }
+
+    return false;
+  };
+
+  const std::map<std::size_t, std::map<std::size_t, gd::String>>&
+      updatedParameters;
+  std::size_t instructionPosition;
 };
 
 void LaunchResourceWorkerOnEvents(const gd::Project& project,
                                   gd::EventsList& events,
                                   gd::ArbitraryResourceWorker& worker) {
+  LaunchResourceWorkerOnEvents(
+      project, events, worker, [&events]() -> gd::EventsList& {
+        return events;
+      });
+}
+
+void LaunchResourceWorkerOnEvents(
+    const gd::Project& project,
+    const gd::EventsList& events,
+    gd::ArbitraryResourceWorker& worker,
+    const std::function<gd::EventsList&()>& getEventsToUpdate) {
+  // The events are only browsed: ResourceWorkerInEventsWorker does not modify
+  // them.
   ResourceWorkerInEventsWorker eventsWorker(project, worker);
-  eventsWorker.Launch(events);
+  eventsWorker.Launch(const_cast<gd::EventsList&>(events));
+  if (eventsWorker.GetUpdatedParameters().empty()) return;
+
+  InstructionsParametersUpdater parametersUpdater(
+      eventsWorker.GetUpdatedParameters());
+  parametersUpdater.Launch(getEventsToUpdate());
 }
 
 }  // namespace gd
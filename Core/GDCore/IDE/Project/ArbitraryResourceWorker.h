@@ -7,6 +7,7 @@
 #ifndef ARBITRARYRESOURCEWORKER_H
 #define ARBITRARYRESOURCEWORKER_H
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -124,6 +125,21 @@ LaunchResourceWorkerOnEvents(const gd::Project &project,
                              gd::EventsList &events,
                              gd::ArbitraryResourceWorker &worker);
 
+/**
+ * Same as LaunchResourceWorkerOnEvents, for events that are only modified if
+ * the worker updates a resource: `getEventsToUpdate` is then called to get the
+ * events to be updated (for example, to copy events shared by a
+ * gd::CopyOnWrite only when needed).
+ *
+ * \see gd::ArbitraryResourceWorker
+ * \ingroup IDE
+ */
+void GD_CORE_API LaunchResourceWorkerOnEvents(
+    const gd::Project &project,
+    const gd::EventsList &events,
+    gd::ArbitraryResourceWorker &worker,
+    const std::function<gd::EventsList &()> &getEventsToUpdate);
+
 }  // namespace gd
 
 #endif  // ARBITRARYRESOURCEWORKER_H
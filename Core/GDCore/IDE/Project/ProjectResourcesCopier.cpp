@@ -5,11 +5,19 @@
  */
 #include "ProjectResourcesCopier.h"
 #include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <vector>
 #include "GDCore/CommonTools.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
 #include "GDCore/IDE/Project/ResourcesAbsolutePathChecker.h"
 #include "GDCore/IDE/Project/ResourcesMergingHelper.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
 
@@ -17,13 +25,275 @@ using namespace std;
 
 namespace gd {
 
+namespace {
+/**
+ * \brief A file copied to the destination directory, as stored in the
+ * manifest (indexed by the source file).
+ *
+ * Size and modification time are stored as strings so that they are compared
+ * exactly.
+ */
+struct CopiedFile {
+  gd::String file;  ///< The new filename of the file in the destination
+                    ///< directory (the one of an identical file, if the file
+                    ///< was deduplicated).
+  gd::String size;
+  gd::String modificationTime;
+  gd::String hash;
+};
+
+gd::String StatToString(double value) {
+  std::ostringstream stream;
+  stream.precision(17);
+  stream << value;
+  return gd::String::FromUTF8(stream.str());
+}
+
+map<gd::String, CopiedFile> ReadManifest(AbstractFileSystem& fs,
+                                         const gd::String& manifestFile) {
+  map<gd::String, CopiedFile> copiedFiles;
+  if (!fs.FileExists(manifestFile)) return copiedFiles;
+
+  SerializerElement manifest = Serializer::FromJSON(fs.ReadFile(manifestFile));
+  if (!manifest.HasChild("files")) return copiedFiles;
+
+  SerializerElement& filesElement = manifest.GetChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (std::size_t i = 0; i < filesElement.GetChildrenCount(); ++i) {
+    const SerializerElement& fileElement = filesElement.GetChild(i);
+    CopiedFile& copiedFile =
+        copiedFiles[fileElement.GetStringAttribute("source")];
+    copiedFile.file = fileElement.GetStringAttribute("file");
+    copiedFile.size = fileElement.GetStringAttribute("size");
+    copiedFile.modificationTime =
+        fileElement.GetStringAttribute("modificationTime");
+    copiedFile.hash = fileElement.GetStringAttribute("hash");
+  }
+
+  return copiedFiles;
+}
+
+void WriteManifest(AbstractFileSystem& fs,
+                   const gd::String& manifestFile,
+                   const map<gd::String, CopiedFile>& copiedFiles) {
+  SerializerElement manifest;
+  SerializerElement& filesElement = manifest.AddChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (auto& it : copiedFiles) {
+    SerializerElement& fileElement = filesElement.AddChild("file");
+    fileElement.SetAttribute("source", it.first);
+    fileElement.SetAttribute("file", it.second.file);
+    fileElement.SetAttribute("size", it.second.size);
+    fileElement.SetAttribute("modificationTime", it.second.modificationTime);
+    fileElement.SetAttribute("hash", it.second.hash);
+  }
+
+  if (!fs.WriteToFile(manifestFile, Serializer::ToJSON(manifest))) {
+    gd::LogWarning(_("Unable to write the resources manifest \"") +
+                   manifestFile + _("\"."));
+  }
+}
+
+/**
+ * \brief Copy the files to the destination directory.
+ *
+ * When copying incrementally, files unchanged since the previous copy are
+ * skipped and, if `deduplicateFiles` is true, files with the same content as
+ * another one are not copied (except the ones in `notDeduplicatedFiles`, given
+ * by their new filename).
+ *
+ * \return The new filenames of the files that were not copied because they are
+ * identical to another one, associated to the new filename of this other file.
+ */
+map<gd::String, gd::String> CopyResourcesFiles(
+    AbstractFileSystem& fs,
+    const map<gd::String, gd::String>& resourcesNewFilename,
+    const gd::String& destinationDirectory,
+    bool incrementalCopy,
+    bool deduplicateFiles,
+    const std::set<gd::String>& notDeduplicatedFiles = {}) {
+  map<gd::String, gd::String> duplicatedFiles;
+
+  gd::String manifestFile = ProjectResourcesCopier::GetManifestFilename();
+  fs.MakeAbsolute(manifestFile, destinationDirectory);
+  map<gd::String, CopiedFile> previousCopiedFiles;
+  if (incrementalCopy) previousCopiedFiles = ReadManifest(fs, manifestFile);
+
+  map<gd::String, CopiedFile> copiedFiles;
+  map<gd::String, gd::String> newFilenamesByHash;
+  std::vector<AbstractFileSystem::FileCopy> copies;
+  for (map<gd::String, gd::String>::const_iterator it =
+           resourcesNewFilename.begin();
+       it != resourcesNewFilename.end();
+       ++it) {
+    if (it->first.empty()) continue;
+
+    // Create the destination filename
+    gd::String destinationFile = it->second;
+    fs.MakeAbsolute(destinationFile, destinationDirectory);
+
+    CopiedFile copiedFile;
+    double size, modificationTime;
+    bool hasStats =
+        incrementalCopy && fs.GetFileStats(it->first, size, modificationTime);
+    if (hasStats) {
+      copiedFile.file = it->second;
+      copiedFile.size = StatToString(size);
+      copiedFile.modificationTime = StatToString(modificationTime);
+
+      // Only compute the hash of the content if the file was modified since
+      // the previous copy.
+      auto previousCopiedFile = previousCopiedFiles.find(it->first);
+      bool wasPreviouslyCopied =
+          previousCopiedFile != previousCopiedFiles.end();
+      if (wasPreviouslyCopied &&
+          previousCopiedFile->second.size == copiedFile.size &&
+          previousCopiedFile->second.modificationTime ==
+              copiedFile.modificationTime)
+        copiedFile.hash = previousCopiedFile->second.hash;
+      else
+        copiedFile.hash = fs.GetFileHash(it->first);
+
+      if (!copiedFile.hash.empty()) {
+        gd::String hashKey = copiedFile.size + ":" + copiedFile.hash;
+        auto identicalFile = newFilenamesByHash.find(hashKey);
+        if (deduplicateFiles && identicalFile != newFilenamesByHash.end() &&
+            notDeduplicatedFiles.find(it->second) ==
+                notDeduplicatedFiles.end()) {
+          duplicatedFiles[it->second] = identicalFile->second;
+          copiedFile.file = identicalFile->second;
+          copiedFiles[it->first] = copiedFile;
+          continue;
+        }
+        newFilenamesByHash[hashKey] = it->second;
+
+        if (wasPreviouslyCopied &&
+            previousCopiedFile->second.file == copiedFile.file &&
+            previousCopiedFile->second.hash == copiedFile.hash &&
+            fs.FileExists(destinationFile)) {
+          copiedFiles[it->first] = copiedFile;
+          continue;
+        }
+      }
+    }
+
+    copies.push_back(AbstractFileSystem::FileCopy(it->first, destinationFile));
+    if (hasStats) copiedFiles[it->first] = copiedFile;
+  }
+
+  // Copy all the files at once, so that the file system can copy them
+  // concurrently.
+  for (auto& error : fs.CopyFiles(copies)) {
+    gd::LogWarning(_("Unable to copy \"") + error.file + _("\" to \"") +
+                   error.destination + _("\"."));
+    copiedFiles.erase(error.file);
+  }
+
+  if (incrementalCopy && (!copiedFiles.empty() || !previousCopiedFiles.empty()))
+    WriteManifest(fs, manifestFile, copiedFiles);
+
+  return duplicatedFiles;
+}
+
+/**
+ * \brief A gd::ResourcesMergingHelper that computes the new filenames without
+ * updating the project.
+ */
+class ResourcesNewFilenamesFinder : public ResourcesMergingHelper {
+ public:
+  ResourcesNewFilenamesFinder(gd::AbstractFileSystem& fs)
+      : ResourcesMergingHelper(fs){};
+  virtual ~ResourcesNewFilenamesFinder(){};
+
+  virtual void ExposeFile(gd::String& resource) override {
+    gd::String file = resource;
+    ResourcesMergingHelper::ExposeFile(file);
+  };
+};
+
+/**
+ * \brief A gd::ArbitraryResourceWorker finding the files referenced directly by
+ * events or objects (for compatibility with older projects, audios and fonts
+ * can be filenames instead of resources).
+ */
+class FilesOutsideOfResourcesFinder : public ArbitraryResourceWorker {
+ public:
+  FilesOutsideOfResourcesFinder() : exposingFileReference(false){};
+  virtual ~FilesOutsideOfResourcesFinder(){};
+
+  virtual void ExposeAudio(gd::String& audioName) override {
+    exposingFileReference = true;
+    ArbitraryResourceWorker::ExposeAudio(audioName);
+    exposingFileReference = false;
+  };
+
+  virtual void ExposeFont(gd::String& fontName) override {
+    exposingFileReference = true;
+    ArbitraryResourceWorker::ExposeFont(fontName);
+    exposingFileReference = false;
+  };
+
+  virtual void ExposeFile(gd::String& file) override {
+    if (exposingFileReference) files.insert(file);
+  };
+
+  const std::set<gd::String>& GetFiles() const { return files; }
+
+ private:
+  bool exposingFileReference;  ///< True when a file is exposed because an
+                               ///< audio or font is not a resource.
+  std::set<gd::String> files;
+};
+
+void UpdateDuplicatedResourcesFiles(
+    gd::ResourcesManager& resourcesManager,
+    const map<gd::String, gd::String>& duplicatedFiles) {
+  if (duplicatedFiles.empty()) return;
+
+  for (auto& name : resourcesManager.GetAllResourceNames()) {
+    gd::Resource& resource = resourcesManager.GetResource(name);
+    auto duplicatedFile = duplicatedFiles.find(resource.GetFile());
+    if (duplicatedFile != duplicatedFiles.end())
+      resource.SetFile(duplicatedFile->second);
+  }
+}
+}  // namespace
+
+bool ProjectResourcesCopier::HasFilesOutsideOfResources(gd::Project& project) {
+  FilesOutsideOfResourcesFinder finder;
+  project.ExposeResources(finder);
+  return !finder.GetFiles().empty();
+}
+
+const gd::String& ProjectResourcesCopier::GetManifestFilename() {
+  static const gd::String manifestFilename = "gdevelop-resources-manifest.json";
+  return manifestFilename;
+}
+
+bool ProjectResourcesCopier::ClearDirExceptCopiedResources(
+    AbstractFileSystem& fs, const gd::String& directory) {
+  gd::String manifestFile = GetManifestFilename();
+  fs.MakeAbsolute(manifestFile, directory);
+
+  std::vector<gd::String> filesToKeep;
+  for (auto& it : ReadManifest(fs, manifestFile)) {
+    gd::String file = it.second.file;
+    fs.MakeAbsolute(file, directory);
+    filesToKeep.push_back(file);
+  }
+  filesToKeep.push_back(manifestFile);
+
+  return fs.ClearDirExcept(directory, filesToKeep);
+}
+
 bool ProjectResourcesCopier::CopyAllResourcesTo(
     gd::Project& originalProject,
     AbstractFileSystem& fs,
     gd::String destinationDirectory,
     bool updateOriginalProject,
     bool preserveAbsoluteFilenames,
-    bool preserveDirectoryStructure) {
+    bool preserveDirectoryStructure,
+    bool incrementalCopy) {
   // Check if there are some resources with absolute filenames
   gd::ResourcesAbsolutePathChecker absolutePathChecker(fs);
   originalProject.ExposeResources(absolutePathChecker);
@@ -32,47 +302,71 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
   std::cout << "Copying all ressources from " << projectDirectory << " to "
             << destinationDirectory << "..." << std::endl;
 
-  // Get the resources to be copied
-  gd::ResourcesMergingHelper resourcesMergingHelper(fs);
+  // Get the resources to be copied (without copying the project if it must
+  // not be updated)
+  std::unique_ptr<gd::ResourcesMergingHelper> resourcesMergingHelperPtr(
+      updateOriginalProject ? new gd::ResourcesMergingHelper(fs)
+                            : new ResourcesNewFilenamesFinder(fs));
+  gd::ResourcesMergingHelper& resourcesMergingHelper =
+      *resourcesMergingHelperPtr;
   resourcesMergingHelper.SetBaseDirectory(projectDirectory);
   resourcesMergingHelper.PreserveDirectoriesStructure(
       preserveDirectoryStructure);
   resourcesMergingHelper.PreserveAbsoluteFilenames(
       preserveAbsoluteFilenames);
+  originalProject.ExposeResources(resourcesMergingHelper);
 
-  if (updateOriginalProject) {
-    originalProject.ExposeResources(resourcesMergingHelper);
-  } else {
-    std::shared_ptr<gd::Project> project(new gd::Project(originalProject));
-    project->ExposeResources(resourcesMergingHelper);
+  // Files referenced directly by events or objects are not deduplicated, as
+  // only the resources are updated to point to the identical files.
+  std::set<gd::String> filesOutsideOfResources;
+  if (updateOriginalProject && incrementalCopy) {
+    FilesOutsideOfResourcesFinder finder;
+    originalProject.ExposeResources(finder);
+    filesOutsideOfResources = finder.GetFiles();
   }
 
   // Copy resources
-  map<gd::String, gd::String>& resourcesNewFilename =
-      resourcesMergingHelper.GetAllResourcesOldAndNewFilename();
-  unsigned int i = 0;
-  for (map<gd::String, gd::String>::const_iterator it =
-           resourcesNewFilename.begin();
-       it != resourcesNewFilename.end();
-       ++it) {
-    if (!it->first.empty()) {
-      // Create the destination filename
-      gd::String destinationFile = it->second;
-      fs.MakeAbsolute(destinationFile, destinationDirectory);
-
-      // Be sure the directory exists
-      gd::String dir = fs.DirNameFrom(destinationFile);
-      if (!fs.DirExists(dir)) fs.MkDir(dir);
-
-      // We can now copy the file
-      if (!fs.CopyFile(it->first, destinationFile)) {
-        gd::LogWarning(_("Unable to copy \"") + it->first + _("\" to \"") +
-                       destinationFile + _("\"."));
-      }
-    }
+  auto duplicatedFiles = CopyResourcesFiles(
+      fs,
+      resourcesMergingHelper.GetAllResourcesOldAndNewFilename(),
+      destinationDirectory,
+      incrementalCopy,
+      updateOriginalProject,
+      filesOutsideOfResources);
+  if (updateOriginalProject)
+    UpdateDuplicatedResourcesFiles(originalProject.GetResourcesManager(),
+                                   duplicatedFiles);
 
-    ++i;
-  }
+  return true;
+}
+
+bool ProjectResourcesCopier::CopyAllResourcesTo(
+    const gd::Project& project,
+    gd::ResourcesManager& resourcesManager,
+    AbstractFileSystem& fs,
+    gd::String destinationDirectory,
+    bool preserveAbsoluteFilenames,
+    bool preserveDirectoryStructure,
+    bool incrementalCopy) {
+  auto projectDirectory = fs.DirNameFrom(project.GetProjectFile());
+
+  // Files referenced directly by events or objects are not copied (see
+  // HasFilesOutsideOfResources): exposing the resources manager is enough.
+  gd::ResourcesMergingHelper resourcesMergingHelper(fs);
+  resourcesMergingHelper.SetBaseDirectory(projectDirectory);
+  resourcesMergingHelper.PreserveDirectoriesStructure(
+      preserveDirectoryStructure);
+  resourcesMergingHelper.PreserveAbsoluteFilenames(
+      preserveAbsoluteFilenames);
+  resourcesMergingHelper.ExposeResources(&resourcesManager);
+
+  auto duplicatedFiles = CopyResourcesFiles(
+      fs,
+      resourcesMergingHelper.GetAllResourcesOldAndNewFilename(),
+      destinationDirectory,
+      incrementalCopy,
+      true);
+  UpdateDuplicatedResourcesFiles(resourcesManager, duplicatedFiles);
 
   return true;
 }
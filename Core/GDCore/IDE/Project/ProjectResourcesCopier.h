@@ -8,6 +8,7 @@
 #include "GDCore/String.h"
 namespace gd {
 class Project;
+class ResourcesManager;
 class AbstractFileSystem;
 }  // namespace gd
 
@@ -16,6 +17,18 @@ namespace gd {
 /**
  * \brief Copy all resources files of a project to a directory.
  *
+ * When copying incrementally, the size, the last modification time and the
+ * hash of the content of the copied files are stored in a manifest in the
+ * destination directory (see GetManifestFilename). Files that did not change
+ * since the previous copy are not copied again, and files having the same
+ * content are only copied once (the filenames of the resources are then updated
+ * to point to the same file). Files referenced directly by events or objects
+ * are never deduplicated, as only resources are updated.
+ *
+ * \note Incremental copies rely on gd::AbstractFileSystem::GetFileStats and
+ * gd::AbstractFileSystem::GetFileHash: files are always copied if the file
+ * system does not support them.
+ *
  * \ingroup IDE
  */
 class GD_CORE_API ProjectResourcesCopier {
@@ -39,6 +52,11 @@ class GD_CORE_API ProjectResourcesCopier {
    * of the resources will be preserved when copying. Otherwise, everything will
    * be send in the destinationDirectory.
    *
+   * \param incrementalCopy If set to true (false by default), files unchanged
+   * since the previous copy to the same directory are not copied again. Files
+   * with the same content are only deduplicated if `updateOriginalProject` is
+   * true.
+   *
    * \return true if no error happened
    */
   static bool CopyAllResourcesTo(gd::Project& project,
@@ -46,7 +64,63 @@ class GD_CORE_API ProjectResourcesCopier {
                                  gd::String destinationDirectory,
                                  bool updateOriginalProject,
                                  bool preserveAbsoluteFilenames = true,
-                                 bool preserveDirectoryStructure = true);
+                                 bool preserveDirectoryStructure = true,
+                                 bool incrementalCopy = false);
+
+  /**
+   * \brief Copy the files of the resources of a resources manager to the
+   * specified `destinationDirectory`, updating the resources filenames.
+   *
+   * This is equivalent to calling the other overload with
+   * `updateOriginalProject` set to true, except that only the resources
+   * manager is updated: it can be a copy of the resources manager of the
+   * project, so that the project itself is not modified (nor copied).
+   *
+   * \warning Files referenced directly by events or objects (instead of by
+   * resources, in older projects) are neither copied nor renamed: check
+   * HasFilesOutsideOfResources and use the other overload if it returns true.
+   *
+   * \param project The project owning the resources (used to find the base
+   * directory of relative filenames)
+   * \param resourcesManager The resources to be copied and updated
+   * \param fs The abstract file system to be used
+   * \param destinationDirectory The directory where resources must be copied to
+   * \param preserveAbsoluteFilenames See the other overload.
+   * \param preserveDirectoryStructure See the other overload.
+   * \param incrementalCopy See the other overload.
+   *
+   * \return true if no error happened
+   */
+  static bool CopyAllResourcesTo(const gd::Project& project,
+                                 gd::ResourcesManager& resourcesManager,
+                                 gd::AbstractFileSystem& fs,
+                                 gd::String destinationDirectory,
+                                 bool preserveAbsoluteFilenames = true,
+                                 bool preserveDirectoryStructure = true,
+                                 bool incrementalCopy = false);
+
+  /**
+   * \brief Return true if events or objects of the project reference files
+   * directly instead of resources (for compatibility with older projects,
+   * audios and fonts can be filenames).
+   */
+  static bool HasFilesOutsideOfResources(gd::Project& project);
+
+  /**
+   * \brief Return the name of the manifest written in the destination directory
+   * by incremental copies.
+   */
+  static const gd::String& GetManifestFilename();
+
+  /**
+   * \brief Clear a directory where resources were copied incrementally,
+   * keeping the manifest and the files it lists so that they are not copied
+   * again.
+   *
+   * \return true if no error happened
+   */
+  static bool ClearDirExceptCopiedResources(gd::AbstractFileSystem& fs,
+                                            const gd::String& directory);
 };
 
 }  // namespace gd
@@ -0,0 +1,106 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/SceneResourcesFinder.h"
+
+#include "GDCore/IDE/DependenciesAnalyzer.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+/**
+ * \brief Launch the worker on the events of a layout or of external events,
+ * without copying them if they are shared (see gd::CopyOnWrite).
+ */
+template <class EventsContainer>
+void LaunchResourceWorkerOnSharedEvents(const gd::Project& project,
+                                        EventsContainer& eventsContainer,
+                                        gd::ArbitraryResourceWorker& worker) {
+  const EventsContainer& constEventsContainer = eventsContainer;
+  gd::LaunchResourceWorkerOnEvents(
+      project,
+      constEventsContainer.GetEvents(),
+      worker,
+      [&eventsContainer]() -> gd::EventsList& {
+        return eventsContainer.GetEvents();
+      });
+}
+}  // namespace
+
+std::set<gd::String> SceneResourcesFinder::FindSceneResources(
+    gd::Project& project, gd::Layout& layout) {
+  gd::SceneResourcesFinder resourceWorker(project.GetResourcesManager());
+
+  for (std::size_t i = 0; i < layout.GetObjectsCount(); ++i)
+    layout.GetObject(i).ExposeResources(resourceWorker);
+  LaunchResourceWorkerOnSharedEvents(project, layout, resourceWorker);
+
+  // Events of other scenes or of external events can be included by links.
+  // Instances of external layouts don't need to be visited, as they only
+  // refer to objects of the scene or global objects.
+  DependenciesAnalyzer dependenciesAnalyzer(project, layout);
+  dependenciesAnalyzer.Analyze();
+  for (const gd::String& externalEventsName :
+       dependenciesAnalyzer.GetExternalEventsDependencies()) {
+    if (!project.HasExternalEventsNamed(externalEventsName)) continue;
+    LaunchResourceWorkerOnSharedEvents(
+        project, project.GetExternalEvents(externalEventsName), resourceWorker);
+  }
+  for (const gd::String& sceneName :
+       dependenciesAnalyzer.GetScenesDependencies()) {
+    if (!project.HasLayoutNamed(sceneName)) continue;
+    LaunchResourceWorkerOnSharedEvents(
+        project, project.GetLayout(sceneName), resourceWorker);
+  }
+
+  std::set<gd::String> projectResources = FindProjectResources(project);
+  resourceWorker.resourceNames.insert(projectResources.begin(),
+                                      projectResources.end());
+  return resourceWorker.resourceNames;
+}
+
+std::set<gd::String> SceneResourcesFinder::FindProjectResources(
+    gd::Project& project) {
+  gd::SceneResourcesFinder resourceWorker(project.GetResourcesManager());
+
+  for (std::size_t i = 0; i < project.GetObjectsCount(); ++i)
+    project.GetObject(i).ExposeResources(resourceWorker);
+
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    auto& eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    for (auto&& eventsFunction : eventsFunctionsExtension.GetInternalVector()) {
+      gd::LaunchResourceWorkerOnEvents(
+          project, eventsFunction->GetEvents(), resourceWorker);
+    }
+  }
+
+  return resourceWorker.resourceNames;
+}
+
+void SceneResourcesFinder::SerializeTo(
+    const std::set<gd::String>& resourceNames,
+    gd::SerializerElement& element) {
+  element.ConsiderAsArrayOf("resourceReference");
+  for (const gd::String& resourceName : resourceNames) {
+    element.AddChild("resourceReference").SetAttribute("name", resourceName);
+  }
+}
+
+void SceneResourcesFinder::AddUsedResource(gd::String& resourceName) {
+  if (resourceName.empty() || !resourcesManager.HasResource(resourceName))
+    return;
+
+  resourceNames.insert(resourceName);
+}
+
+}  // namespace gd
@@ -0,0 +1,91 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SCENERESOURCESFINDER_H
+#define GDCORE_SCENERESOURCESFINDER_H
+#include <set>
+
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class Layout;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the resources used by a scene, so that a game can load them
+ * only when the scene is about to be launched.
+ *
+ * The resources of a scene are the ones used by its objects and its events,
+ * including the events of the external events and scenes linked in them (see
+ * gd::DependenciesAnalyzer), plus the ones that can be used by any scene: the
+ * resources of the global objects and of the events functions.
+ *
+ * Only the names of existing resources are listed: files referenced directly
+ * by old events (for compatibility) are left out.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API SceneResourcesFinder : private gd::ArbitraryResourceWorker {
+ public:
+  /**
+   * \brief Return the names of the resources used by the given scene.
+   */
+  static std::set<gd::String> FindSceneResources(gd::Project& project,
+                                                 gd::Layout& layout);
+
+  /**
+   * \brief Return the names of the resources used by any scene (global
+   * objects and events functions).
+   */
+  static std::set<gd::String> FindProjectResources(gd::Project& project);
+
+  /**
+   * \brief Serialize the names of the resources, as an array of resource
+   * references.
+   */
+  static void SerializeTo(const std::set<gd::String>& resourceNames,
+                          gd::SerializerElement& element);
+
+  virtual ~SceneResourcesFinder(){};
+
+ private:
+  SceneResourcesFinder(gd::ResourcesManager& resourcesManager_)
+      : resourcesManager(resourcesManager_){};
+
+  void AddUsedResource(gd::String& resourceName);
+
+  void ExposeFile(gd::String& resourceFileName) override{
+      // Don't care, we just list resource names.
+  };
+  void ExposeImage(gd::String& imageResourceName) override {
+    AddUsedResource(imageResourceName);
+  };
+  void ExposeAudio(gd::String& audioResourceName) override {
+    AddUsedResource(audioResourceName);
+  };
+  void ExposeFont(gd::String& fontResourceName) override {
+    AddUsedResource(fontResourceName);
+  };
+  void ExposeJson(gd::String& jsonResourceName) override {
+    AddUsedResource(jsonResourceName);
+  };
+  void ExposeVideo(gd::String& videoResourceName) override {
+    AddUsedResource(videoResourceName);
+  };
+  void ExposeBitmapFont(gd::String& bitmapFontResourceName) override {
+    AddUsedResource(bitmapFontResourceName);
+  };
+
+  gd::ResourcesManager& resourcesManager;
+  std::set<gd::String> resourceNames;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SCENERESOURCESFINDER_H
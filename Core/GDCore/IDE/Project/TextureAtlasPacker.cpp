@@ -0,0 +1,253 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/NewNameGenerator.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/Project/Effect.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+/**
+ * \brief Count the number of times each image is used.
+ */
+class ImagesUsesCounter : public gd::ArbitraryResourceWorker {
+ public:
+  ImagesUsesCounter() : gd::ArbitraryResourceWorker(){};
+  virtual ~ImagesUsesCounter(){};
+
+  virtual void ExposeFile(gd::String& resource) override{};
+  virtual void ExposeImage(gd::String& imageName) override {
+    usesCount[imageName]++;
+  };
+
+  std::map<gd::String, std::size_t> usesCount;
+};
+
+void CountSpriteObjectsImagesUses(gd::ObjectsContainer& objects,
+                                  ImagesUsesCounter& counter) {
+  for (std::size_t i = 0; i < objects.GetObjectsCount(); ++i) {
+    auto spriteObject = dynamic_cast<gd::SpriteObject*>(&objects.GetObject(i));
+    if (spriteObject) spriteObject->ExposeResources(counter);
+  }
+}
+
+struct ImageToPack {
+  gd::String name;
+  gd::String file;
+  unsigned int width;
+  unsigned int height;
+};
+
+/**
+ * \brief A page being filled with images, shelf by shelf (rows of images
+ * placed from left to right, the first image of a shelf being the highest).
+ */
+struct PageBeingPacked {
+  PageBeingPacked() : shelfX(0), shelfY(0), shelfHeight(0) {
+    page.width = 0;
+    page.height = 0;
+  }
+
+  TextureAtlasPacker::Page page;
+  std::vector<AbstractFileSystem::ImagePlacement> placements;
+  unsigned int shelfX;
+  unsigned int shelfY;
+  unsigned int shelfHeight;
+};
+}  // namespace
+
+TextureAtlasPacker::TextureAtlasPacker(gd::AbstractFileSystem& fs_)
+    : fs(fs_), maxPageSize(2048), maxImageSize(512), padding(2) {}
+
+void TextureAtlasPacker::PackImages(gd::Project& project,
+                                    gd::ResourcesManager& resourcesManager,
+                                    const gd::String& directory) {
+  pages.clear();
+
+  // Find the images used only by sprite objects.
+  ImagesUsesCounter allUses;
+  project.ExposeResources(allUses);
+
+  // Effects can use images (like the texture of a color map) but don't expose
+  // them as resources: any string parameter is counted as a use of the image
+  // with this name.
+  ExposeProjectEffects(project, [&allUses](const gd::Effect& effect) {
+    for (auto& it : effect.GetAllStringParameters())
+      allUses.usesCount[it.second]++;
+  });
+
+  ImagesUsesCounter spriteObjectsUses;
+  CountSpriteObjectsImagesUses(project, spriteObjectsUses);
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i)
+    CountSpriteObjectsImagesUses(project.GetLayout(i), spriteObjectsUses);
+
+  // Images are packed separately depending on their smoothing, as it's a
+  // setting of the whole texture.
+  std::map<bool, std::vector<ImageToPack>> imagesToPack;
+  for (auto& it : spriteObjectsUses.usesCount) {
+    if (allUses.usesCount[it.first] != it.second) continue;
+    if (!resourcesManager.HasResource(it.first)) continue;
+
+    auto imageResource =
+        dynamic_cast<gd::ImageResource*>(&resourcesManager.GetResource(it.first));
+    if (!imageResource) continue;
+
+    ImageToPack image;
+    image.name = it.first;
+    image.file = imageResource->GetFile();
+    fs.MakeAbsolute(image.file, directory);
+    if (!fs.GetImageSize(image.file, image.width, image.height) ||
+        image.width == 0 || image.height == 0 ||
+        image.width > maxImageSize || image.height > maxImageSize ||
+        image.width > maxPageSize || image.height > maxPageSize)
+      continue;
+
+    imagesToPack[imageResource->IsSmooth()].push_back(image);
+  }
+
+  gd::String atlasesDirectory = "atlases";
+  fs.MakeAbsolute(atlasesDirectory, directory);
+  std::vector<gd::String> packedFiles;
+  for (auto& it : imagesToPack) {
+    bool smooth = it.first;
+    std::vector<ImageToPack>& images = it.second;
+    std::sort(images.begin(),
+              images.end(),
+              [](const ImageToPack& a, const ImageToPack& b) {
+                if (a.height != b.height) return a.height > b.height;
+                if (a.width != b.width) return a.width > b.width;
+                return a.name < b.name;
+              });
+
+    std::vector<PageBeingPacked> pagesBeingPacked;
+    for (auto& image : images) {
+      PageBeingPacked* pageBeingPacked =
+          pagesBeingPacked.empty() ? nullptr : &pagesBeingPacked.back();
+      if (pageBeingPacked &&
+          pageBeingPacked->shelfX + image.width > maxPageSize) {
+        // Start a new shelf below the current one.
+        pageBeingPacked->shelfY += pageBeingPacked->shelfHeight + padding;
+        pageBeingPacked->shelfX = 0;
+        pageBeingPacked->shelfHeight = 0;
+      }
+      if (!pageBeingPacked ||
+          pageBeingPacked->shelfY + image.height > maxPageSize) {
+        pagesBeingPacked.push_back(PageBeingPacked());
+        pageBeingPacked = &pagesBeingPacked.back();
+      }
+
+      Region region;
+      region.imageName = image.name;
+      region.x = pageBeingPacked->shelfX;
+      region.y = pageBeingPacked->shelfY;
+      region.width = image.width;
+      region.height = image.height;
+      pageBeingPacked->page.regions.push_back(region);
+      pageBeingPacked->placements.push_back(
+          AbstractFileSystem::ImagePlacement(image.file, region.x, region.y));
+
+      pageBeingPacked->shelfX += image.width + padding;
+      pageBeingPacked->shelfHeight =
+          std::max(pageBeingPacked->shelfHeight, image.height);
+      pageBeingPacked->page.width =
+          std::max(pageBeingPacked->page.width, region.x + region.width);
+      pageBeingPacked->page.height =
+          std::max(pageBeingPacked->page.height, region.y + region.height);
+    }
+
+    for (auto& pageBeingPacked : pagesBeingPacked) {
+      Page& page = pageBeingPacked.page;
+      // A page made of a single image would not save anything.
+      if (page.regions.size() < 2) continue;
+
+      page.imageName = gd::NewNameGenerator::Generate(
+          "atlas" + gd::String::From(pages.size()),
+          [&resourcesManager](const gd::String& name) {
+            return resourcesManager.HasResource(name);
+          });
+      gd::String pageFile = "atlases/" + page.imageName + ".png";
+      gd::String absolutePageFile = pageFile;
+      fs.MakeAbsolute(absolutePageFile, directory);
+
+      if (!fs.DirExists(atlasesDirectory)) fs.MkDir(atlasesDirectory);
+      if (!fs.WriteAtlasImage(absolutePageFile,
+                              page.width,
+                              page.height,
+                              pageBeingPacked.placements))
+        continue;
+
+      gd::ImageResource pageResource;
+      pageResource.SetName(page.imageName);
+      pageResource.SetFile(pageFile);
+      pageResource.SetSmooth(smooth);
+      resourcesManager.AddResource(pageResource);
+      for (auto& region : page.regions)
+        resourcesManager.RemoveResource(region.imageName);
+      for (auto& placement : pageBeingPacked.placements)
+        packedFiles.push_back(placement.file);
+
+      pages.push_back(page);
+    }
+  }
+
+  // The packed images don't need to be shipped with the game, unless the file
+  // of a packed image is also used by a resource that was not packed.
+  std::set<gd::String> usedFiles;
+  for (const gd::String& name : resourcesManager.GetAllResourceNames()) {
+    gd::String file = resourcesManager.GetResource(name).GetFile();
+    fs.MakeAbsolute(file, directory);
+    usedFiles.insert(file);
+  }
+  for (const gd::String& file : packedFiles) {
+    if (usedFiles.find(file) == usedFiles.end()) fs.RemoveFile(file);
+  }
+}
+
+void TextureAtlasPacker::SerializeTo(SerializerElement& element) const {
+  element.ConsiderAsArrayOf("atlas");
+  for (auto& page : pages) {
+    SerializerElement& atlasElement = element.AddChild("atlas");
+    atlasElement.SetAttribute("image", page.imageName);
+    atlasElement.SetAttribute("width", (int)page.width);
+    atlasElement.SetAttribute("height", (int)page.height);
+
+    SerializerElement& regionsElement = atlasElement.AddChild("regions");
+    regionsElement.ConsiderAsArrayOf("region");
+    for (auto& region : page.regions) {
+      SerializerElement& regionElement = regionsElement.AddChild("region");
+      regionElement.SetAttribute("name", region.imageName);
+      regionElement.SetAttribute("x", (int)region.x);
+      regionElement.SetAttribute("y", (int)region.y);
+      regionElement.SetAttribute("width", (int)region.width);
+      regionElement.SetAttribute("height", (int)region.height);
+    }
+  }
+}
+
+void TextureAtlasPacker::UpdateResourceNames(
+    std::set<gd::String>& resourceNames) const {
+  for (auto& page : pages) {
+    for (auto& region : page.regions) {
+      if (resourceNames.erase(region.imageName))
+        resourceNames.insert(page.imageName);
+    }
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,143 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_TEXTUREATLASPACKER_H
+#define GDCORE_TEXTUREATLASPACKER_H
+#include <set>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class AbstractFileSystem;
+class Project;
+class ResourcesManager;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Pack the small images used by sprite objects into texture atlases
+ * (images, called pages, made of several images), so that games load fewer
+ * files and bind fewer textures.
+ *
+ * Only the images used exclusively by sprite objects (see gd::SpriteObject)
+ * are packed: images also used by other objects, by events, by effects or by
+ * the project itself may need their own texture (to be repeated, for example).
+ *
+ * \warning Images referenced by their name in expressions or in JavaScript
+ * code can't be detected, and are packed if they are also used by a sprite
+ * object. This is why packing must be enabled explicitly by exporters.
+ *
+ * The image resources of the packed images are replaced by the image resources
+ * of the pages, and the position of each image in the pages must be given to
+ * the game (see SerializeTo). The files of the packed images are removed from
+ * the exported game (with gd::AbstractFileSystem::RemoveFile), unless another
+ * resource still uses them.
+ *
+ * \note Images are read and pages are written with
+ * gd::AbstractFileSystem::GetImageSize and
+ * gd::AbstractFileSystem::WriteAtlasImage: nothing is packed if the file system
+ * does not support them.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API TextureAtlasPacker {
+ public:
+  /**
+   * \brief The position of an image in a page.
+   */
+  struct Region {
+    gd::String imageName;  ///< The name of the packed image resource.
+    unsigned int x;
+    unsigned int y;
+    unsigned int width;
+    unsigned int height;
+  };
+
+  /**
+   * \brief A page of the atlas, made of several images.
+   */
+  struct Page {
+    gd::String imageName;  ///< The name of the image resource of the page.
+    unsigned int width;
+    unsigned int height;
+    std::vector<Region> regions;
+  };
+
+  TextureAtlasPacker(gd::AbstractFileSystem& fs);
+  virtual ~TextureAtlasPacker(){};
+
+  /**
+   * \brief Set the maximum width and height of the pages (2048 by default).
+   */
+  TextureAtlasPacker& SetMaxPageSize(unsigned int size) {
+    maxPageSize = size;
+    return *this;
+  }
+
+  /**
+   * \brief Set the maximum width and height of the images to be packed (512
+   * by default). Bigger images are left as is.
+   */
+  TextureAtlasPacker& SetMaxImageSize(unsigned int size) {
+    maxImageSize = size;
+    return *this;
+  }
+
+  /**
+   * \brief Set the space, in pixels, left between the images of a page (2 by
+   * default), to avoid texture bleeding when images are scaled.
+   */
+  TextureAtlasPacker& SetPadding(unsigned int padding_) {
+    padding = padding_;
+    return *this;
+  }
+
+  /**
+   * \brief Pack the images used only by the sprite objects of the project.
+   *
+   * \param project The project, used to find where images are used. It's not
+   * modified.
+   * \param resourcesManager The resources of the exported game, with their
+   * files already copied to `directory` (usually, a copy of the resources of
+   * the project updated by gd::ProjectResourcesCopier). Packed image
+   * resources are removed and the pages are added to it.
+   * \param directory The directory of the exported game, where pages are
+   * written (in an "atlases" directory) and from where the packed images are
+   * removed.
+   */
+  void PackImages(gd::Project& project,
+                  gd::ResourcesManager& resourcesManager,
+                  const gd::String& directory);
+
+  /**
+   * \brief Return the pages created by PackImages.
+   */
+  const std::vector<Page>& GetPages() const { return pages; }
+
+  /**
+   * \brief Serialize the pages, with the position of each image, as an array
+   * of atlases to be read by the game.
+   */
+  void SerializeTo(SerializerElement& element) const;
+
+  /**
+   * \brief Replace, in the given names of image resources, the packed images
+   * by the pages containing them.
+   */
+  void UpdateResourceNames(std::set<gd::String>& resourceNames) const;
+
+ private:
+  gd::AbstractFileSystem& fs;
+  unsigned int maxPageSize;
+  unsigned int maxImageSize;
+  unsigned int padding;
+  std::vector<Page> pages;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_TEXTUREATLASPACKER_H
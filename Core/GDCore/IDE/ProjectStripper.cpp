@@ -8,7 +8,9 @@
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
 
 namespace gd {
 
@@ -17,12 +19,34 @@ void GD_CORE_API ProjectStripper::StripProjectForExport(gd::Project& project) {
   while (project.GetExternalEventsCount() > 0)
     project.RemoveExternalEvents(project.GetExternalEvents(0).GetName());
 
-  for (unsigned int i = 0; i < project.GetLayoutsCount(); ++i) {
-    project.GetLayout(i).GetObjectGroups().Clear();
-    project.GetLayout(i).GetEvents().Clear();
-  }
+  for (unsigned int i = 0; i < project.GetLayoutsCount(); ++i)
+    StripLayoutForExport(project.GetLayout(i));
 
   project.ClearEventsFunctionsExtensions();
 }
 
+void GD_CORE_API ProjectStripper::StripLayoutForExport(gd::Layout& layout) {
+  layout.GetObjectGroups().Clear();
+  layout.ClearEvents();
+}
+
+void GD_CORE_API ProjectStripper::StripSerializedProjectForExport(
+    gd::SerializerElement& projectElement) {
+  gd::SerializerElement& objectsGroupsElement =
+      projectElement.GetChild("objectsGroups");
+  objectsGroupsElement = gd::SerializerElement();
+  gd::ObjectGroupsContainer().SerializeTo(objectsGroupsElement);
+
+  gd::SerializerElement& externalEventsElement =
+      projectElement.GetChild("externalEvents");
+  externalEventsElement = gd::SerializerElement();
+  externalEventsElement.ConsiderAsArrayOf("externalEvents");
+
+  gd::SerializerElement& eventsFunctionsExtensionsElement =
+      projectElement.GetChild("eventsFunctionsExtensions");
+  eventsFunctionsExtensionsElement = gd::SerializerElement();
+  eventsFunctionsExtensionsElement.ConsiderAsArrayOf(
+      "eventsFunctionsExtension");
+}
+
 }  // namespace gd
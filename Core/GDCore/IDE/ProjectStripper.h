@@ -7,6 +7,8 @@
 #define GDCORE_PROJECTSTRIPPER_H
 namespace gd {
 class Project;
+class Layout;
+class SerializerElement;
 }
 namespace gd {
 class String;
@@ -28,6 +30,24 @@ class GD_CORE_API ProjectStripper {
    */
   static void StripProjectForExport(gd::Project& project);
 
+  /**
+   * \brief Strip a layout for export, the same way as it would be by
+   * StripProjectForExport: objects groups and events are deleted.
+   *
+   * \param layout The layout to be stripped.
+   */
+  static void StripLayoutForExport(gd::Layout& layout);
+
+  /**
+   * \brief Strip a project serialized without its layouts (see
+   * gd::Project::SerializeWithoutLayoutsTo), the same way as it would be by
+   * StripProjectForExport. Layouts must be stripped with StripLayoutForExport.
+   *
+   * \param projectElement The serialized project to be stripped.
+   */
+  static void StripSerializedProjectForExport(
+      gd::SerializerElement& projectElement);
+
  private:
   ProjectStripper(){};
   virtual ~ProjectStripper(){};
@@ -30,7 +30,7 @@ namespace gd {
  */
 class GD_CORE_API Behavior {
  public:
-  Behavior(){};
+  Behavior() : id(NewId()){};
   virtual ~Behavior();
   virtual Behavior* Clone() const { return new Behavior(*this); }
 
@@ -44,6 +44,16 @@ class GD_CORE_API Behavior {
    */
   void SetTypeName(const gd::String& type_) { type = type_; };
 
+  /**
+   * \brief Return a number identifying the behavior, used to know if
+   * properties returned by GetProperties can be reused.
+   *
+   * A copy of the behavior has the same identifier (as it returns the same
+   * properties), while a new behavior always gets a new one.
+   * \see gd::BehaviorContent::GetProperties
+   */
+  std::size_t GetId() const { return id; };
+
 #if defined(GD_IDE_ONLY)
   /**
    * \brief Called when the IDE wants to know about the custom properties of the
@@ -84,7 +94,10 @@ class GD_CORE_API Behavior {
   virtual void InitializeContent(gd::SerializerElement& behaviorContent){};
 
  private:
+  static std::size_t NewId();
+
   gd::String type;
+  std::size_t id;
 };
 
 }  // namespace gd
@@ -5,8 +5,34 @@
  */
 #include "GDCore/Project/BehaviorContent.h"
 
+#include "GDCore/Project/Behavior.h"
+#if defined(GD_IDE_ONLY)
+#include "GDCore/Project/PropertyDescriptor.h"
+#endif
+
 namespace gd {
 
 BehaviorContent::~BehaviorContent(){};
 
+#if defined(GD_IDE_ONLY)
+const std::map<gd::String, gd::PropertyDescriptor>&
+BehaviorContent::GetProperties(const gd::Behavior& behavior) const {
+  if (!properties || propertiesBehaviorId != behavior.GetId()) {
+    properties =
+        std::make_shared<const std::map<gd::String, gd::PropertyDescriptor>>(
+            behavior.GetProperties(content));
+    propertiesBehaviorId = behavior.GetId();
+  }
+
+  return *properties;
+}
+
+bool BehaviorContent::UpdateProperty(gd::Behavior& behavior,
+                                     const gd::String& name,
+                                     const gd::String& value) {
+  InvalidateProperties();
+  return behavior.UpdateProperty(content, name, value);
+}
+#endif
+
 }  // namespace gd
@@ -6,6 +6,7 @@
 #ifndef GDCORE_BEHAVIORCONTENT_H
 #define GDCORE_BEHAVIORCONTENT_H
 #include <map>
+#include <memory>
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/String.h"
 #if defined(GD_IDE_ONLY)
@@ -17,6 +18,7 @@ namespace gd {
 class SerializerElement;
 class Project;
 class Layout;
+class Behavior;
 }  // namespace gd
 
 namespace gd {
@@ -32,7 +34,7 @@ namespace gd {
 class GD_CORE_API BehaviorContent {
  public:
   BehaviorContent(const gd::String& name_, const gd::String& type_)
-      : name(name_), type(type_){};
+      : name(name_), type(type_), propertiesBehaviorId(0){};
   virtual ~BehaviorContent();
   virtual BehaviorContent* Clone() const { return new BehaviorContent(*this); }
 
@@ -70,10 +72,45 @@ class GD_CORE_API BehaviorContent {
    */
   virtual void UnserializeFrom(const gd::SerializerElement& element) {
     content = element;
+    InvalidateProperties();
   };
 
   const gd::SerializerElement& GetContent() const { return content; };
-  gd::SerializerElement& GetContent() { return content; };
+
+  /**
+   * \brief Return the content, to be modified.
+   *
+   * \note The properties returned by GetProperties are computed again after
+   * this is called: don't keep the returned reference to modify the content
+   * later.
+   */
+  gd::SerializerElement& GetContent() {
+    InvalidateProperties();
+    return content;
+  };
+
+#if defined(GD_IDE_ONLY)
+  /**
+   * \brief Return the properties of the behavior, as returned by
+   * gd::Behavior::GetProperties for this content.
+   *
+   * The properties are kept until the content is modified (or another
+   * behavior is given), so that they are not computed again each time the
+   * IDE shows them.
+   */
+  const std::map<gd::String, gd::PropertyDescriptor>& GetProperties(
+      const gd::Behavior& behavior) const;
+
+  /**
+   * \brief Update a property of the behavior, using
+   * gd::Behavior::UpdateProperty on this content.
+   *
+   * \return false if the new value cannot be set
+   */
+  bool UpdateProperty(gd::Behavior& behavior,
+                      const gd::String& name,
+                      const gd::String& value);
+#endif
 
  protected:
   gd::String name;  ///< Name of the behavior
@@ -81,6 +118,17 @@ class GD_CORE_API BehaviorContent {
                     ///< in the form "ExtensionName::BehaviorTypeName"
 
   gd::SerializerElement content;  // Storage for the behavior properties
+
+ private:
+  void InvalidateProperties() {
+    properties.reset();
+    propertiesBehaviorId = 0;
+  }
+
+  mutable std::shared_ptr<const std::map<gd::String, gd::PropertyDescriptor>>
+      properties;  ///< The properties of the content, computed by the
+                   ///< behavior identified by propertiesBehaviorId.
+  mutable std::size_t propertiesBehaviorId;
 };
 
 }  // namespace gd
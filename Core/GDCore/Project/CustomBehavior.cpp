@@ -0,0 +1,128 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#include "GDCore/Project/CustomBehavior.h"
+
+#include <sstream>
+
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/PropertyDescriptor.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * Format a number so that it's read back as the same value, using the
+ * shortest of 15 or 17 significant digits (so that 0.1 stays "0.1").
+ */
+gd::String NumberToString(double value) {
+  std::ostringstream stream;
+  stream.precision(15);
+  stream << value;
+
+  double readValue = 0;
+  std::istringstream(stream.str()) >> readValue;
+  if (readValue != value) {
+    stream.str("");
+    stream.precision(17);
+    stream << value;
+  }
+  return gd::String::FromUTF8(stream.str());
+}
+
+}  // namespace
+
+CustomBehavior::CustomBehavior(
+    const gd::EventsBasedBehavior& eventsBasedBehavior) {
+  const auto& propertyDescriptors =
+      eventsBasedBehavior.GetPropertyDescriptors();
+  properties.reserve(propertyDescriptors.GetCount());
+  for (std::size_t i = 0; i < propertyDescriptors.GetCount(); ++i) {
+    const gd::NamedPropertyDescriptor& descriptor = propertyDescriptors.Get(i);
+    properties.push_back({descriptor, GetValueType(descriptor.GetType())});
+    propertiesIndices[descriptor.GetName()] = i;
+  }
+}
+
+CustomBehavior::~CustomBehavior() {}
+
+CustomBehavior::ValueType CustomBehavior::GetValueType(
+    const gd::String& propertyType) {
+  if (propertyType == "String" || propertyType == "Choice" ||
+      propertyType == "Color" || propertyType == "Behavior")
+    return String;
+  else if (propertyType == "Number")
+    return Number;
+  else if (propertyType == "Boolean")
+    return Boolean;
+
+  return Unknown;
+}
+
+std::map<gd::String, gd::PropertyDescriptor> CustomBehavior::GetProperties(
+    const gd::SerializerElement& behaviorContent) const {
+  std::map<gd::String, gd::PropertyDescriptor> behaviorProperties;
+  for (const Property& property : properties) {
+    const gd::String& propertyName = property.descriptor.GetName();
+    gd::PropertyDescriptor& newProperty =
+        behaviorProperties
+            .insert(std::make_pair(
+                propertyName,
+                static_cast<const gd::PropertyDescriptor&>(property.descriptor)))
+            .first->second;
+
+    // If no value was serialized for this property, it has the default value.
+    if (!behaviorContent.HasChild(propertyName)) continue;
+
+    const gd::SerializerElement& element =
+        behaviorContent.GetChild(propertyName);
+    if (property.valueType == String)
+      newProperty.SetValue(element.GetStringValue());
+    else if (property.valueType == Number)
+      newProperty.SetValue(NumberToString(element.GetDoubleValue()));
+    else if (property.valueType == Boolean)
+      newProperty.SetValue(element.GetBoolValue() ? "true" : "false");
+  }
+
+  return behaviorProperties;
+}
+
+bool CustomBehavior::UpdateProperty(gd::SerializerElement& behaviorContent,
+                                    const gd::String& name,
+                                    const gd::String& value) {
+  auto it = propertiesIndices.find(name);
+  if (it == propertiesIndices.end()) return false;
+
+  const Property& property = properties[it->second];
+  gd::SerializerElement& element = behaviorContent.AddChild(name);
+  if (property.valueType == String)
+    element.SetStringValue(value);
+  else if (property.valueType == Number)
+    element.SetDoubleValue(value.To<double>());
+  else if (property.valueType == Boolean)
+    element.SetBoolValue(value == "1");
+
+  return true;
+}
+
+void CustomBehavior::InitializeContent(gd::SerializerElement& behaviorContent) {
+  for (const Property& property : properties) {
+    gd::SerializerElement& element =
+        behaviorContent.AddChild(property.descriptor.GetName());
+    const gd::String& value = property.descriptor.GetValue();
+    if (property.valueType == String)
+      element.SetStringValue(value);
+    else if (property.valueType == Number)
+      element.SetDoubleValue(value.To<double>());
+    else if (property.valueType == Boolean)
+      element.SetBoolValue(value == "true");
+  }
+}
+
+}  // namespace gd
+#endif
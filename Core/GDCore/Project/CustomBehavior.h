@@ -0,0 +1,76 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if defined(GD_IDE_ONLY)
+#ifndef GDCORE_CUSTOMBEHAVIOR_H
+#define GDCORE_CUSTOMBEHAVIOR_H
+
+#include <map>
+#include <vector>
+
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/NamedPropertyDescriptor.h"
+#include "GDCore/String.h"
+namespace gd {
+class EventsBasedBehavior;
+class PropertyDescriptor;
+class SerializerElement;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A behavior whose properties are the ones declared by an events based
+ * behavior.
+ *
+ * The properties declared by the events based behavior are copied (and their
+ * types read) when the behavior is constructed, so that they can be read and
+ * updated without going through the events based behavior again. The behavior
+ * must be created again if the properties of the events based behavior are
+ * changed.
+ *
+ * \see gd::EventsBasedBehavior
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API CustomBehavior : public gd::Behavior {
+ public:
+  CustomBehavior(const gd::EventsBasedBehavior& eventsBasedBehavior);
+  virtual ~CustomBehavior();
+  virtual CustomBehavior* Clone() const override {
+    return new CustomBehavior(*this);
+  }
+
+  virtual std::map<gd::String, gd::PropertyDescriptor> GetProperties(
+      const gd::SerializerElement& behaviorContent) const override;
+  virtual bool UpdateProperty(gd::SerializerElement& behaviorContent,
+                              const gd::String& name,
+                              const gd::String& value) override;
+  virtual void InitializeContent(
+      gd::SerializerElement& behaviorContent) override;
+
+ private:
+  /**
+   * \brief The type of the value stored in the behavior content for a
+   * property.
+   */
+  enum ValueType { String, Number, Boolean, Unknown };
+
+  struct Property {
+    gd::NamedPropertyDescriptor descriptor;
+    ValueType valueType;
+  };
+
+  static ValueType GetValueType(const gd::String& propertyType);
+
+  std::vector<Property> properties;  ///< The properties, in the order they
+                                     ///< are declared.
+  std::map<gd::String, std::size_t>
+      propertiesIndices;  ///< The index of each property, by name.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_CUSTOMBEHAVIOR_H
+#endif
@@ -21,18 +21,28 @@ ExternalEvents& ExternalEvents::operator=(const ExternalEvents& rhs) {
   return *this;
 }
 
-void ExternalEvents::Init(const ExternalEvents& externalEvents) {
+ExternalEvents* ExternalEvents::CloneWithCopyOnWrite() const {
+  ExternalEvents* externalEvents = new ExternalEvents;
+  externalEvents->Init(*this, true);
+  return externalEvents;
+}
+
+void ExternalEvents::Init(const ExternalEvents& externalEvents,
+                          bool copyOnWrite) {
   name = externalEvents.GetName();
   associatedScene = externalEvents.GetAssociatedLayout();
   lastChangeTimeStamp = externalEvents.GetLastChangeTimeStamp();
-  events = externalEvents.events;
+  if (copyOnWrite)
+    events.Share(externalEvents.events);
+  else
+    events = externalEvents.events;
 }
 
 void ExternalEvents::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("name", name);
   element.SetAttribute("associatedLayout", associatedScene);
   element.SetAttribute("lastChangeTimeStamp", (int)lastChangeTimeStamp);
-  gd::EventsListSerialization::SerializeEventsTo(events,
+  gd::EventsListSerialization::SerializeEventsTo(events.Get(),
                                                  element.AddChild("events"));
 }
 
@@ -44,7 +54,7 @@ void ExternalEvents::UnserializeFrom(gd::Project& project,
   lastChangeTimeStamp =
       element.GetIntAttribute("lastChangeTimeStamp", 0, "LastChangeTimeStamp");
   gd::EventsListSerialization::UnserializeEventsFrom(
-      project, events, element.GetChild("events", 0, "Events"));
+      project, events.GetMutable(), element.GetChild("events", 0, "Events"));
 }
 
 }  // namespace gd
@@ -11,6 +11,7 @@
 
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/CopyOnWrite.h"
 namespace gd {
 class BaseEvent;
 }
@@ -40,6 +41,16 @@ class GD_CORE_API ExternalEvents {
    */
   ExternalEvents* Clone() const { return new ExternalEvents(*this); };
 
+  /**
+   * \brief Return a pointer to a new ExternalEvents constructed from this one,
+   * sharing the events with it until they are modified.
+   *
+   * \warning These external events must not be modified while the copy is
+   * used.
+   * \see gd::CopyOnWrite
+   */
+  ExternalEvents* CloneWithCopyOnWrite() const;
+
   /**
    * \brief Get external events name
    */
@@ -88,12 +99,12 @@ class GD_CORE_API ExternalEvents {
   /**
    * \brief Get the events.
    */
-  virtual const gd::EventsList& GetEvents() const { return events; }
+  virtual const gd::EventsList& GetEvents() const { return events.Get(); }
 
   /**
    * \brief Get the events.
    */
-  virtual gd::EventsList& GetEvents() { return events; }
+  virtual gd::EventsList& GetEvents() { return events.GetMutable(); }
 
   /**
    * \brief Serialize external events.
@@ -110,13 +121,13 @@ class GD_CORE_API ExternalEvents {
   gd::String name;
   gd::String associatedScene;
   time_t lastChangeTimeStamp;  ///< Time of the last build
-  gd::EventsList events;       ///< List of events
+  gd::CopyOnWrite<gd::EventsList> events;  ///< List of events
 
   /**
    * Initialize from another ExternalEvents. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
    */
-  void Init(const ExternalEvents& externalEvents);
+  void Init(const ExternalEvents& externalEvents, bool copyOnWrite = false);
 };
 
 /**
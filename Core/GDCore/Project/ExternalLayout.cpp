@@ -13,16 +13,25 @@
 
 namespace gd {
 
+ExternalLayout* ExternalLayout::CloneWithCopyOnWrite() const {
+  ExternalLayout* externalLayout = new ExternalLayout;
+  externalLayout->name = name;
+  externalLayout->instances.Share(instances);
+  externalLayout->editorSettings = editorSettings;
+  externalLayout->associatedLayout = associatedLayout;
+  return externalLayout;
+}
+
 void ExternalLayout::UnserializeFrom(const SerializerElement& element) {
   name = element.GetStringAttribute("name", "", "Name");
-  instances.UnserializeFrom(element.GetChild("instances", 0, "Instances"));
+  GetInitialInstances().UnserializeFrom(element.GetChild("instances", 0, "Instances"));
   editorSettings.UnserializeFrom(element.GetChild("editionSettings"));
   associatedLayout = element.GetStringAttribute("associatedLayout");
 }
 
 void ExternalLayout::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("name", name);
-  instances.SerializeTo(element.AddChild("instances"));
+  GetInitialInstances().SerializeTo(element.AddChild("instances"));
   editorSettings.SerializeTo(element.AddChild("editionSettings"));
   element.SetAttribute("associatedLayout", associatedLayout);
 }
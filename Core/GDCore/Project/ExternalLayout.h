@@ -10,6 +10,7 @@
 
 #include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/CopyOnWrite.h"
 namespace gd {
 class SerializerElement;
 }
@@ -31,6 +32,16 @@ class GD_CORE_API ExternalLayout {
    */
   ExternalLayout* Clone() const { return new ExternalLayout(*this); };
 
+  /**
+   * \brief Return a pointer to a new ExternalLayout constructed from this one,
+   * sharing the initial instances with it until they are modified.
+   *
+   * \warning This external layout must not be modified while the copy is
+   * used.
+   * \see gd::CopyOnWrite
+   */
+  ExternalLayout* CloneWithCopyOnWrite() const;
+
   /**
    * \brief Return the name of the external layout.
    */
@@ -45,13 +56,15 @@ class GD_CORE_API ExternalLayout {
    * \brief Return the container storing initial instances.
    */
   const gd::InitialInstancesContainer& GetInitialInstances() const {
-    return instances;
+    return instances.Get();
   }
 
   /**
    * \brief Return the container storing initial instances.
    */
-  gd::InitialInstancesContainer& GetInitialInstances() { return instances; }
+  gd::InitialInstancesContainer& GetInitialInstances() {
+    return instances.GetMutable();
+  }
 
   /**
    * \brief Get the user settings for the IDE.
@@ -91,7 +104,7 @@ class GD_CORE_API ExternalLayout {
 
  private:
   gd::String name;
-  gd::InitialInstancesContainer instances;
+  gd::CopyOnWrite<gd::InitialInstancesContainer> instances;
   gd::EditorSettings editorSettings;
   gd::String associatedLayout;
 };
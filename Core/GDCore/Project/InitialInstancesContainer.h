@@ -149,7 +149,7 @@ class GD_CORE_API InitialInstancesContainer {
   /**
    * \brief Return true if there is at least one instance of the given object.
    */
-  bool HasInstancesOfObject(const gd::String &objectName);
+  bool HasInstancesOfObject(const gd::String &objectName) const;
 
   /**
    * \brief Remove all instances
@@ -45,6 +45,12 @@ Layout& Layout::operator=(const Layout& other) {
 
 Layout::~Layout(){};
 
+Layout* Layout::CloneWithCopyOnWrite() const {
+  Layout* layout = new Layout;
+  layout->Init(*this, true);
+  return layout;
+}
+
 Layout::Layout()
     : backgroundColorR(209),
       backgroundColorG(209),
@@ -279,7 +285,7 @@ void Layout::SerializeTo(SerializerElement& element) const {
   GetVariables().SerializeTo(element.AddChild("variables"));
   GetInitialInstances().SerializeTo(element.AddChild("instances"));
   SerializeObjectsTo(element.AddChild("objects"));
-  gd::EventsListSerialization::SerializeEventsTo(events,
+  gd::EventsListSerialization::SerializeEventsTo(GetEvents(),
                                                  element.AddChild("events"));
 
   SerializeLayersTo(element.AddChild("layers"));
@@ -343,7 +349,7 @@ void Layout::UnserializeFrom(gd::Project& project,
 #endif
 
   UnserializeObjectsFrom(project, element.GetChild("objects", 0, "Objets"));
-  initialInstances.UnserializeFrom(
+  GetInitialInstances().UnserializeFrom(
       element.GetChild("instances", 0, "Positions"));
   variables.UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
@@ -386,7 +392,7 @@ void Layout::UnserializeFrom(gd::Project& project,
   }
 }
 
-void Layout::Init(const Layout& other) {
+void Layout::Init(const Layout& other, bool copyOnWrite) {
   SetName(other.name);
   backgroundColorR = other.backgroundColorR;
   backgroundColorG = other.backgroundColorG;
@@ -398,7 +404,10 @@ void Layout::Init(const Layout& other) {
   oglZFar = other.oglZFar;
   stopSoundsOnStartup = other.stopSoundsOnStartup;
   disableInputWhenNotFocused = other.disableInputWhenNotFocused;
-  initialInstances = other.initialInstances;
+  if (copyOnWrite)
+    initialInstances.Share(other.initialInstances);
+  else
+    initialInstances = other.initialInstances;
   initialLayers = other.initialLayers;
   variables = other.GetVariables();
 
@@ -411,7 +420,10 @@ void Layout::Init(const Layout& other) {
   }
 
 #if defined(GD_IDE_ONLY)
-  events = other.events;
+  if (copyOnWrite)
+    events.Share(other.events);
+  else
+    events = other.events;
   editorSettings = other.editorSettings;
   objectGroups = other.objectGroups;
 
@@ -17,6 +17,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/CopyOnWrite.h"
 #if defined(GD_IDE_ONLY)
 #include "GDCore/IDE/Dialogs/LayoutEditorCanvas/EditorSettings.h"
 #endif
@@ -50,6 +51,16 @@ class GD_CORE_API Layout : public ObjectsContainer {
    */
   Layout* Clone() const { return new Layout(*this); };
 
+  /**
+   * \brief Return a pointer to a copy of the layout, sharing the events and
+   * the initial instances with this layout until they are modified.
+   *
+   * \warning This layout must not be modified while the copy is used: this is
+   * meant for short lived copies, like the ones modified during an export.
+   * \see gd::CopyOnWrite
+   */
+  Layout* CloneWithCopyOnWrite() const;
+
   /** \name Common properties
    * Members functions related to common properties of layouts
    */
@@ -115,14 +126,14 @@ class GD_CORE_API Layout : public ObjectsContainer {
    * Return the container storing initial instances.
    */
   const gd::InitialInstancesContainer& GetInitialInstances() const {
-    return initialInstances;
+    return initialInstances.Get();
   }
 
   /**
    * Return the container storing initial instances.
    */
   gd::InitialInstancesContainer& GetInitialInstances() {
-    return initialInstances;
+    return initialInstances.GetMutable();
   }
   ///@}
 
@@ -135,12 +146,18 @@ class GD_CORE_API Layout : public ObjectsContainer {
   /**
    * Get the events of the layout
    */
-  const gd::EventsList& GetEvents() const { return events; }
+  const gd::EventsList& GetEvents() const { return events.Get(); }
 
   /**
    * Get the events of the layout
    */
-  gd::EventsList& GetEvents() { return events; }
+  gd::EventsList& GetEvents() { return events.GetMutable(); }
+
+  /**
+   * Remove all the events of the layout (without copying them if they are
+   * shared, see CloneWithCopyOnWrite).
+   */
+  void ClearEvents() { events.Reset(); }
 #endif
   ///@}
 
@@ -415,7 +432,8 @@ class GD_CORE_API Layout : public ObjectsContainer {
   unsigned int backgroundColorB;     ///< Background color Blue component
   gd::String title;                  ///< Title displayed in the window
   gd::VariablesContainer variables;  ///< Variables list
-  gd::InitialInstancesContainer initialInstances;  ///< Initial instances
+  gd::CopyOnWrite<gd::InitialInstancesContainer>
+      initialInstances;                    ///< Initial instances
   std::vector<gd::Layer> initialLayers;            ///< Initial layers
   std::map<gd::String, std::unique_ptr<gd::BehaviorContent>>
       behaviorsSharedData;   ///< Initial shared datas of behaviors
@@ -435,7 +453,7 @@ class GD_CORE_API Layout : public ObjectsContainer {
                            ///< GetBehaviorSharedData can not find the
                            ///< specified behavior shared data.
 #if defined(GD_IDE_ONLY)
-  EventsList events;  ///< Scene events
+  gd::CopyOnWrite<gd::EventsList> events;  ///< Scene events
   gd::EditorSettings editorSettings;
 #endif
 
@@ -447,8 +465,11 @@ class GD_CORE_API Layout : public ObjectsContainer {
   /**
    * Initialize from another layout. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
+   *
+   * \param copyOnWrite If true, the events and the initial instances are
+   * shared with the other layout until they are modified.
    */
-  void Init(const gd::Layout& other);
+  void Init(const gd::Layout& other, bool copyOnWrite = false);
 };
 
 /**
@@ -0,0 +1,55 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/PackedInitialInstances.h"
+
+#include "GDCore/Project/InitialInstance.h"
+
+namespace gd {
+
+void PackedInitialInstances::Pack(gd::InitialInstancesContainer& instances) {
+  std::size_t instancesCount = instances.GetInstancesCount();
+  positions.clear();
+  positions.reserve(instancesCount * 2);
+  angles.clear();
+  angles.reserve(instancesCount);
+  zOrders.clear();
+  zOrders.reserve(instancesCount);
+  layers.clear();
+  layers.reserve(instancesCount);
+  layerNames.Clear();
+  objects.clear();
+  objects.reserve(instancesCount);
+  objectNames.Clear();
+
+  instances.IterateOverInstances(*this);
+
+  layerIndices.clear();
+  objectIndices.clear();
+}
+
+void PackedInitialInstances::operator()(gd::InitialInstance& instance) {
+  positions.push_back(instance.GetX());
+  positions.push_back(instance.GetY());
+  angles.push_back(instance.GetAngle());
+  zOrders.push_back(instance.GetZOrder());
+  layers.push_back(GetNameIndex(instance.GetLayer(), layerNames, layerIndices));
+  objects.push_back(
+      GetNameIndex(instance.GetObjectName(), objectNames, objectIndices));
+}
+
+std::uint32_t PackedInitialInstances::GetNameIndex(
+    const gd::String& name,
+    gd::PackedStrings& names,
+    std::map<gd::String, std::uint32_t>& indices) {
+  auto it = indices.find(name);
+  if (it != indices.end()) return it->second;
+
+  std::uint32_t index = names.Add(name);
+  indices[name] = index;
+  return index;
+}
+
+}  // namespace gd
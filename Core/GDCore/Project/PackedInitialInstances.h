@@ -0,0 +1,108 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PACKEDINITIALINSTANCES_H
+#define GDCORE_PACKEDINITIALINSTANCES_H
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/String.h"
+#include "GDCore/Tools/PackedStrings.h"
+
+namespace gd {
+
+/**
+ * \brief The positions, angles, Z orders, layers and object names of initial
+ * instances, each one stored in a single array.
+ *
+ * This allows the IDE to read the properties of all the instances at once
+ * (with typed arrays on the memory of libGD.js), instead of calling a method
+ * for each property of each instance. Layers and object names are stored as
+ * indices into string tables, where each name is stored once.
+ *
+ * The arrays are a snapshot of the instances when Pack was called: they are
+ * not updated when the instances are modified.
+ *
+ * \see gd::InitialInstancesContainer
+ */
+class GD_CORE_API PackedInitialInstances : private gd::InitialInstanceFunctor {
+ public:
+  PackedInitialInstances(){};
+  virtual ~PackedInitialInstances(){};
+
+  /**
+   * \brief Store the properties of the given instances, replacing the ones
+   * previously stored.
+   */
+  void Pack(gd::InitialInstancesContainer& instances);
+
+  /**
+   * \brief Return the number of instances stored.
+   */
+  std::size_t GetInstancesCount() const { return angles.size(); }
+
+  /**
+   * \brief Return the X and Y positions of the instances (two values for
+   * each instance).
+   */
+  const std::vector<double>& GetPositions() const { return positions; }
+
+  /**
+   * \brief Return the angles of the instances.
+   */
+  const std::vector<double>& GetAngles() const { return angles; }
+
+  /**
+   * \brief Return the Z orders of the instances.
+   */
+  const std::vector<std::int32_t>& GetZOrders() const { return zOrders; }
+
+  /**
+   * \brief Return, for each instance, the index of its layer in the names
+   * returned by GetLayerNames.
+   */
+  const std::vector<std::uint32_t>& GetLayers() const { return layers; }
+
+  /**
+   * \brief Return the names of the layers of the instances.
+   */
+  const gd::PackedStrings& GetLayerNames() const { return layerNames; }
+
+  /**
+   * \brief Return, for each instance, the index of its object name in the
+   * names returned by GetObjectNames.
+   */
+  const std::vector<std::uint32_t>& GetObjects() const { return objects; }
+
+  /**
+   * \brief Return the names of the objects of the instances.
+   */
+  const gd::PackedStrings& GetObjectNames() const { return objectNames; }
+
+ private:
+  virtual void operator()(gd::InitialInstance& instance) override;
+
+  static std::uint32_t GetNameIndex(
+      const gd::String& name,
+      gd::PackedStrings& names,
+      std::map<gd::String, std::uint32_t>& indices);
+
+  std::vector<double> positions;
+  std::vector<double> angles;
+  std::vector<std::int32_t> zOrders;
+  std::vector<std::uint32_t> layers;
+  gd::PackedStrings layerNames;
+  std::vector<std::uint32_t> objects;
+  gd::PackedStrings objectNames;
+
+  std::map<gd::String, std::uint32_t> layerIndices;   ///< Used while packing.
+  std::map<gd::String, std::uint32_t> objectIndices;  ///< Used while packing.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PACKEDINITIALINSTANCES_H
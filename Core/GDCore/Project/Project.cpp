@@ -697,6 +697,14 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 }
 
 void Project::SerializeTo(SerializerElement& element) const {
+  SerializeWithoutLayoutsTo(element);
+
+  gd::SerializerElement& layoutsElement = element.GetChild("layouts");
+  for (std::size_t i = 0; i < GetLayoutsCount(); i++)
+    GetLayout(i).SerializeTo(layoutsElement.AddChild("layout"));
+}
+
+void Project::SerializeWithoutLayoutsTo(SerializerElement& element) const {
   SerializerElement& versionElement = element.AddChild("gdVersion");
   versionElement.SetAttribute("major", gd::VersionWrapper::Major());
   versionElement.SetAttribute("minor", gd::VersionWrapper::Minor());
@@ -769,8 +777,6 @@ void Project::SerializeTo(SerializerElement& element) const {
   element.SetAttribute("firstLayout", firstLayout);
   gd::SerializerElement& layoutsElement = element.AddChild("layouts");
   layoutsElement.ConsiderAsArrayOf("layout");
-  for (std::size_t i = 0; i < GetLayoutsCount(); i++)
-    GetLayout(i).SerializeTo(layoutsElement.AddChild("layout"));
 
   SerializerElement& externalEventsElement = element.AddChild("externalEvents");
   externalEventsElement.ConsiderAsArrayOf("externalEvents");
@@ -821,18 +827,31 @@ void Project::ExposeResources(gd::ArbitraryResourceWorker& worker) {
   worker.ExposeResources(&GetResourcesManager());
   platformSpecificAssets.ExposeResources(worker);
 
-  // Add layouts resources
+  // Add layouts resources (events can be shared with another project, see
+  // CloneWithCopyOnWrite: they are only accessed to be modified if the worker
+  // updates a resource).
   for (std::size_t s = 0; s < GetLayoutsCount(); s++) {
-    for (std::size_t j = 0; j < GetLayout(s).GetObjectsCount();
+    gd::Layout& layout = GetLayout(s);
+    for (std::size_t j = 0; j < layout.GetObjectsCount();
          ++j)  // Add objects resources
-      GetLayout(s).GetObject(j).ExposeResources(worker);
+      layout.GetObject(j).ExposeResources(worker);
 
-    LaunchResourceWorkerOnEvents(*this, GetLayout(s).GetEvents(), worker);
+    const gd::Layout& constLayout = layout;
+    LaunchResourceWorkerOnEvents(
+        *this, constLayout.GetEvents(), worker, [&layout]() -> gd::EventsList& {
+          return layout.GetEvents();
+        });
   }
   // Add external events resources
   for (std::size_t s = 0; s < GetExternalEventsCount(); s++) {
-    LaunchResourceWorkerOnEvents(
-        *this, GetExternalEvents(s).GetEvents(), worker);
+    gd::ExternalEvents& externalEvents = GetExternalEvents(s);
+    const gd::ExternalEvents& constExternalEvents = externalEvents;
+    LaunchResourceWorkerOnEvents(*this,
+                                 constExternalEvents.GetEvents(),
+                                 worker,
+                                 [&externalEvents]() -> gd::EventsList& {
+                                   return externalEvents.GetEvents();
+                                 });
   }
   // Add events functions extensions resources
   for (std::size_t e = 0; e < GetEventsFunctionsExtensionsCount(); e++) {
@@ -909,7 +928,13 @@ Project& Project::operator=(const Project& other) {
   return *this;
 }
 
-void Project::Init(const gd::Project& game) {
+std::unique_ptr<gd::Project> Project::CloneWithCopyOnWrite() const {
+  std::unique_ptr<gd::Project> project(new gd::Project);
+  project->Init(*this, true);
+  return project;
+}
+
+void Project::Init(const gd::Project& game, bool copyOnWrite) {
   name = game.name;
   firstLayout = game.firstLayout;
   version = game.version;
@@ -948,11 +973,25 @@ void Project::Init(const gd::Project& game) {
 
   initialObjects = gd::Clone(game.initialObjects);
 
-  scenes = gd::Clone(game.scenes);
+  if (copyOnWrite) {
+    scenes.clear();
+    for (const auto& scene : game.scenes)
+      scenes.emplace_back(scene->CloneWithCopyOnWrite());
 
-  externalEvents = gd::Clone(game.externalEvents);
+    externalEvents.clear();
+    for (const auto& events : game.externalEvents)
+      externalEvents.emplace_back(events->CloneWithCopyOnWrite());
 
-  externalLayouts = gd::Clone(game.externalLayouts);
+    externalLayouts.clear();
+    for (const auto& externalLayout : game.externalLayouts)
+      externalLayouts.emplace_back(externalLayout->CloneWithCopyOnWrite());
+  } else {
+    scenes = gd::Clone(game.scenes);
+
+    externalEvents = gd::Clone(game.externalEvents);
+
+    externalLayouts = gd::Clone(game.externalLayouts);
+  }
   eventsFunctionsExtensions = gd::Clone(game.eventsFunctionsExtensions);
 
   useExternalSourceFiles = game.useExternalSourceFiles;
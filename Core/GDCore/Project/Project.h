@@ -50,6 +50,19 @@ class GD_CORE_API Project : public ObjectsContainer {
   virtual ~Project();
   Project& operator=(const Project& rhs);
 
+  /**
+   * \brief Return a copy of the project, sharing the events and the initial
+   * instances of its layouts, external layouts and external events until they
+   * are modified.
+   *
+   * This is much faster than copying the project when only a few parts of the
+   * copy are modified, like when the project is exported.
+   *
+   * \warning This project must not be modified while the copy is used.
+   * \see gd::CopyOnWrite
+   */
+  std::unique_ptr<gd::Project> CloneWithCopyOnWrite() const;
+
   /** \name Common properties
    * Some properties for the project
    */
@@ -518,6 +531,15 @@ class GD_CORE_API Project : public ObjectsContainer {
    */
   void SerializeTo(SerializerElement& element) const;
 
+  /**
+   * \brief Serialize the project, except its layouts (the "layouts" array is
+   * left empty).
+   *
+   * This allows to serialize and write the layouts one by one when exporting a
+   * big project, instead of having the whole project serialized in memory.
+   */
+  void SerializeWithoutLayoutsTo(SerializerElement& element) const;
+
   /**
    * Get the major version of GDevelop used to save the project.
    */
@@ -890,8 +912,11 @@ class GD_CORE_API Project : public ObjectsContainer {
   /**
    * Initialize from another game. Used by copy-ctor and assign-op.
    * Don't forget to update me if members were changed!
+   *
+   * \param copyOnWrite If true, the events and the initial instances are
+   * shared with the other project until they are modified.
    */
-  void Init(const gd::Project& project);
+  void Init(const gd::Project& project, bool copyOnWrite = false);
 
   gd::String name;            ///< Game name
   gd::String description;     ///< Game description
@@ -6,9 +6,9 @@
 
 #include "GDCore/Project/ResourcesManager.h"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
-#include <unordered_set>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/Project.h"
@@ -32,6 +32,48 @@ namespace gd {
 
 gd::String Resource::badStr;
 
+Resource::Resource(const Resource& other)
+    : kind(other.kind),
+      name(other.name),
+      metadata(other.metadata),
+      originName(other.originName),
+      originIdentifier(other.originIdentifier),
+      userAdded(other.userAdded),
+      resourcesManager(nullptr) {}
+
+Resource& Resource::operator=(const Resource& other) {
+  if (this != &other) {
+    gd::String oldName = name;
+    gd::String oldOriginName = originName;
+    gd::String oldOriginIdentifier = originIdentifier;
+    kind = other.kind;
+    name = other.name;
+    metadata = other.metadata;
+    originName = other.originName;
+    originIdentifier = other.originIdentifier;
+    userAdded = other.userAdded;
+    NotifyNameChanged(oldName);
+    NotifyOriginChanged(oldOriginName, oldOriginIdentifier);
+  }
+
+  return *this;
+}
+
+void Resource::NotifyNameChanged(const gd::String& oldName) {
+  if (resourcesManager) resourcesManager->OnResourceNameChanged(*this, oldName);
+}
+
+void Resource::NotifyFileChanged(const gd::String& oldFile) {
+  if (resourcesManager) resourcesManager->OnResourceFileChanged(*this, oldFile);
+}
+
+void Resource::NotifyOriginChanged(const gd::String& oldOriginName,
+                                   const gd::String& oldOriginIdentifier) {
+  if (resourcesManager)
+    resourcesManager->OnResourceOriginChanged(
+        *this, oldOriginName, oldOriginIdentifier);
+}
+
 Resource ResourcesManager::badResource;
 gd::String ResourcesManager::badResourceName;
 ResourceFolder ResourcesManager::badFolder;
@@ -47,9 +89,9 @@ void ResourceFolder::Init(const ResourceFolder& other) {
 }
 
 void ResourcesManager::Init(const ResourcesManager& other) {
-  resources.clear();
+  ClearResources();
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
-    resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
+    PushBackResource(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
   folders.clear();
   for (std::size_t i = 0; i < other.folders.size(); ++i) {
@@ -57,20 +99,159 @@ void ResourcesManager::Init(const ResourcesManager& other) {
   }
 }
 
-Resource& ResourcesManager::GetResource(const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
+void ResourcesManager::ClearResources() {
+  for (auto& resource : resources)
+    if (resource && resource->resourcesManager == this)
+      resource->resourcesManager = nullptr;
+
+  resources.clear();
+  positionsByName.clear();
+  positionsByFile.clear();
+  positionsByOrigin.clear();
+}
+
+void ResourcesManager::PushBackResource(std::shared_ptr<Resource> resource) {
+  resource->resourcesManager = this;
+  resources.push_back(resource);
+  IndexResource(resources.size() - 1);
+}
+
+namespace {
+
+/**
+ * \brief Insert a position in a sorted list of positions.
+ */
+void AddPosition(std::vector<std::size_t>& positions, std::size_t position) {
+  positions.insert(
+      std::lower_bound(positions.begin(), positions.end(), position),
+      position);
+}
+
+/**
+ * \brief Remove a position from the sorted list of positions stored for a key,
+ * removing the key if no positions are left.
+ */
+template <class Map>
+void RemovePosition(Map& positionsByKey,
+                    const gd::String& key,
+                    std::size_t position) {
+  auto it = positionsByKey.find(key);
+  if (it == positionsByKey.end()) return;
+
+  auto& positions = it->second;
+  auto positionIt =
+      std::lower_bound(positions.begin(), positions.end(), position);
+  if (positionIt != positions.end() && *positionIt == position)
+    positions.erase(positionIt);
+  if (positions.empty()) positionsByKey.erase(it);
+}
+
+/**
+ * \brief Shift the positions of a sorted list, keeping it sorted.
+ */
+void ShiftPositions(std::vector<std::size_t>& positions,
+                    std::size_t fromPosition,
+                    int offset) {
+  for (auto it = std::lower_bound(positions.begin(), positions.end(),
+                                  fromPosition);
+       it != positions.end();
+       ++it)
+    *it += offset;
+}
+
+}  // namespace
+
+void ResourcesManager::IndexResource(std::size_t position) {
+  const auto& resource = resources[position];
+  if (!resource) return;
+
+  AddPosition(positionsByName[resource->GetName()], position);
+  AddPosition(positionsByFile[NormalizePathSeparator(resource->GetFile())],
+              position);
+  AddPosition(positionsByOrigin[resource->GetOriginName()]
+                               [resource->GetOriginIdentifier()],
+              position);
+}
+
+void ResourcesManager::UnindexResource(std::size_t position) {
+  const auto& resource = resources[position];
+  if (!resource) return;
+
+  RemovePosition(positionsByName, resource->GetName(), position);
+  RemovePosition(
+      positionsByFile, NormalizePathSeparator(resource->GetFile()), position);
+  auto originNameIt = positionsByOrigin.find(resource->GetOriginName());
+  if (originNameIt != positionsByOrigin.end()) {
+    RemovePosition(
+        originNameIt->second, resource->GetOriginIdentifier(), position);
+    if (originNameIt->second.empty()) positionsByOrigin.erase(originNameIt);
   }
+}
 
-  return badResource;
+void ResourcesManager::ShiftIndexedPositions(std::size_t fromPosition,
+                                             int offset) {
+  for (auto& it : positionsByName) ShiftPositions(it.second, fromPosition, offset);
+  for (auto& it : positionsByFile) ShiftPositions(it.second, fromPosition, offset);
+  for (auto& originNameIt : positionsByOrigin)
+    for (auto& it : originNameIt.second)
+      ShiftPositions(it.second, fromPosition, offset);
 }
 
-const Resource& ResourcesManager::GetResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
+std::size_t ResourcesManager::GetResourcePosition(
+    const gd::Resource& resource, const gd::String& name) const {
+  auto it = positionsByName.find(name);
+  if (it == positionsByName.end()) return gd::String::npos;
+
+  for (std::size_t position : it->second)
+    if (resources[position].get() == &resource) return position;
+
+  return gd::String::npos;
+}
+
+void ResourcesManager::OnResourceNameChanged(const gd::Resource& resource,
+                                             const gd::String& oldName) {
+  std::size_t position = GetResourcePosition(resource, oldName);
+  if (position == gd::String::npos) return;
+
+  RemovePosition(positionsByName, oldName, position);
+  AddPosition(positionsByName[resource.GetName()], position);
+}
+
+void ResourcesManager::OnResourceFileChanged(const gd::Resource& resource,
+                                             const gd::String& oldFile) {
+  std::size_t position = GetResourcePosition(resource, resource.GetName());
+  if (position == gd::String::npos) return;
+
+  RemovePosition(positionsByFile, NormalizePathSeparator(oldFile), position);
+  AddPosition(positionsByFile[NormalizePathSeparator(resource.GetFile())],
+              position);
+}
+
+void ResourcesManager::OnResourceOriginChanged(
+    const gd::Resource& resource,
+    const gd::String& oldOriginName,
+    const gd::String& oldOriginIdentifier) {
+  std::size_t position = GetResourcePosition(resource, resource.GetName());
+  if (position == gd::String::npos) return;
+
+  auto originNameIt = positionsByOrigin.find(oldOriginName);
+  if (originNameIt != positionsByOrigin.end()) {
+    RemovePosition(originNameIt->second, oldOriginIdentifier, position);
+    if (originNameIt->second.empty()) positionsByOrigin.erase(originNameIt);
   }
+  AddPosition(positionsByOrigin[resource.GetOriginName()]
+                               [resource.GetOriginIdentifier()],
+              position);
+}
 
-  return badResource;
+Resource& ResourcesManager::GetResource(const gd::String& name) {
+  std::size_t position = GetResourcePosition(name);
+  return position != gd::String::npos ? *resources[position] : badResource;
+}
+
+const Resource& ResourcesManager::GetResource(const gd::String& name) const {
+  std::size_t position = GetResourcePosition(name);
+  return position != gd::String::npos ? *resources[position] : badResource;
 }
 
 std::shared_ptr<Resource> ResourcesManager::CreateResource(
@@ -93,38 +274,26 @@ std::shared_ptr<Resource> ResourcesManager::CreateResource(
 }
 
 bool ResourcesManager::HasResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return true;
-  }
-
-  return false;
+  return GetResourcePosition(name) != gd::String::npos;
 }
 
 const gd::String& ResourcesManager::GetResourceNameWithOrigin(
     const gd::String& originName, const gd::String& originIdentifier) const {
-  for (const auto& resource : resources) {
-    if (!resource) continue;
+  auto originNameIt = positionsByOrigin.find(originName);
+  if (originNameIt == positionsByOrigin.end()) return badResourceName;
 
-    if (resource->GetOriginName() == originName &&
-        resource->GetOriginIdentifier() == originIdentifier) {
-      return resource->GetName();
-    }
-  }
+  auto it = originNameIt->second.find(originIdentifier);
+  if (it == originNameIt->second.end()) return badResourceName;
 
-  return badResourceName;
+  return resources[it->second.front()]->GetName();
 }
 
 const gd::String& ResourcesManager::GetResourceNameWithFile(
     const gd::String& file) const {
-  for (const auto& resource : resources) {
-    if (!resource) continue;
+  auto it = positionsByFile.find(NormalizePathSeparator(file));
+  if (it == positionsByFile.end()) return badResourceName;
 
-    if (resource->GetFile() == file) {
-      return resource->GetName();
-    }
-  }
-
-  return badResourceName;
+  return resources[it->second.front()]->GetName();
 }
 
 std::vector<gd::String> ResourcesManager::GetAllResourceNames() const {
@@ -137,15 +306,10 @@ std::vector<gd::String> ResourcesManager::GetAllResourceNames() const {
 
 std::vector<gd::String> ResourcesManager::FindFilesNotInResources(
     const std::vector<gd::String>& filePathsToCheck) const {
-  std::unordered_set<gd::String> resourceFilePaths;
-  for (const auto& resource : resources) {
-    resourceFilePaths.insert(NormalizePathSeparator(resource->GetFile()));
-  }
-
   std::vector<gd::String> filePathsNotInResources;
   for (const gd::String& file : filePathsToCheck) {
     gd::String normalizedPath = NormalizePathSeparator(file);
-    if (resourceFilePaths.find(normalizedPath) == resourceFilePaths.end())
+    if (positionsByFile.find(normalizedPath) == positionsByFile.end())
       filePathsNotInResources.push_back(file);
   }
 
@@ -210,7 +374,7 @@ bool ResourcesManager::AddResource(const gd::Resource& resource) {
       std::shared_ptr<Resource>(resource.Clone());
   if (newResource == std::shared_ptr<Resource>()) return false;
 
-  resources.push_back(newResource);
+  PushBackResource(newResource);
   return true;
 }
 
@@ -223,7 +387,7 @@ bool ResourcesManager::AddResource(const gd::String& name,
   res->SetFile(filename);
   res->SetName(name);
 
-  resources.push_back(res);
+  PushBackResource(res);
 
   return true;
 }
@@ -300,19 +464,25 @@ bool ResourceFolder::MoveResourceDownInList(const gd::String& name) {
 }
 
 bool ResourcesManager::MoveResourceUpInList(const gd::String& name) {
-  return gd::MoveResourceUpInList(resources, name);
+  std::size_t index = GetResourcePosition(name);
+  if (index == gd::String::npos || index == 0) return false;
+
+  MoveResource(index, index - 1);
+  return true;
 }
 
 bool ResourcesManager::MoveResourceDownInList(const gd::String& name) {
-  return gd::MoveResourceDownInList(resources, name);
+  std::size_t index = GetResourcePosition(name);
+  if (index == gd::String::npos || index + 1 >= resources.size()) return false;
+
+  MoveResource(index, index + 1);
+  return true;
 }
 
 std::size_t ResourcesManager::GetResourcePosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  auto it = positionsByName.find(name);
+  return it != positionsByName.end() ? it->second.front() : gd::String::npos;
 }
 
 void ResourcesManager::MoveResource(std::size_t oldIndex,
@@ -320,8 +490,12 @@ void ResourcesManager::MoveResource(std::size_t oldIndex,
   if (oldIndex >= resources.size() || newIndex >= resources.size()) return;
 
   auto resource = resources[oldIndex];
+  UnindexResource(oldIndex);
   resources.erase(resources.begin() + oldIndex);
+  ShiftIndexedPositions(oldIndex + 1, -1);
+  ShiftIndexedPositions(newIndex, 1);
   resources.insert(resources.begin() + newIndex, resource);
+  IndexResource(newIndex);
 }
 
 bool ResourcesManager::MoveFolderUpInList(const gd::String& name) {
@@ -348,11 +522,9 @@ bool ResourcesManager::MoveFolderDownInList(const gd::String& name) {
 
 std::shared_ptr<gd::Resource> ResourcesManager::GetResourceSPtr(
     const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return resources[i];
-  }
-
-  return std::shared_ptr<gd::Resource>();
+  std::size_t position = GetResourcePosition(name);
+  return position != gd::String::npos ? resources[position]
+                                      : std::shared_ptr<gd::Resource>();
 }
 
 bool ResourcesManager::HasFolder(const gd::String& name) const {
@@ -438,9 +610,12 @@ void ResourceFolder::RemoveResource(const gd::String& name) {
 void ResourcesManager::RemoveResource(const gd::String& name) {
   for (std::size_t i = 0; i < resources.size();) {
     if (resources[i] != std::shared_ptr<Resource>() &&
-        resources[i]->GetName() == name)
+        resources[i]->GetName() == name) {
+      UnindexResource(i);
+      resources[i]->resourcesManager = nullptr;
       resources.erase(resources.begin() + i);
-    else
+      ShiftIndexedPositions(i + 1, -1);
+    } else
       ++i;
   }
 
@@ -474,7 +649,7 @@ void ResourceFolder::SerializeTo(SerializerElement& element) const {
 }
 
 void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
-  resources.clear();
+  ClearResources();
   const SerializerElement& resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
@@ -498,7 +673,7 @@ void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
     }
     resource->UnserializeFrom(resourceElement);
 
-    resources.push_back(resource);
+    PushBackResource(resource);
   }
 
   folders.clear();
@@ -543,7 +718,9 @@ void ResourcesManager::SerializeTo(SerializerElement& element) const {
 }
 
 void ImageResource::SetFile(const gd::String& newFile) {
+  gd::String oldFile = file;
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged(oldFile);
 }
 
 void ImageResource::UnserializeFrom(const SerializerElement& element) {
@@ -561,7 +738,9 @@ void ImageResource::SerializeTo(SerializerElement& element) const {
 }
 
 void AudioResource::SetFile(const gd::String& newFile) {
+  gd::String oldFile = file;
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged(oldFile);
 }
 
 void AudioResource::UnserializeFrom(const SerializerElement& element) {
@@ -579,7 +758,9 @@ void AudioResource::SerializeTo(SerializerElement& element) const {
 }
 
 void FontResource::SetFile(const gd::String& newFile) {
+  gd::String oldFile = file;
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged(oldFile);
 }
 
 void FontResource::UnserializeFrom(const SerializerElement& element) {
@@ -593,7 +774,9 @@ void FontResource::SerializeTo(SerializerElement& element) const {
 }
 
 void VideoResource::SetFile(const gd::String& newFile) {
+  gd::String oldFile = file;
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged(oldFile);
 }
 
 void VideoResource::UnserializeFrom(const SerializerElement& element) {
@@ -607,7 +790,9 @@ void VideoResource::SerializeTo(SerializerElement& element) const {
 }
 
 void JsonResource::SetFile(const gd::String& newFile) {
+  gd::String oldFile = file;
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged(oldFile);
 }
 
 void JsonResource::UnserializeFrom(const SerializerElement& element) {
@@ -641,7 +826,9 @@ bool JsonResource::UpdateProperty(const gd::String& name,
 }
 
 void BitmapFontResource::SetFile(const gd::String& newFile) {
+  gd::String oldFile = file;
   file = NormalizePathSeparator(newFile);
+  NotifyFileChanged(oldFile);
 }
 
 void BitmapFontResource::UnserializeFrom(const SerializerElement& element) {
@@ -672,12 +859,8 @@ ResourcesManager& ResourcesManager::operator=(const ResourcesManager& other) {
   return *this;
 }
 
-ResourcesManager::ResourcesManager() {
-  // ctor
-}
+ResourcesManager::ResourcesManager() {}
 
-ResourcesManager::~ResourcesManager() {
-  // dtor
-}
+ResourcesManager::~ResourcesManager() { ClearResources(); }
 
 }  // namespace gd
@@ -7,12 +7,14 @@
 #define GDCORE_RESOURCESMANAGER_H
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/String.h"
 namespace gd {
 class Project;
 class ResourceFolder;
+class ResourcesManager;
 class SerializerElement;
 class PropertyDescriptor;
 }  // namespace gd
@@ -26,13 +28,19 @@ namespace gd {
  */
 class GD_CORE_API Resource {
  public:
-  Resource(){};
+  Resource() : resourcesManager(nullptr){};
+  Resource(const Resource& other);
+  Resource& operator=(const Resource& other);
   virtual ~Resource(){};
   virtual Resource* Clone() const { return new Resource(*this); }
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String& name_) { name = name_; }
+  virtual void SetName(const gd::String& name_) {
+    gd::String oldName = name;
+    name = name_;
+    NotifyNameChanged(oldName);
+  }
 
   /** \brief Return the name of the resource.
    */
@@ -83,8 +91,11 @@ class GD_CORE_API Resource {
    * TODO: make a ResourceOrigin object?
    */
   virtual void SetOrigin(const gd::String& originName_, const gd::String& originIdentifier_) {
+    gd::String oldOriginName = originName;
+    gd::String oldOriginIdentifier = originIdentifier;
     originName = originName_;
     originIdentifier = originIdentifier_;
+    NotifyOriginChanged(oldOriginName, oldOriginIdentifier);
   }
 
   virtual const gd::String& GetOriginName() const { return originName; }
@@ -146,7 +157,29 @@ class GD_CORE_API Resource {
    */
   virtual void UnserializeFrom(const SerializerElement& element){};
 
+ protected:
+  /**
+   * \brief Must be called when the name of the resource is changed, so that
+   * the resources manager containing it (if any) updates its indexes.
+   */
+  void NotifyNameChanged(const gd::String& oldName);
+
+  /**
+   * \brief Must be called when the file of the resource is changed, so that
+   * the resources manager containing it (if any) updates its indexes.
+   */
+  void NotifyFileChanged(const gd::String& oldFile);
+
+  /**
+   * \brief Must be called when the origin of the resource is changed, so that
+   * the resources manager containing it (if any) updates its indexes.
+   */
+  void NotifyOriginChanged(const gd::String& oldOriginName,
+                           const gd::String& oldOriginIdentifier);
+
  private:
+  friend class ResourcesManager;
+
   gd::String kind;
   gd::String name;
   gd::String metadata;
@@ -154,6 +187,10 @@ class GD_CORE_API Resource {
   gd::String originIdentifier;
   bool userAdded;  ///< True if the resource was added by the user, and not
                    ///< automatically by GDevelop.
+  gd::ResourcesManager* resourcesManager;  ///< The resources manager
+                                           ///< containing the resource, if
+                                           ///< any. Not copied with the
+                                           ///< resource.
 
   static gd::String badStr;
 };
@@ -391,6 +428,11 @@ class GD_CORE_API BitmapFontResource : public Resource {
 /**
  * \brief Inventory all resources used by a project
  *
+ * Resources are indexed by name, by file and by origin, so that they can be
+ * found without going through all the resources. Indexes are updated when a
+ * resource is added, removed, moved or modified, and are never modified by
+ * lookups (so that these can be done concurrently).
+ *
  * \see Resource
  * \ingroup ResourcesManagement
  */
@@ -415,6 +457,8 @@ class GD_CORE_API ResourcesManager {
   /**
    * \brief Return the name of the first resource with the given file, if any.
    * If not found, an empty string is returned.
+   *
+   * \note Path separators are normalized before comparing files.
    */
   const gd::String& GetResourceNameWithFile(const gd::String& file) const;
 
@@ -549,11 +593,64 @@ class GD_CORE_API ResourcesManager {
   void UnserializeFrom(const SerializerElement& element);
 
  private:
+  friend class Resource;
+
   void Init(const ResourcesManager& other);
 
+  /**
+   * \brief Remove the resources, detaching them from the manager.
+   */
+  void ClearResources();
+
+  /**
+   * \brief Add a resource at the end of the list, updating the indexes.
+   */
+  void PushBackResource(std::shared_ptr<Resource> resource);
+
+  /**
+   * \brief Add the resource at the given position to the indexes.
+   */
+  void IndexResource(std::size_t position);
+
+  /**
+   * \brief Remove the resource at the given position from the indexes.
+   */
+  void UnindexResource(std::size_t position);
+
+  /**
+   * \brief Add the given offset to the indexed positions that are greater
+   * than or equal to \a fromPosition.
+   */
+  void ShiftIndexedPositions(std::size_t fromPosition, int offset);
+
+  /**
+   * \brief Return the position of the given resource, searching it among the
+   * resources named \a name.
+   */
+  std::size_t GetResourcePosition(const gd::Resource& resource,
+                                  const gd::String& name) const;
+
+  void OnResourceNameChanged(const gd::Resource& resource,
+                             const gd::String& oldName);
+  void OnResourceFileChanged(const gd::Resource& resource,
+                             const gd::String& oldFile);
+  void OnResourceOriginChanged(const gd::Resource& resource,
+                               const gd::String& oldOriginName,
+                               const gd::String& oldOriginIdentifier);
+
   std::vector<std::shared_ptr<Resource> > resources;
   std::vector<ResourceFolder> folders;
 
+  std::unordered_map<gd::String, std::vector<std::size_t>>
+      positionsByName;  ///< Sorted positions of the resources, by name.
+  std::unordered_map<gd::String, std::vector<std::size_t>>
+      positionsByFile;  ///< Sorted positions of the resources, by normalized
+                        ///< file.
+  std::unordered_map<gd::String,
+                     std::unordered_map<gd::String, std::vector<std::size_t>>>
+      positionsByOrigin;  ///< Sorted positions of the resources, by origin
+                          ///< name and then origin identifier.
+
   static ResourceFolder badFolder;
   static Resource badResource;
   static gd::String badResourceName;
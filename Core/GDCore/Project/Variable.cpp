@@ -6,6 +6,7 @@
 
 #include "GDCore/Project/Variable.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "GDCore/Serialization/SerializerElement.h"
@@ -16,6 +17,8 @@ using namespace std;
 namespace gd {
 
 gd::Variable Variable::badVariable;
+const Variable::NamedChildren Variable::noNamedChildren;
+const std::vector<std::shared_ptr<Variable>> Variable::noIndexedChildren;
 
 gd::String Variable::TypeAsString(Type t) {
   switch (t) {
@@ -62,28 +65,40 @@ void Variable::CastTo(const Type newType) {
   else if (newType == Type::Boolean)
     SetBool(GetBool());
   else if (newType == Type::Structure) {
-    children.clear();
+    Children& allChildren = GetOrCreateChildren();
+    allChildren.named.clear();
 
     // Conversion is only possible for non primitive types
-    if (type == Type::Array)
-      for (auto i = childrenArray.begin(); i != childrenArray.end(); ++i)
-        children.insert(
-            std::make_pair(gd::String::From(i - childrenArray.begin()), (*i)));
+    if (type == Type::Array) {
+      allChildren.named.reserve(allChildren.indexed.size());
+      for (std::size_t i = 0; i < allChildren.indexed.size(); ++i)
+        allChildren.named.push_back(
+            std::make_pair(gd::String::From(i), allChildren.indexed[i]));
+      std::sort(allChildren.named.begin(),
+                allChildren.named.end(),
+                [](const NamedChildren::value_type& a,
+                   const NamedChildren::value_type& b) {
+                  return a.first < b.first;
+                });
+    }
 
     type = Type::Structure;
     // Free now unused memory
-    childrenArray.clear();
+    std::vector<std::shared_ptr<Variable>>().swap(allChildren.indexed);
   } else if (newType == Type::Array) {
-    childrenArray.clear();
+    Children& allChildren = GetOrCreateChildren();
+    allChildren.indexed.clear();
 
     // Conversion is only possible for non primitive types
-    if (type == Type::Structure)
-      for (auto i = children.begin(); i != children.end(); ++i)
-        childrenArray.push_back((*i).second);
+    if (type == Type::Structure) {
+      allChildren.indexed.reserve(allChildren.named.size());
+      for (auto& child : allChildren.named)
+        allChildren.indexed.push_back(child.second);
+    }
 
     type = Type::Array;
     // Free now unused memory
-    children.clear();
+    NamedChildren().swap(allChildren.named);
   }
 }
 
@@ -126,8 +141,26 @@ bool Variable::GetBool() const {
   return false;
 }
 
+Variable::NamedChildren::iterator Variable::FindNamedChild(
+    const gd::String& name) const {
+  NamedChildren& named = GetOrCreateChildren().named;
+  // Children are often added in order (when unserialized for example).
+  if (named.empty() || named.back().first < name) return named.end();
+
+  return std::lower_bound(
+      named.begin(),
+      named.end(),
+      name,
+      [](const NamedChildren::value_type& child, const gd::String& name) {
+        return child.first < name;
+      });
+}
+
 bool Variable::HasChild(const gd::String& name) const {
-  return type == Type::Structure && children.find(name) != children.end();
+  if (type != Type::Structure || !children) return false;
+
+  auto it = FindNamedChild(name);
+  return it != children->named.end() && it->first == name;
 }
 
 /**
@@ -137,12 +170,13 @@ bool Variable::HasChild(const gd::String& name) const {
  * the specified child, an empty variable is returned.
  */
 Variable& Variable::GetChild(const gd::String& name) {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
+  auto it = FindNamedChild(name);
+  if (it != children->named.end() && it->first == name) return *it->second;
 
   type = Type::Structure;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return *children->named
+              .insert(it, std::make_pair(name, std::make_shared<gd::Variable>()))
+              ->second;
 }
 
 /**
@@ -152,17 +186,18 @@ Variable& Variable::GetChild(const gd::String& name) {
  * the specified child, an empty variable is returned.
  */
 const Variable& Variable::GetChild(const gd::String& name) const {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
+  auto it = FindNamedChild(name);
+  if (it != children->named.end() && it->first == name) return *it->second;
 
   type = Type::Structure;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return *children->named
+              .insert(it, std::make_pair(name, std::make_shared<gd::Variable>()))
+              ->second;
 }
 
 void Variable::RemoveChild(const gd::String& name) {
-  if (type != Type::Structure) return;
-  children.erase(name);
+  if (!HasChild(name)) return;
+  children->named.erase(FindNamedChild(name));
 }
 
 bool Variable::RenameChild(const gd::String& oldName,
@@ -170,29 +205,32 @@ bool Variable::RenameChild(const gd::String& oldName,
   if (type != Type::Structure || !HasChild(oldName) || HasChild(newName))
     return false;
 
-  children[newName] = children[oldName];
-  children.erase(oldName);
+  auto oldIt = FindNamedChild(oldName);
+  std::shared_ptr<Variable> child = oldIt->second;
+  children->named.erase(oldIt);
+  children->named.insert(FindNamedChild(newName), std::make_pair(newName, child));
 
   return true;
 }
 
 Variable& Variable::GetAtIndex(const size_t index) {
   type = Type::Array;
-  while (childrenArray.size() <= index)
-    childrenArray.push_back(std::make_shared<gd::Variable>());
-  return *childrenArray[index];
+  auto& indexed = GetOrCreateChildren().indexed;
+  while (indexed.size() <= index)
+    indexed.push_back(std::make_shared<gd::Variable>());
+  return *indexed[index];
 };
 
 const Variable& Variable::GetAtIndex(const size_t index) const {
-  if (childrenArray.size() <= index) return badVariable;
-  return *childrenArray.at(index);
+  if (!children || children->indexed.size() <= index) return badVariable;
+  return *children->indexed.at(index);
 };
 
 Variable& Variable::PushNew() { return GetAtIndex(GetChildrenCount()); };
 
 void Variable::RemoveAtIndex(const size_t index) {
-  if (index >= childrenArray.size()) return;
-  childrenArray.erase(childrenArray.begin() + index);
+  if (!children || index >= children->indexed.size()) return;
+  children->indexed.erase(children->indexed.begin() + index);
 };
 
 void Variable::SerializeTo(SerializerElement& element) const {
@@ -207,15 +245,15 @@ void Variable::SerializeTo(SerializerElement& element) const {
   } else if (type == Type::Structure) {
     SerializerElement& childrenElement = element.AddChild("children");
     childrenElement.ConsiderAsArrayOf("variable");
-    for (auto i = children.begin(); i != children.end(); ++i) {
+    for (auto& child : GetAllChildren()) {
       SerializerElement& variableElement = childrenElement.AddChild("variable");
-      variableElement.SetAttribute("name", i->first);
-      i->second->SerializeTo(variableElement);
+      variableElement.SetAttribute("name", child.first);
+      child.second->SerializeTo(variableElement);
     }
   } else if (type == Type::Array) {
     SerializerElement& childrenElement = element.AddChild("children");
     childrenElement.ConsiderAsArrayOf("variable");
-    for (auto child : childrenArray) {
+    for (auto& child : GetAllChildrenArray()) {
       child->SerializeTo(childrenElement.AddChild("variable"));
     }
   }
@@ -249,12 +287,21 @@ void Variable::UnserializeFrom(const SerializerElement& element) {
     childrenElement.ConsiderAsArrayOf("variable", "Variable");
     if (childrenElement.GetChildrenCount() == 0) return;
 
+    Children& allChildren = GetOrCreateChildren();
+    if (type == Type::Structure)
+      allChildren.named.reserve(allChildren.named.size() +
+                                childrenElement.GetChildrenCount());
+    else if (type == Type::Array)
+      allChildren.indexed.reserve(allChildren.indexed.size() +
+                                  childrenElement.GetChildrenCount());
+
     for (int i = 0; i < childrenElement.GetChildrenCount(); ++i) {
       const SerializerElement& childElement = childrenElement.GetChild(i);
       if (type == Type::Structure) {
         gd::String name = childElement.GetStringAttribute("name", "", "Name");
-        children[name] = std::make_shared<gd::Variable>();
-        children[name]->UnserializeFrom(childElement);
+        Variable& child = GetChild(name);
+        child = Variable();
+        child.UnserializeFrom(childElement);
       } else if (type == Type::Array)
         PushNew().UnserializeFrom(childElement);
     }
@@ -263,7 +310,8 @@ void Variable::UnserializeFrom(const SerializerElement& element) {
 
 std::vector<gd::String> Variable::GetAllChildrenNames() const {
   std::vector<gd::String> names;
-  for (auto& it : children) {
+  names.reserve(GetAllChildren().size());
+  for (auto& it : GetAllChildren()) {
     names.push_back(it.first);
   }
 
@@ -272,11 +320,11 @@ std::vector<gd::String> Variable::GetAllChildrenNames() const {
 
 bool Variable::Contains(const gd::Variable& variableToSearch,
                         bool recursive) const {
-  for (auto& it : children) {
+  for (auto& it : GetAllChildren()) {
     if (it.second.get() == &variableToSearch) return true;
     if (recursive && it.second->Contains(variableToSearch, true)) return true;
   }
-  for (auto& it : childrenArray) {
+  for (auto& it : GetAllChildrenArray()) {
     if (it.get() == &variableToSearch) return true;
     if (recursive && it->Contains(variableToSearch, true)) return true;
   }
@@ -285,17 +333,21 @@ bool Variable::Contains(const gd::Variable& variableToSearch,
 }
 
 void Variable::RemoveRecursively(const gd::Variable& variableToRemove) {
-  for (auto it = children.begin(); it != children.end();) {
+  if (!children) return;
+
+  auto& named = children->named;
+  for (auto it = named.begin(); it != named.end();) {
     if (it->second.get() == &variableToRemove)
-      it = children.erase(it);
+      it = named.erase(it);
     else {
       it->second->RemoveRecursively(variableToRemove);
       it++;
     }
   }
-  for (auto it = childrenArray.begin(); it != childrenArray.end();)
+  auto& indexed = children->indexed;
+  for (auto it = indexed.begin(); it != indexed.end();)
     if (it->get() == &variableToRemove)
-      childrenArray.erase(it);
+      it = indexed.erase(it);
     else {
       (*it)->RemoveRecursively(variableToRemove);
       it++;
@@ -303,19 +355,19 @@ void Variable::RemoveRecursively(const gd::Variable& variableToRemove) {
 }
 
 Variable::Variable(const Variable& other)
-    : value(other.value),
-      str(other.str),
-      boolVal(other.boolVal),
-      type(other.type) {
+    : type(other.type), value(other.value), str(other.str) {
+  if (other.type == Type::Boolean) boolVal = other.boolVal;
   CopyChildren(other);
 }
 
 Variable& Variable::operator=(const Variable& other) {
   if (this != &other) {
-    value = other.value;
-    str = other.str;
-    boolVal = other.boolVal;
     type = other.type;
+    if (other.type == Type::Boolean)
+      boolVal = other.boolVal;
+    else
+      value = other.value;
+    str = other.str;
     CopyChildren(other);
   }
 
@@ -323,12 +375,23 @@ Variable& Variable::operator=(const Variable& other) {
 }
 
 void Variable::CopyChildren(const gd::Variable& other) {
-  children.clear();
-  for (auto& it : other.children) {
-    children[it.first] = std::make_shared<gd::Variable>(*it.second);
+  if (!other.children) {
+    children.reset();
+    return;
+  }
+
+  // Children are copied in vectors allocated once, keeping the order of the
+  // names so that no search is needed.
+  std::unique_ptr<Children> newChildren(new Children);
+  newChildren->named.reserve(other.children->named.size());
+  for (auto& it : other.children->named) {
+    newChildren->named.push_back(
+        std::make_pair(it.first, std::make_shared<gd::Variable>(*it.second)));
   }
-  for (auto child : other.childrenArray) {
-    childrenArray.push_back(std::make_shared<gd::Variable>(*child.get()));
+  newChildren->indexed.reserve(other.children->indexed.size());
+  for (auto& child : other.children->indexed) {
+    newChildren->indexed.push_back(std::make_shared<gd::Variable>(*child));
   }
+  children = std::move(newChildren);
 }
 }  // namespace gd
@@ -6,10 +6,10 @@
 
 #ifndef GDCORE_VARIABLE_H
 #define GDCORE_VARIABLE_H
-#include <map>
+#include <cmath>
 #include <memory>
+#include <utility>
 #include <vector>
-#include <cmath>
 
 #include "GDCore/String.h"
 namespace gd {
@@ -28,6 +28,12 @@ namespace gd {
  */
 class GD_CORE_API Variable {
  public:
+  /**
+   * \brief The children of a structure, sorted by name.
+   */
+  typedef std::vector<std::pair<gd::String, std::shared_ptr<Variable>>>
+      NamedChildren;
+
   static gd::Variable badVariable;
   enum Type {
     // Primitive types
@@ -48,7 +54,7 @@ class GD_CORE_API Variable {
   /**
    * \brief Default constructor creating a variable with 0 as value.
    */
-  Variable() : value(0), type(Type::Number){};
+  Variable() : type(Type::Number), value(0){};
   Variable(const Variable&);
   virtual ~Variable(){};
 
@@ -176,18 +182,16 @@ class GD_CORE_API Variable {
   /**
    * \brief Remove all the children.
    */
-  void ClearChildren() {
-    children.clear();
-    childrenArray.clear();
-  };
+  void ClearChildren() { children.reset(); };
 
   /**
    * \brief Get the count of children that the variable has.
    */
   size_t GetChildrenCount() const {
+    if (!children) return 0;
     return type == Type::Structure
-               ? children.size()
-               : type == Type::Array ? childrenArray.size() : 0;
+               ? children->named.size()
+               : type == Type::Array ? children->indexed.size() : 0;
   };
 
   /** \name Structure
@@ -239,11 +243,10 @@ class GD_CORE_API Variable {
   std::vector<gd::String> GetAllChildrenNames() const;
 
   /**
-   * \brief Get the map containing all the children.
+   * \brief Get all the children, sorted by name.
    */
-  const std::map<gd::String, std::shared_ptr<Variable>>& GetAllChildren()
-      const {
-    return children;
+  const NamedChildren& GetAllChildren() const {
+    return children ? children->named : noNamedChildren;
   }
 
   /**
@@ -294,7 +297,7 @@ class GD_CORE_API Variable {
    * \brief Get the vector containing all the children.
    */
   const std::vector<std::shared_ptr<Variable>>& GetAllChildrenArray() const {
-    return childrenArray;
+    return children ? children->indexed : noIndexedChildren;
   }
   ///@}
   ///@}
@@ -325,21 +328,48 @@ class GD_CORE_API Variable {
    */
   static Type StringAsType(const gd::String& str);
 
-  mutable Type type;
-  mutable gd::String str;
-  mutable double value;
-  mutable bool boolVal;
-  mutable std::map<gd::String, std::shared_ptr<Variable>>
-      children;  ///< Children, when the variable is considered as a structure.
-  mutable std::vector<std::shared_ptr<Variable>>
-      childrenArray;  ///< Children, when the variable is considered as an
-                      ///< array.
+  /**
+   * \brief The children of a variable, only allocated for variables used as
+   * structures or arrays.
+   */
+  struct Children {
+    NamedChildren named;  ///< Children, when the variable is considered as a
+                          ///< structure.
+    std::vector<std::shared_ptr<Variable>>
+        indexed;  ///< Children, when the variable is considered as an array.
+  };
+
+  /**
+   * \brief Return the children, allocating them if needed.
+   */
+  Children& GetOrCreateChildren() const {
+    if (!children) children.reset(new Children);
+    return *children;
+  }
+
+  /**
+   * \brief Return the position of the child with the specified name, or the
+   * position where it should be inserted.
+   */
+  NamedChildren::iterator FindNamedChild(const gd::String& name) const;
 
   /**
    * Initialize children by copying them from another variable.  Used by
    * copy-ctor and assign-op.
    */
   void CopyChildren(const Variable& other);
+
+  static const NamedChildren noNamedChildren;
+  static const std::vector<std::shared_ptr<Variable>> noIndexedChildren;
+
+  mutable Type type;
+  union {
+    double value;  ///< The value, when the variable is a number.
+    bool boolVal;  ///< The value, when the variable is a boolean.
+  };
+  mutable gd::String str;  ///< The value, when the variable is a string, or
+                           ///< the value converted to a string otherwise.
+  mutable std::unique_ptr<Children> children;
 };
 
 }  // namespace gd
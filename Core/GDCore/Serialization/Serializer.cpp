@@ -6,14 +6,19 @@
 
 #include "GDCore/Serialization/Serializer.h"
 
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/Utf8Scanner.h"
 #include "rapidjson/document.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/rapidjson.h"
@@ -227,4 +232,276 @@ gd::String Serializer::ToJSON(const SerializerElement& element) {
   return buffer.GetString();  // Temporary copy
 }
 
+namespace {
+const char binaryHeader[] = {'G', 'D', 'S', 'E', 1};  // Magic and version.
+
+enum BinaryElementFlags { HasValue = 1 << 0, IsArray = 1 << 1 };
+
+enum BinaryValueType {
+  UnknownValue = 0,
+  FalseValue = 1,
+  TrueValue = 2,
+  StringValue = 3,
+  IntValue = 4,
+  DoubleValue = 5
+};
+
+class BinaryWriter {
+ public:
+  BinaryWriter(std::string& output_) : output(output_){};
+
+  void WriteElement(const gd::SerializerElement& element) {
+    bool isArray = element.ConsideredAsArray();
+    output.push_back((element.IsValueUndefined() ? 0 : HasValue) |
+                     (isArray ? IsArray : 0));
+    if (!element.IsValueUndefined()) WriteValue(element.GetValue());
+    if (isArray) WriteName(element.ConsideredAsArrayOf());
+
+    const auto& attributes = element.GetAllAttributes();
+    WriteVarint(attributes.size());
+    for (const auto& attribute : attributes) {
+      WriteName(attribute.first);
+      WriteValue(attribute.second);
+    }
+
+    // Children of an array all have the same name (see
+    // SerializerElement::AddChild), so it's not written for each of them.
+    const auto& children = element.GetAllChildren();
+    std::size_t childrenCount = 0;
+    for (const auto& child : children)
+      if (child.second) childrenCount++;
+
+    WriteVarint(childrenCount);
+    for (const auto& child : children) {
+      if (!child.second) continue;
+      if (!isArray) WriteName(child.first);
+      WriteElement(*child.second);
+    }
+  }
+
+ private:
+  void WriteVarint(std::uint64_t value) {
+    while (value >= 0x80) {
+      output.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+  }
+
+  void WriteString(const gd::String& str) {
+    WriteVarint(str.Raw().size());
+    output.append(str.Raw());
+  }
+
+  /**
+   * \brief Write the index of a name, preceded by the name itself the first
+   * time it's used (index 0 meaning that a new name follows).
+   */
+  void WriteName(const gd::String& name) {
+    auto it = namesIndices.find(name);
+    if (it != namesIndices.end()) {
+      WriteVarint(it->second);
+      return;
+    }
+
+    WriteVarint(0);
+    WriteString(name);
+    std::size_t index = namesIndices.size() + 1;
+    namesIndices[name] = index;
+  }
+
+  void WriteValue(const gd::SerializerValue& value) {
+    if (value.IsBoolean()) {
+      output.push_back(value.GetBool() ? TrueValue : FalseValue);
+    } else if (value.IsString()) {
+      output.push_back(StringValue);
+      WriteString(value.GetRawString());
+    } else if (value.IsInt()) {
+      output.push_back(IntValue);
+      std::int64_t intValue = value.GetInt();
+      WriteVarint((static_cast<std::uint64_t>(intValue) << 1) ^
+                  static_cast<std::uint64_t>(intValue >> 63));  // Zigzag.
+    } else if (value.IsDouble()) {
+      output.push_back(DoubleValue);
+      double doubleValue = value.GetDouble();
+      std::uint64_t bits;
+      memcpy(&bits, &doubleValue, sizeof(bits));
+      for (int i = 0; i < 8; ++i)
+        output.push_back(static_cast<char>((bits >> (i * 8)) & 0xff));
+    } else {
+      output.push_back(UnknownValue);
+      WriteString(value.GetString());
+    }
+  }
+
+  std::string& output;
+  std::unordered_map<gd::String, std::size_t> namesIndices;
+};
+
+class BinaryReader {
+ public:
+  BinaryReader(const char* data, std::size_t size)
+      : position(reinterpret_cast<const unsigned char*>(data)),
+        end(position + size){};
+
+  bool ReadHeader() {
+    if (static_cast<std::size_t>(end - position) < sizeof(binaryHeader) ||
+        memcmp(position, binaryHeader, sizeof(binaryHeader)) != 0)
+      return false;
+
+    position += sizeof(binaryHeader);
+    return true;
+  }
+
+  bool ReadElement(gd::SerializerElement& element, std::size_t depth = 0) {
+    // Refuse too deeply nested elements rather than overflowing the stack
+    // when reading an invalid (or malicious) buffer.
+    if (depth > maxDepth || position >= end) return false;
+    unsigned char flags = *position++;
+
+    if (flags & HasValue) {
+      gd::SerializerValue value;
+      if (!ReadValue(value)) return false;
+      element.SetValue(value);
+    }
+
+    const gd::String* arrayOf = nullptr;
+    if (flags & IsArray) {
+      if (!ReadName(arrayOf)) return false;
+      element.ConsiderAsArrayOf(*arrayOf);
+    }
+
+    std::uint64_t attributesCount;
+    if (!ReadVarint(attributesCount)) return false;
+    for (std::uint64_t i = 0; i < attributesCount; ++i) {
+      const gd::String* name;
+      gd::SerializerValue value;
+      if (!ReadName(name) || !ReadValue(value)) return false;
+
+      if (value.IsBoolean())
+        element.SetAttribute(*name, value.GetBool());
+      else if (value.IsInt())
+        element.SetAttribute(*name, value.GetInt());
+      else if (value.IsDouble())
+        element.SetAttribute(*name, value.GetDouble());
+      else
+        element.SetAttribute(*name, value.GetRawString());
+    }
+
+    std::uint64_t childrenCount;
+    if (!ReadVarint(childrenCount)) return false;
+    for (std::uint64_t i = 0; i < childrenCount; ++i) {
+      const gd::String* name = arrayOf;
+      if (!arrayOf && !ReadName(name)) return false;
+      if (!ReadElement(element.AddChild(*name), depth + 1)) return false;
+    }
+
+    return true;
+  }
+
+ private:
+  bool ReadVarint(std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (position >= end) return false;
+      unsigned char byte = *position++;
+      value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+
+    return false;
+  }
+
+  bool ReadString(gd::String& str) {
+    std::uint64_t length;
+    if (!ReadVarint(length) ||
+        length > static_cast<std::uint64_t>(end - position))
+      return false;
+
+    // Validate the string in the buffer, then copy it once into its
+    // destination (strings can contain NUL characters).
+    const char* data = reinterpret_cast<const char*>(position);
+    if (!gd::Utf8Scanner::IsValid(data, length)) return false;
+
+    str.Raw().assign(data, length);
+    position += length;
+    return true;
+  }
+
+  bool ReadName(const gd::String*& name) {
+    std::uint64_t index;
+    if (!ReadVarint(index)) return false;
+
+    if (index == 0) {
+      names.emplace_back();
+      if (!ReadString(names.back())) return false;
+      name = &names.back();
+      return true;
+    }
+
+    if (index > names.size()) return false;
+    name = &names[index - 1];
+    return true;
+  }
+
+  bool ReadValue(gd::SerializerValue& value) {
+    if (position >= end) return false;
+    unsigned char type = *position++;
+
+    if (type == FalseValue || type == TrueValue) {
+      value.SetBool(type == TrueValue);
+    } else if (type == StringValue || type == UnknownValue) {
+      gd::String str;
+      if (!ReadString(str)) return false;
+      if (type == StringValue)
+        value.SetString(str);
+      else
+        value.Set(str);
+    } else if (type == IntValue) {
+      std::uint64_t zigzag;
+      if (!ReadVarint(zigzag)) return false;
+      value.SetInt(static_cast<int>(static_cast<std::int64_t>(zigzag >> 1) ^
+                                    -static_cast<std::int64_t>(zigzag & 1)));
+    } else if (type == DoubleValue) {
+      if (end - position < 8) return false;
+      std::uint64_t bits = 0;
+      for (int i = 0; i < 8; ++i)
+        bits |= static_cast<std::uint64_t>(position[i]) << (i * 8);
+      position += 8;
+
+      double doubleValue;
+      memcpy(&doubleValue, &bits, sizeof(doubleValue));
+      value.SetDouble(doubleValue);
+    } else {
+      return false;
+    }
+
+    return true;
+  }
+
+  static constexpr std::size_t maxDepth = 1024;
+
+  const unsigned char* position;
+  const unsigned char* end;
+  std::deque<gd::String> names;  ///< A deque so that references stay valid.
+};
+}  // namespace
+
+std::string Serializer::ToBinary(const SerializerElement& element) {
+  std::string output(binaryHeader, sizeof(binaryHeader));
+  BinaryWriter writer(output);
+  writer.WriteElement(element);
+
+  return output;
+}
+
+SerializerElement Serializer::FromBinary(const char* data, std::size_t size) {
+  SerializerElement element;
+  BinaryReader reader(data, size);
+  if (!reader.ReadHeader() || !reader.ReadElement(element))
+    return SerializerElement();
+
+  return element;
+}
+
 }  // namespace gd
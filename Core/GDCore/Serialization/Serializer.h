@@ -57,6 +57,51 @@ class GD_CORE_API Serializer {
   }
   ///@}
 
+  /** \name Binary serialization.
+   * Convert a gd::SerializerElement from/to a compact binary format, faster
+   * to write and read than JSON (for example for snapshots of a project).
+   *
+   * The format starts with a header ("GDSE" followed by a version byte).
+   * Then each element is written as: a byte of flags (value, array), its
+   * value (if any), the name of the array children (if an array), its
+   * attributes and its children. Names are interned: a name is written the
+   * first time it's used, then referred to by its index. Numbers are written
+   * as variable-length integers and strings are prefixed by their length.
+   *
+   * \note The format is not meant to be stored in project files: it can
+   * change from one version of GDevelop to another (in which case FromBinary
+   * returns an empty element for data written with another version).
+   *
+   * \note These functions are not exposed to JavaScript yet: binary buffers
+   * can't go through the DOMString of the bindings, as they can contain NUL
+   * characters and bytes that are not valid UTF8.
+   */
+  ///@{
+  /**
+   * \brief Serialize a gd::SerializerElement to a binary buffer.
+   */
+  static std::string ToBinary(const SerializerElement& element);
+
+  /**
+   * \brief Construct a gd::SerializerElement from a binary buffer (as
+   * returned by ToBinary).
+   *
+   * The buffer is read in place (so it can be a memory mapped file): only
+   * the strings are copied, once, into the element which owns them. An empty
+   * element is returned if the buffer is invalid (including strings not
+   * valid in UTF8 or elements nested more than 1024 levels deep).
+   */
+  static SerializerElement FromBinary(const char* data, std::size_t size);
+
+  /**
+   * \brief Construct a gd::SerializerElement from a binary buffer (as
+   * returned by ToBinary).
+   */
+  static SerializerElement FromBinary(const std::string& binary) {
+    return FromBinary(binary.data(), binary.size());
+  }
+  ///@}
+
   virtual ~Serializer(){};
 
  private:
@@ -11,42 +11,78 @@
 
 #include <SFML/System/String.hpp>
 #include "GDCore/CommonTools.h"
+#include "GDCore/Tools/Utf8Scanner.h"
 #include "GDCore/Utf8/utf8proc.h"
 
 namespace gd
 {
 
 constexpr String::size_type String::npos;
+constexpr String::size_type String::nonAsciiFlag;
 
-String::String() : m_string()
+String::String() : m_string(), m_codePointsCount(0)
 {
 
 }
 
-String::String(const char *characters) : m_string()
+String::String(const char *characters) : m_string(), m_codePointsCount(0)
 {
     *this = characters;
 }
 
-String::String(const sf::String &string) : m_string()
+String::String(const sf::String &string) : m_string(), m_codePointsCount(0)
 {
     *this = string;
 }
 
-String::String(const std::u32string &string) : m_string()
+String::String(const std::u32string &string) : m_string(), m_codePointsCount(0)
 {
     *this = string;
 }
 
+String::String(const String &other) :
+    m_string(other.m_string),
+    m_codePointsCount(other.m_codePointsCount.load(std::memory_order_relaxed))
+{
+
+}
+
+String::String(String &&other) noexcept :
+    m_string(std::move(other.m_string)),
+    m_codePointsCount(other.m_codePointsCount.load(std::memory_order_relaxed))
+{
+    //The moved string is left empty, with a length consistent with it.
+    other.clear();
+}
+
 String& String::operator=(const char *characters)
 {
     m_string = std::string(characters);
+    InvalidateCodePointsCount();
+    return *this;
+}
+
+String& String::operator=(const String &other)
+{
+    m_string = other.m_string;
+    m_codePointsCount.store(other.m_codePointsCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+String& String::operator=(String &&other) noexcept
+{
+    if(this != &other)
+    {
+        m_string = std::move(other.m_string);
+        m_codePointsCount.store(other.m_codePointsCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        other.clear();
+    }
     return *this;
 }
 
 String& String::operator=(const sf::String &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -66,7 +102,7 @@ String& String::operator=(const sf::String &string)
 
 String& String::operator=(const std::u32string &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -86,7 +122,59 @@ String& String::operator=(const std::u32string &string)
 
 String::size_type String::size() const
 {
-    return std::distance(begin(), end());
+    return GetCodePointsCountAndFlag() & ~nonAsciiFlag;
+}
+
+String::size_type String::GetCodePointsCountAndFlag() const
+{
+    //Count the characters only once, until the string is modified.
+    size_type codePointsCountAndFlag = m_codePointsCount.load(std::memory_order_relaxed);
+    if(codePointsCountAndFlag == npos)
+    {
+        codePointsCountAndFlag = Utf8Scanner::CountCodePoints(m_string.data(), m_string.size());
+        //Having as many characters as bytes is not enough: a byte that is not valid UTF8 is
+        //counted as a character.
+        if(codePointsCountAndFlag != m_string.size() ||
+           !Utf8Scanner::IsAscii(m_string.data(), m_string.size()))
+            codePointsCountAndFlag |= nonAsciiFlag;
+        m_codePointsCount.store(codePointsCountAndFlag, std::memory_order_relaxed);
+    }
+
+    return codePointsCountAndFlag;
+}
+
+String::size_type String::GetByteOffset( String::size_type pos ) const
+{
+    size_type codePointsCount = size();
+    if(pos > codePointsCount)
+        return npos;
+
+    if(pos == codePointsCount)
+        return m_string.size();
+
+    //Positions in characters and in bytes are the same in ASCII strings.
+    if(IsAscii())
+        return pos;
+
+    return Utf8Scanner::GetByteOffset(m_string.data(), m_string.size(), pos);
+}
+
+String::size_type String::GetByteOffset( String::size_type startByteOffset, String::size_type len ) const
+{
+    //Count the characters from the start position, stopping at the end of the string
+    if(len == npos)
+        return m_string.size();
+    if(IsAscii())
+        return len < m_string.size() - startByteOffset ? startByteOffset + len : m_string.size();
+
+    size_type offset = Utf8Scanner::GetByteOffset(
+        m_string.data() + startByteOffset, m_string.size() - startByteOffset, len);
+    return offset != npos ? startByteOffset + offset : m_string.size();
+}
+
+String::size_type String::GetCodePointIndex( String::size_type byteOffset ) const
+{
+    return IsAscii() ? byteOffset : Utf8Scanner::GetCodePointIndex(m_string.data(), byteOffset);
 }
 
 String::iterator String::begin()
@@ -225,7 +313,7 @@ std::wstring String::ToWide() const
 
 bool String::IsValid() const
 {
-    return ::utf8::is_valid(m_string.begin(), m_string.end());
+    return Utf8Scanner::IsValid(m_string.data(), m_string.size());
 }
 
 String& String::ReplaceInvalid( value_type replacement )
@@ -234,26 +322,39 @@ String& String::ReplaceInvalid( value_type replacement )
     ::utf8::replace_invalid(m_string.begin(), m_string.end(), std::back_inserter(validStr), replacement);
 
     m_string = validStr;
+    InvalidateCodePointsCount();
 
     return *this;
 }
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
-    const_iterator it = begin();
-    std::advance(it, position);
-    return *it;
+    if(IsAscii())
+        return static_cast<unsigned char>(m_string[position]);
+
+    return *const_iterator(m_string.begin() + GetByteOffset(position));
 }
 
 String& String::operator+=( const String &other )
 {
+    //Keep the length if both lengths are known (the result is ASCII only if both are).
+    size_type codePointsCount = m_codePointsCount.load(std::memory_order_relaxed);
+    size_type otherCodePointsCount = other.m_codePointsCount.load(std::memory_order_relaxed);
+
     m_string += other.m_string;
+    m_codePointsCount.store(
+        codePointsCount != npos && otherCodePointsCount != npos ?
+            ((codePointsCount & ~nonAsciiFlag) + (otherCodePointsCount & ~nonAsciiFlag)) |
+            ((codePointsCount | otherCodePointsCount) & nonAsciiFlag) :
+            npos,
+        std::memory_order_relaxed);
     return *this;
 }
 
 String& String::operator+=( const char *other )
 {
     m_string += other;
+    InvalidateCodePointsCount();
     return *this;
 }
 
@@ -266,20 +367,29 @@ String& String::operator+=( value_type character )
 void String::push_back( String::value_type character )
 {
     ::utf8::unchecked::append(character, std::back_inserter(m_string));
+
+    size_type codePointsCount = m_codePointsCount.load(std::memory_order_relaxed);
+    if(codePointsCount != npos)
+        m_codePointsCount.store(
+            (codePointsCount + 1) | (character >= 0x80 ? nonAsciiFlag : 0),
+            std::memory_order_relaxed);
 }
 
 void String::pop_back()
 {
     m_string.erase((--end()).base(), end().base());
+    InvalidateCodePointsCount();
 }
 
 String& String::insert( size_type pos, const String &str )
 {
-    iterator it = begin();
-    std::advance(it, pos);
+    //Use the real position as bytes
+    size_type byteOffset = GetByteOffset(pos);
+    if(byteOffset == npos)
+        throw std::out_of_range("[gd::String::insert] pos greater than size");
 
-    //Use the real position as bytes using the std::string::iterators
-    m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    m_string.insert( byteOffset, str.m_string );
+    InvalidateCodePointsCount();
 
     return *this;
 }
@@ -323,6 +433,7 @@ String& String::RemoveConsecutiveOccurrences(iterator i1, iterator i2, const cha
 String& String::replace( iterator i1, iterator i2, const String &str )
 {
     m_string.replace(i1.base(), i2.base(), str.m_string);
+    InvalidateCodePointsCount();
 
     return *this;
 }
@@ -330,72 +441,61 @@ String& String::replace( iterator i1, iterator i2, const String &str )
 String& String::replace( iterator i1, iterator i2, size_type n, const char c )
 {
     m_string.replace(i1.base(), i2.base(), n, c);
+    InvalidateCodePointsCount();
 
     return *this;
 }
 
 String& String::replace( String::size_type pos, String::size_type len, const char c )
 {
-    if(pos > size())
+    size_type startByteOffset = GetByteOffset(pos);
+    if(startByteOffset == npos)
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
+    //Stop after "len" characters or if the end is reached
+    size_type endByteOffset = GetByteOffset(startByteOffset, len);
+    m_string.replace(startByteOffset, endByteOffset - startByteOffset, 1, c);
+    InvalidateCodePointsCount();
 
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
-
-    return replace( i1, i2, 1, c );
+    return *this;
 }
 
 String& String::replace( String::size_type pos, String::size_type len, const String &str )
 {
-    if(pos > size())
+    size_type startByteOffset = GetByteOffset(pos);
+    if(startByteOffset == npos)
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
-
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
+    //Stop after "len" characters or if the end is reached
+    size_type endByteOffset = GetByteOffset(startByteOffset, len);
+    m_string.replace(startByteOffset, endByteOffset - startByteOffset, str.m_string);
+    InvalidateCodePointsCount();
 
-    return replace( i1, i2, str );
+    return *this;
 }
 
 String::iterator String::erase( String::iterator first, String::iterator last )
 {
+    InvalidateCodePointsCount();
     return iterator( m_string.erase( first.base(), last.base() ) );
 }
 
 String::iterator String::erase( String::iterator p )
 {
+    InvalidateCodePointsCount();
     return iterator( m_string.erase( p.base() ) );
 }
 
 void String::erase( String::size_type pos, String::size_type len )
 {
-    if(pos > size())
+    size_type startByteOffset = GetByteOffset(pos);
+    if(startByteOffset == npos)
         throw std::out_of_range("[gd::String::erase] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance(i1, pos);
-
-    iterator i2 = i1;
-    while(i2 != end() && len != 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        len--;
-    }
-
-    erase( i1, i2 );
+    //Stop after "len" characters or if the end is reached
+    size_type endByteOffset = GetByteOffset(startByteOffset, len);
+    m_string.erase(startByteOffset, endByteOffset - startByteOffset);
+    InvalidateCodePointsCount();
 }
 
 std::vector<String> String::Split( String::value_type delimiter ) const
@@ -481,6 +581,7 @@ String& String::Normalize(String::NormForm form)
         newStr = utf8proc_NFKC((unsigned char*)m_string.c_str());
 
     m_string = (char*)newStr;
+    InvalidateCodePointsCount();
 
     free(newStr);
 
@@ -491,50 +592,33 @@ String String::substr( String::size_type start, String::size_type length ) const
 {
     String str;
 
-    const_iterator startIt = begin();
-    while(start > 0 && startIt != end())
-    {
-        ++startIt;
-        --start;
-    }
-    if(start > 0) //We reach the end of the string before the start position
+    size_type startByteOffset = GetByteOffset(start);
+    if(startByteOffset == npos) //We reach the end of the string before the start position
         throw std::out_of_range("[gd::String::substr] starting pos greater than size");
 
-    const_iterator endIt = startIt;
-    while(length > 0 && endIt != end())
-    {
-        ++endIt;
-        --length;
-    }
-
-    str.m_string = std::string( startIt.base(), endIt.base() );
+    size_type endByteOffset = GetByteOffset(startByteOffset, length);
+    str.m_string = m_string.substr( startByteOffset, endByteOffset - startByteOffset );
+    //A part of an ASCII string is an ASCII string.
+    str.m_codePointsCount.store(IsAscii() ? str.m_string.size() : npos, std::memory_order_relaxed);
 
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
-    const_iterator it = begin();
-
     //Move to pos
-    if(pos < size())
-        std::advance( it, pos );
-    else
+    size_type startByteOffset = GetByteOffset(pos);
+    if(startByteOffset == npos || startByteOffset == m_string.size())
         return npos;
 
     //Use the standard std::string to find a string (using their internal std::strings).
-    //Use the raw std::string iterator to get the offset as a **byte** count for the starting
-    //position.
-    std::string::size_type findPos =
-        m_string.find( search.m_string, std::distance( m_string.begin(), it.base() ) );
+    //The starting position is a **byte** count.
+    std::string::size_type findPos = m_string.find( search.m_string, startByteOffset );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator from the std::string::iterator pointing to the find result.
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance in **characters** count (that's why we need a String::iterator).
-        return std::distance( begin(), findPosIt );
+        //Return the distance in **characters** count.
+        return GetCodePointIndex( findPos );
     }
     else
         return npos;
@@ -552,32 +636,21 @@ String::size_type String::find( const String::value_type search, String::size_ty
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
-    //Move to pos + 1 (we will then get the last byte of the character at pos)
-    const_iterator it = begin();
-    std::string::const_iterator baseIt;
-    if( pos < size() ) //little optimization by testing npos directly (avoid calculating size())
-    {
-        std::advance( it, pos + 1 );
-        baseIt = it.base();
-        --baseIt; //Decrement the std::string::iterator by one because we need
-        //it to point to the last byte of the character at pos
-    }
+    //Find the start of the character after pos (we will then get the last byte of the
+    //character at pos)
+    size_type nextByteOffset = pos != npos ? GetByteOffset(pos + 1) : npos;
 
     //The last character is included, so we need to put the position
     //of the last byte of the character at the position "pos"
     std::string::size_type findPos = m_string.rfind( search.m_string,
-        pos < size() ? std::distance( m_string.begin(), baseIt ) : std::string::npos
+        nextByteOffset != npos ? nextByteOffset - 1 : std::string::npos
         );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator to the find position to be able to get the real
-        //distance as characters count (it would be a distance as bytes count
+        //Return the distance as characters count (it would be a distance as bytes count
         //with a std::string::iterator)
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance (which is a distance as characters count)
-        return std::distance( begin(), findPosIt );
+        return GetCodePointIndex( findPos );
     }
     else
         return npos;
@@ -598,17 +671,19 @@ namespace priv
     String::size_type find_first_of( const String &str, const String &match,
         String::size_type startPos, bool not_of )
     {
-        String::const_iterator it = str.begin();
-        if(startPos < str.size())
-            std::advance( it, startPos );
-        else
+        String::size_type startByteOffset = Utf8Scanner::GetByteOffset(
+            str.Raw().data(), str.Raw().size(), startPos);
+        if(startByteOffset == String::npos || startByteOffset == str.Raw().size())
             return String::npos;
 
-        for( ; it != str.end(); ++it )
+        String::size_type pos = startPos;
+        std::string::const_iterator it = str.Raw().begin() + startByteOffset;
+        for( ; it != str.Raw().end(); ++pos )
         {
             //Search the current char in the match string
-            if( ( std::find( match.begin(), match.end(), (*it) ) != match.end() ) != not_of )
-                return std::distance( str.begin(), it );
+            String::value_type codepoint = ::utf8::unchecked::next(it);
+            if( ( std::find( match.begin(), match.end(), codepoint ) != match.end() ) != not_of )
+                return pos;
         }
 
         return String::npos;
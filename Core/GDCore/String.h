@@ -7,6 +7,7 @@
 #ifndef GDCORE_UTF8_STRING_H
 #define GDCORE_UTF8_STRING_H
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -126,6 +127,10 @@ public:
      */
     String(const sf::String &string);
 
+    String(const String &other);
+
+    String(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -150,6 +155,10 @@ public:
 
     String& operator=(const std::u32string &string);
 
+    String& operator=(const String &other);
+
+    String& operator=(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -166,6 +175,10 @@ public:
 
     /**
      * \brief Returns the string's length.
+     *
+     * The characters are counted without being decoded, see gd::Utf8Scanner.
+     * The length is then kept until the string is modified, so calling it again
+     * is constant time.
      */
     size_type size() const;
 
@@ -179,7 +192,7 @@ public:
      *
      * **Iterators :** Obviously, all iterators are invalidated.
      */
-    void clear() { m_string.clear(); }
+    void clear() { m_string.clear(); m_codePointsCount.store(0, std::memory_order_relaxed); }
 
     void reserve(gd::String::size_type size) { m_string.reserve(size); }
 
@@ -369,15 +382,31 @@ public:
     /**
      * \brief Returns the code point at the specified position
      * \warning This operator has a linear complexity on the character's
-     * position. You should avoid to use it in a loop and use the iterators
-     * provided by this class instead.
+     * position (even if bytes are scanned by blocks, see gd::Utf8Scanner).
+     * You should avoid to use it in a loop and use the iterators provided by
+     * this class instead.
      */
     value_type operator[]( const size_type position ) const;
 
+    /**
+     * \brief Returns true if the string is only made of ASCII characters.
+     *
+     * Positions in ASCII strings are the same in characters and in bytes, so
+     * operator[](), find(), substr()... are faster on them.
+     *
+     * \note This is checked on the bytes (see gd::Utf8Scanner::IsAscii): a
+     * string with a byte that is not valid UTF8 is not ASCII, even if it has as
+     * many characters as bytes.
+     */
+    bool IsAscii() const { return (GetCodePointsCountAndFlag() & nonAsciiFlag) == 0; }
+
     /**
      * \brief Get the raw UTF8-encoded std::string
+     *
+     * \warning Don't keep the returned reference to modify the string after
+     * using other methods of the String: its length would not be updated.
      */
-    std::string& Raw() { return m_string; }
+    std::string& Raw() { InvalidateCodePointsCount(); return m_string; }
 
     /**
      * \brief Get the raw UTF8-encoded std::string
@@ -567,7 +596,7 @@ public:
      * \brief Removes the specified characters (by default all the "whitespaces" and line breaks) from the beginning of the string,
      * and return the new string.
      */
-    String LeftTrim(const gd::String& chars = " \t\n\v\f\r")
+    String LeftTrim(const gd::String& chars = " \t\n\v\f\r") const
     {
         String trimmedString(*this);
         trimmedString.erase(0, trimmedString.find_first_not_of(chars));
@@ -578,7 +607,7 @@ public:
      * \brief Removes the specified characters (by default all the "whitespaces" and line breaks) from the end of the string,
      * and return the new string.
      */
-    String RightTrim(const gd::String& chars = " \t\n\v\f\r")
+    String RightTrim(const gd::String& chars = " \t\n\v\f\r") const
     {
         String trimmedString(*this);
         trimmedString.erase(trimmedString.find_last_not_of(chars) + 1);
@@ -589,7 +618,7 @@ public:
      * \brief Removes the specified characters (by default all the "whitespaces" and line breaks) from the
      * beginning and the end of the string and return the new string.
      */
-    String Trim(const gd::String& chars = " \t\n\v\f\r")
+    String Trim(const gd::String& chars = " \t\n\v\f\r") const
     {
         return LeftTrim(chars).RightTrim(chars);
     }
@@ -703,7 +732,44 @@ public:
  */
 
 private:
+    /**
+     * \return the position, in bytes, of the character at **pos**, or npos if **pos** is
+     * greater than the size.
+     */
+    size_type GetByteOffset( size_type pos ) const;
+
+    /**
+     * \return the position, in bytes, of the character **len** characters after the one
+     * starting at **startByteOffset** (the end of the string if there are not enough characters).
+     */
+    size_type GetByteOffset( size_type startByteOffset, size_type len ) const;
+
+    /**
+     * \return the position, in characters, of the character starting at the position
+     * **byteOffset** in bytes.
+     */
+    size_type GetCodePointIndex( size_type byteOffset ) const;
+
+    /**
+     * \return the number of characters, with nonAsciiFlag set if the string is not only
+     * made of ASCII characters (computing and storing them if the string was modified).
+     */
+    size_type GetCodePointsCountAndFlag() const;
+
+    /**
+     * \brief Forget the length of the string, to be called when the string is modified.
+     */
+    void InvalidateCodePointsCount() { m_codePointsCount.store(npos, std::memory_order_relaxed); }
+
     std::string m_string; ///< Internal std::string container
+    mutable std::atomic<size_type> m_codePointsCount; ///< The number of characters, with
+                                                      ///< nonAsciiFlag set if the string is
+                                                      ///< not ASCII, or npos if not computed
+                                                      ///< since the last modification. Atomic
+                                                      ///< so that strings can be read from
+                                                      ///< several threads.
+
+    static constexpr size_type nonAsciiFlag = ~(npos >> 1); ///< The highest bit of m_codePointsCount.
 
 };
 
@@ -882,7 +948,8 @@ namespace std
  * The UTF8 encoding has the advantage to reduce the RAM consumption compared to UTF16 or UTF32 for strings using a lot
  * of latin characters. But the characters variable length brings some performance issues compared to fixed size encoding.
  * That's why the complexity of each methods is written in their documentation. For instance, the size() method is linear
- * on the string size and so is the operator[]().
+ * on the string size and so is the operator[](). To reduce their cost, the positions in characters are converted
+ * to positions in bytes by scanning the bytes by blocks, using SIMD instructions when available (see gd::Utf8Scanner).
  *
  * \section Conversion Conversions from/to other string types
  * The String handles implicit conversion with sf::String (implicit constructor and implicit conversion
@@ -0,0 +1,97 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_COPYONWRITE_H
+#define GDCORE_COPYONWRITE_H
+
+#include <memory>
+
+namespace gd {
+
+/**
+ * \brief Hold a value that can be shared with a copy of its owner, and that is
+ * copied only when the copy modifies it.
+ *
+ * Copying a gd::CopyOnWrite copies the value, like any member (assigning
+ * a gd::CopyOnWrite assigns its value in place, so that references to it stay
+ * valid). Call Share instead to share the value of another gd::CopyOnWrite:
+ * the value is then copied the first time GetMutable is called on the sharing
+ * gd::CopyOnWrite.
+ *
+ * The shared value is never copied by the gd::CopyOnWrite it was shared from
+ * (so that references to it stay valid): it must not be modified while other
+ * gd::CopyOnWrite are sharing it. This is meant for short lived copies, like
+ * the copies of a project modified during an export.
+ */
+template <class T>
+class CopyOnWrite {
+ public:
+  CopyOnWrite() : value(std::make_shared<T>()), shared(false){};
+  CopyOnWrite(const CopyOnWrite<T>& other)
+      : value(std::make_shared<T>(other.Get())), shared(false){};
+  CopyOnWrite<T>& operator=(const CopyOnWrite<T>& other) {
+    if (this == &other) return *this;
+
+    if (shared) {
+      // The value is owned by another gd::CopyOnWrite: don't modify it.
+      value = std::make_shared<T>(other.Get());
+      shared = false;
+    } else {
+      *value = other.Get();
+    }
+    return *this;
+  }
+
+  /**
+   * \brief Share the value of another gd::CopyOnWrite, until GetMutable is
+   * called.
+   */
+  void Share(const CopyOnWrite<T>& other) {
+    value = other.value;
+    shared = true;
+  }
+
+  /**
+   * \brief Return the value, to be read.
+   */
+  const T& Get() const { return *value; }
+
+  /**
+   * \brief Return the value, to be modified (copying it if it's shared).
+   */
+  T& GetMutable() {
+    if (shared) {
+      if (value.use_count() > 1) value = std::make_shared<T>(*value);
+      shared = false;
+    }
+    return *value;
+  }
+
+  /**
+   * \brief Replace the value by a default constructed one (without copying the
+   * value if it's shared).
+   */
+  void Reset() {
+    if (shared) {
+      value = std::make_shared<T>();
+      shared = false;
+    } else {
+      *value = T();
+    }
+  }
+
+  /**
+   * \brief Return true if the value is shared with another gd::CopyOnWrite.
+   */
+  bool IsShared() const { return shared && value.use_count() > 1; }
+
+ private:
+  std::shared_ptr<T> value;
+  bool shared;  ///< True if the value was shared from another gd::CopyOnWrite.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_COPYONWRITE_H
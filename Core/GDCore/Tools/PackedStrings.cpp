@@ -0,0 +1,41 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/PackedStrings.h"
+
+namespace gd {
+
+PackedStrings::PackedStrings(const std::vector<gd::String>& strings) {
+  std::size_t size = 0;
+  for (const gd::String& str : strings) size += str.Raw().size() + 1;
+
+  data.reserve(size);
+  offsets.reserve(strings.size());
+  for (const gd::String& str : strings) Add(str);
+}
+
+std::size_t PackedStrings::Add(const gd::String& str) {
+  offsets.push_back(data.size());
+  data.insert(data.end(), str.Raw().begin(), str.Raw().end());
+  data.push_back('\0');
+
+  return offsets.size() - 1;
+}
+
+void PackedStrings::Clear() {
+  data.clear();
+  offsets.clear();
+}
+
+gd::String PackedStrings::Get(std::size_t index) const {
+  if (index >= offsets.size()) return "";
+
+  std::size_t end =
+      index + 1 < offsets.size() ? offsets[index + 1] : data.size();
+  return gd::String::FromUTF8(
+      std::string(&data[offsets[index]], end - 1 - offsets[index]));
+}
+
+}  // namespace gd
@@ -0,0 +1,70 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PACKEDSTRINGS_H
+#define GDCORE_PACKEDSTRINGS_H
+#include <cstdint>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A list of strings stored in a single buffer.
+ *
+ * The UTF-8 bytes of the strings are stored one after the other, each one
+ * followed by a null character, and the offset of each string in the buffer
+ * is stored in another buffer. This allows to read all the strings in one go
+ * (for example from JavaScript, with typed arrays on the memory of
+ * libGD.js), instead of reading them one by one.
+ */
+class GD_CORE_API PackedStrings {
+ public:
+  PackedStrings(){};
+  PackedStrings(const std::vector<gd::String>& strings);
+  virtual ~PackedStrings(){};
+
+  /**
+   * \brief Add a string at the end of the list.
+   * \return The index of the string.
+   */
+  std::size_t Add(const gd::String& str);
+
+  /**
+   * \brief Remove all the strings.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of strings.
+   */
+  std::size_t GetCount() const { return offsets.size(); }
+
+  /**
+   * \brief Return a copy of the string at the given index.
+   */
+  gd::String Get(std::size_t index) const;
+
+  /**
+   * \brief Return the buffer containing the null terminated UTF-8 bytes of
+   * the strings.
+   */
+  const std::vector<char>& GetData() const { return data; }
+
+  /**
+   * \brief Return the offset of each string in the buffer returned by
+   * GetData.
+   */
+  const std::vector<std::uint32_t>& GetOffsets() const { return offsets; }
+
+ private:
+  std::vector<char> data;
+  std::vector<std::uint32_t> offsets;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PACKEDSTRINGS_H
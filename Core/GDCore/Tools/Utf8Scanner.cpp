@@ -0,0 +1,184 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Utf8Scanner.h"
+
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GD_UTF8SCANNER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+#include "GDCore/Utf8/utf8.h"
+
+namespace {
+
+const std::size_t npos = static_cast<std::size_t>(-1);
+
+inline bool IsContinuationByte(char byte) {
+  return (static_cast<unsigned char>(byte) & 0xC0) == 0x80;
+}
+
+// Each implementation scans a block of blockSize bytes, returning the number
+// of continuation bytes (0b10xxxxxx) of the block or if the block is only
+// made of ASCII characters.
+#if defined(__AVX2__)
+const std::size_t blockSize = 32;
+
+inline std::size_t CountContinuationBytesInBlock(const char* block) {
+  __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+  // Continuation bytes are the ones in [-128, -65] when seen as signed.
+  __m256i continuationBytes = _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), bytes);
+  return std::bitset<32>(static_cast<std::uint32_t>(
+                             _mm256_movemask_epi8(continuationBytes)))
+      .count();
+}
+
+inline bool IsAsciiBlock(const char* block) {
+  return _mm256_movemask_epi8(_mm256_loadu_si256(
+             reinterpret_cast<const __m256i*>(block))) == 0;
+}
+#elif defined(GD_UTF8SCANNER_SSE2)
+const std::size_t blockSize = 16;
+
+inline std::size_t CountContinuationBytesInBlock(const char* block) {
+  __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+  // Continuation bytes are the ones in [-128, -65] when seen as signed.
+  __m128i continuationBytes = _mm_cmplt_epi8(bytes, _mm_set1_epi8(-64));
+  return std::bitset<16>(static_cast<std::uint32_t>(
+                             _mm_movemask_epi8(continuationBytes)))
+      .count();
+}
+
+inline bool IsAsciiBlock(const char* block) {
+  return _mm_movemask_epi8(_mm_loadu_si128(
+             reinterpret_cast<const __m128i*>(block))) == 0;
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+const std::size_t blockSize = 16;
+
+inline std::size_t CountContinuationBytesInBlock(const char* block) {
+  int8x16_t bytes = vld1q_s8(reinterpret_cast<const int8_t*>(block));
+  // Continuation bytes are the ones in [-128, -65] when seen as signed.
+  uint8x16_t continuationBytes = vcltq_s8(bytes, vdupq_n_s8(-64));
+  return vaddvq_u8(vshrq_n_u8(continuationBytes, 7));
+}
+
+inline bool IsAsciiBlock(const char* block) {
+  return vmaxvq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(block))) < 0x80;
+}
+#elif defined(__wasm_simd128__)
+const std::size_t blockSize = 16;
+
+inline std::size_t CountContinuationBytesInBlock(const char* block) {
+  v128_t bytes = wasm_v128_load(block);
+  // Continuation bytes are the ones in [-128, -65] when seen as signed.
+  v128_t continuationBytes = wasm_i8x16_lt(bytes, wasm_i8x16_splat(-64));
+  return std::bitset<16>(wasm_i8x16_bitmask(continuationBytes)).count();
+}
+
+inline bool IsAsciiBlock(const char* block) {
+  return wasm_i8x16_bitmask(wasm_v128_load(block)) == 0;
+}
+#else
+const std::size_t blockSize = 8;
+const std::uint64_t highBits = 0x8080808080808080ULL;
+
+inline std::uint64_t LoadBlock(const char* block) {
+  std::uint64_t bytes;
+  std::memcpy(&bytes, block, sizeof(bytes));
+  return bytes;
+}
+
+inline std::size_t CountContinuationBytesInBlock(const char* block) {
+  std::uint64_t bytes = LoadBlock(block);
+  // Keep the high bit of the bytes having their high bit set and the next
+  // one cleared.
+  return std::bitset<64>(bytes & ~(bytes << 1) & highBits).count();
+}
+
+inline bool IsAsciiBlock(const char* block) {
+  return (LoadBlock(block) & highBits) == 0;
+}
+#endif
+
+}  // namespace
+
+namespace gd {
+
+std::size_t Utf8Scanner::CountCodePoints(const char* data, std::size_t size) {
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + blockSize <= size; i += blockSize)
+    count += blockSize - CountContinuationBytesInBlock(data + i);
+  for (; i < size; ++i)
+    if (!IsContinuationByte(data[i])) ++count;
+
+  return count;
+}
+
+bool Utf8Scanner::IsAscii(const char* data, std::size_t size) {
+  std::size_t i = 0;
+  for (; i + blockSize <= size; i += blockSize)
+    if (!IsAsciiBlock(data + i)) return false;
+  for (; i < size; ++i)
+    if (static_cast<unsigned char>(data[i]) >= 0x80) return false;
+
+  return true;
+}
+
+bool Utf8Scanner::IsValid(const char* data, std::size_t size) {
+  const char* it = data;
+  const char* end = data + size;
+  while (it != end) {
+    // Skip the ASCII characters, then validate the next character.
+    if (static_cast<std::size_t>(end - it) >= blockSize && IsAsciiBlock(it)) {
+      it += blockSize;
+    } else if (static_cast<unsigned char>(*it) < 0x80) {
+      ++it;
+    } else if (::utf8::internal::validate_next(it, end) !=
+               ::utf8::internal::UTF8_OK) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::size_t Utf8Scanner::GetByteOffset(const char* data,
+                                       std::size_t size,
+                                       std::size_t codePointIndex) {
+  // Skip the blocks ending before the code point, then search it in the
+  // remaining bytes.
+  std::size_t remainingCount = codePointIndex;
+  std::size_t i = 0;
+  for (; i + blockSize <= size; i += blockSize) {
+    std::size_t blockCount =
+        blockSize - CountContinuationBytesInBlock(data + i);
+    if (blockCount > remainingCount) break;
+
+    remainingCount -= blockCount;
+  }
+  for (; i < size; ++i) {
+    if (IsContinuationByte(data[i])) continue;
+    if (remainingCount == 0) return i;
+
+    --remainingCount;
+  }
+
+  return remainingCount == 0 ? size : npos;
+}
+
+}  // namespace gd
@@ -0,0 +1,68 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_UTF8SCANNER_H
+#define GDCORE_UTF8SCANNER_H
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief Tool class scanning UTF8 encoded strings several bytes at a time,
+ * used by gd::String to convert between positions in characters (code points)
+ * and in bytes without decoding each character.
+ *
+ * The bytes are scanned by blocks using SIMD instructions when available
+ * (AVX2 or SSE2 on x86, NEON on ARM64, SIMD128 on WebAssembly), or 8 bytes at
+ * a time otherwise.
+ *
+ * \note Except for IsValid, the strings are assumed to be valid UTF8: code
+ * points are counted by counting the bytes that are not continuation bytes.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API Utf8Scanner {
+ public:
+  /**
+   * \brief Return the number of code points in the \a size first bytes of
+   * \a data.
+   */
+  static std::size_t CountCodePoints(const char* data, std::size_t size);
+
+  /**
+   * \brief Return true if all the bytes are ASCII characters.
+   */
+  static bool IsAscii(const char* data, std::size_t size);
+
+  /**
+   * \brief Return true if the bytes are a valid UTF8 string.
+   */
+  static bool IsValid(const char* data, std::size_t size);
+
+  /**
+   * \brief Return the position, in bytes, of the code point at the given
+   * index. Return \a size if the index is the number of code points, and
+   * gd::String::npos if it is greater.
+   */
+  static std::size_t GetByteOffset(const char* data,
+                                   std::size_t size,
+                                   std::size_t codePointIndex);
+
+  /**
+   * \brief Return the index of the code point starting at the given position,
+   * in bytes.
+   */
+  static std::size_t GetCodePointIndex(const char* data,
+                                       std::size_t byteOffset) {
+    return CountCodePoints(data, byteOffset);
+  }
+
+ private:
+  Utf8Scanner(){};
+  virtual ~Utf8Scanner(){};
+};
+
+}  // namespace gd
+#endif  // GDCORE_UTF8SCANNER_H
@@ -0,0 +1,43 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_TESTS_BENCHMARKTOOLS_H
+#define GDCORE_TESTS_BENCHMARKTOOLS_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+
+#include "GDCore/String.h"
+
+/**
+ * Run a function the given number of times and print the average time
+ * taken by a run.
+ *
+ * Benchmarks are usually in a test case tagged with "[.]" so that they are
+ * only run when asked for.
+ */
+inline void DoBenchmark(const gd::String &benchmarkName,
+                        std::size_t runsCount,
+                        std::function<void()> func) {
+  long long totalTimeInMicroseconds = 0;
+  for (std::size_t i = 0; i < runsCount; i++) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+
+    totalTimeInMicroseconds +=
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+            .count();
+  }
+
+  std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+            << (float)totalTimeInMicroseconds / (float)runsCount
+            << " microseconds" << std::endl;
+}
+
+#endif  // GDCORE_TESTS_BENCHMARKTOOLS_H
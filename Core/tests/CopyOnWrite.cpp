@@ -0,0 +1,202 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/CopyOnWrite.h"
+
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/ProjectStripper.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief A resource worker prefixing the files by a directory.
+ */
+class FilesMover : public gd::ArbitraryResourceWorker {
+ public:
+  FilesMover(const gd::String& directory_) : directory(directory_){};
+  virtual ~FilesMover(){};
+
+  virtual void ExposeFile(gd::String& file) override {
+    if (!directory.empty()) file = directory + "/" + file;
+  };
+
+ private:
+  gd::String directory;
+};
+}  // namespace
+
+TEST_CASE("CopyOnWrite", "[common]") {
+  SECTION("Copies are independent") {
+    gd::CopyOnWrite<std::vector<int>> original;
+    original.GetMutable().push_back(1);
+
+    gd::CopyOnWrite<std::vector<int>> copy(original);
+    REQUIRE(&copy.Get() != &original.Get());
+    REQUIRE(!copy.IsShared());
+    copy.GetMutable().push_back(2);
+    REQUIRE(original.Get().size() == 1);
+  }
+
+  SECTION("Shared values are copied when modified") {
+    gd::CopyOnWrite<std::vector<int>> original;
+    original.GetMutable().push_back(1);
+    const std::vector<int>* originalValue = &original.Get();
+
+    gd::CopyOnWrite<std::vector<int>> copy;
+    copy.Share(original);
+    REQUIRE(copy.IsShared());
+    REQUIRE(&copy.Get() == originalValue);
+
+    copy.GetMutable().push_back(2);
+    REQUIRE(!copy.IsShared());
+    REQUIRE(copy.Get().size() == 2);
+    REQUIRE(original.Get().size() == 1);
+
+    // The original value is never copied.
+    original.GetMutable().push_back(3);
+    REQUIRE(&original.Get() == originalValue);
+  }
+
+  SECTION("Assigning a value keeps references to it valid") {
+    gd::CopyOnWrite<std::vector<int>> original;
+    original.GetMutable().push_back(1);
+    gd::CopyOnWrite<std::vector<int>> other;
+    other.GetMutable().push_back(2);
+    const std::vector<int>* originalValue = &original.Get();
+
+    original = other;
+    REQUIRE(&original.Get() == originalValue);
+    REQUIRE(original.Get() == std::vector<int>{2});
+
+    // A shared value is not modified by the assignment.
+    gd::CopyOnWrite<std::vector<int>> copy;
+    copy.Share(original);
+    copy = gd::CopyOnWrite<std::vector<int>>();
+    REQUIRE(copy.Get().empty());
+    REQUIRE(!copy.IsShared());
+    REQUIRE(original.Get() == std::vector<int>{2});
+  }
+
+  SECTION("Assigning a layout keeps references to its events and instances") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    gd::Layout& otherLayout = project.InsertNewLayout("OtherScene", 1);
+    otherLayout.GetEvents().InsertEvent(gd::StandardEvent());
+    otherLayout.GetInitialInstances().InsertNewInitialInstance();
+
+    gd::EventsList& events = layout.GetEvents();
+    gd::InitialInstancesContainer& instances = layout.GetInitialInstances();
+    layout = otherLayout;
+    REQUIRE(&layout.GetEvents() == &events);
+    REQUIRE(&layout.GetInitialInstances() == &instances);
+    REQUIRE(events.GetEventsCount() == 1);
+    REQUIRE(instances.GetInstancesCount() == 1);
+  }
+
+  SECTION("Cloning a project with copy-on-write") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "MyObject");
+    layout.GetEvents().InsertEvent(gd::StandardEvent());
+    project.InsertNewExternalEvents("External", 0)
+        .GetEvents()
+        .InsertEvent(gd::StandardEvent());
+    project.InsertNewExternalLayout("ExternalLayout", 0)
+        .GetInitialInstances()
+        .InsertNewInitialInstance();
+
+    const gd::Project& constProject = project;
+    std::unique_ptr<gd::Project> clone = project.CloneWithCopyOnWrite();
+    const gd::Project& constClone = *clone;
+    REQUIRE(&constClone.GetLayout("Scene") != &constProject.GetLayout("Scene"));
+    REQUIRE(&constClone.GetLayout("Scene").GetInitialInstances() ==
+            &constProject.GetLayout("Scene").GetInitialInstances());
+    REQUIRE(&constClone.GetLayout("Scene").GetEvents() ==
+            &constProject.GetLayout("Scene").GetEvents());
+    REQUIRE(&constClone.GetExternalEvents("External").GetEvents() ==
+            &constProject.GetExternalEvents("External").GetEvents());
+    REQUIRE(
+        &constClone.GetExternalLayout("ExternalLayout").GetInitialInstances() ==
+        &constProject.GetExternalLayout("ExternalLayout").GetInitialInstances());
+
+    // Modifying the clone doesn't modify the project.
+    clone->GetLayout("Scene").GetEvents().Clear();
+    clone->GetLayout("Scene").GetInitialInstances().InsertNewInitialInstance();
+    clone->GetExternalEvents("External").GetEvents().Clear();
+    REQUIRE(project.GetLayout("Scene").GetEvents().GetEventsCount() == 1);
+    REQUIRE(project.GetLayout("Scene").GetInitialInstances().GetInstancesCount() ==
+            1);
+    REQUIRE(clone->GetLayout("Scene").GetInitialInstances().GetInstancesCount() ==
+            2);
+    REQUIRE(project.GetExternalEvents("External").GetEvents().GetEventsCount() ==
+            1);
+
+    // Resetting a shared value doesn't copy it.
+    std::unique_ptr<gd::Project> otherClone = project.CloneWithCopyOnWrite();
+    gd::ProjectStripper::StripProjectForExport(*otherClone);
+    REQUIRE(otherClone->GetLayout("Scene").GetEvents().IsEmpty());
+    REQUIRE(project.GetLayout("Scene").GetEvents().GetEventsCount() == 1);
+
+    // Copying the clone makes a deep copy.
+    gd::Project copy(*clone);
+    const gd::Project& constCopy = copy;
+    REQUIRE(
+        &constCopy.GetExternalLayout("ExternalLayout").GetInitialInstances() !=
+        &constProject.GetExternalLayout("ExternalLayout").GetInitialInstances());
+  }
+
+  SECTION("Exposing the resources of a clone") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    gd::StandardEvent event;
+    gd::Instruction instruction;
+    instruction.SetType("MyExtension::DoSomethingWithResources");
+    instruction.SetParametersCount(3);
+    instruction.SetParameter(2, gd::Expression("sound.wav"));
+    event.GetActions().Insert(instruction);
+    layout.GetEvents().InsertEvent(event);
+
+    // Events are not copied if the worker doesn't update them...
+    const gd::Project& constProject = project;
+    std::unique_ptr<gd::Project> clone = project.CloneWithCopyOnWrite();
+    const gd::Project& constClone = *clone;
+    FilesMover filesLister("");
+    clone->ExposeResources(filesLister);
+    REQUIRE(&constClone.GetLayout("Scene").GetEvents() ==
+            &constProject.GetLayout("Scene").GetEvents());
+
+    // ...and are copied if it does.
+    FilesMover filesMover("sounds");
+    clone->ExposeResources(filesMover);
+    REQUIRE(&constClone.GetLayout("Scene").GetEvents() !=
+            &constProject.GetLayout("Scene").GetEvents());
+    auto& clonedEvent = dynamic_cast<const gd::StandardEvent&>(
+        constClone.GetLayout("Scene").GetEvents().GetEvent(0));
+    REQUIRE(clonedEvent.GetActions().Get(0).GetParameter(2).GetPlainString() ==
+            "sounds/sound.wav");
+    auto& originalEvent = dynamic_cast<const gd::StandardEvent&>(
+        constProject.GetLayout("Scene").GetEvents().GetEvent(0));
+    REQUIRE(originalEvent.GetActions().Get(0).GetParameter(2).GetPlainString() ==
+            "sound.wav");
+  }
+}
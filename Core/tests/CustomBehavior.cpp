@@ -0,0 +1,106 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/CustomBehavior.h"
+
+#include "GDCore/Project/BehaviorContent.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/PropertyDescriptor.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("CustomBehavior", "[common]") {
+  gd::EventsBasedBehavior eventsBasedBehavior;
+  auto& propertyDescriptors = eventsBasedBehavior.GetPropertyDescriptors();
+  propertyDescriptors.InsertNew("Speed", 0)
+      .SetType("Number")
+      .SetValue("200")
+      .SetLabel("Speed");
+  propertyDescriptors.InsertNew("Enabled", 1)
+      .SetType("Boolean")
+      .SetValue("true");
+  propertyDescriptors.InsertNew("Animation", 2)
+      .SetType("Choice")
+      .SetValue("Walk")
+      .AddExtraInfo("Walk")
+      .AddExtraInfo("Run");
+
+  gd::CustomBehavior behavior(eventsBasedBehavior);
+  gd::BehaviorContent behaviorContent("Movement", "MyExtension::Movement");
+  behavior.InitializeContent(behaviorContent.GetContent());
+
+  SECTION("Properties are initialized with their default values") {
+    auto properties = behavior.GetProperties(behaviorContent.GetContent());
+    REQUIRE(properties.size() == 3);
+    REQUIRE(properties["Speed"].GetValue() == "200");
+    REQUIRE(properties["Speed"].GetType() == "Number");
+    REQUIRE(properties["Speed"].GetLabel() == "Speed");
+    REQUIRE(properties["Enabled"].GetValue() == "true");
+    REQUIRE(properties["Animation"].GetValue() == "Walk");
+    REQUIRE(properties["Animation"].GetExtraInfo().size() == 2);
+
+    REQUIRE(behaviorContent.GetContent().GetChild("Speed").GetDoubleValue() ==
+            200);
+    REQUIRE(behaviorContent.GetContent().GetChild("Enabled").GetBoolValue() ==
+            true);
+  }
+
+  SECTION("Properties are updated") {
+    REQUIRE(behavior.UpdateProperty(
+        behaviorContent.GetContent(), "Speed", "350.5"));
+    REQUIRE(behavior.UpdateProperty(
+        behaviorContent.GetContent(), "Enabled", "0"));
+    REQUIRE(behavior.UpdateProperty(
+        behaviorContent.GetContent(), "Animation", "Run"));
+    REQUIRE(!behavior.UpdateProperty(
+        behaviorContent.GetContent(), "Unknown", "1"));
+
+    auto properties = behavior.GetProperties(behaviorContent.GetContent());
+    REQUIRE(properties["Speed"].GetValue() == "350.5");
+    REQUIRE(properties["Enabled"].GetValue() == "false");
+    REQUIRE(properties["Animation"].GetValue() == "Run");
+  }
+
+  SECTION("Number properties are read back without losing precision") {
+    REQUIRE(behavior.UpdateProperty(
+        behaviorContent.GetContent(), "Speed", "1234567"));
+    REQUIRE(behavior.GetProperties(behaviorContent.GetContent())["Speed"]
+                .GetValue() == "1234567");
+
+    REQUIRE(behavior.UpdateProperty(
+        behaviorContent.GetContent(), "Speed", "0.1"));
+    REQUIRE(behavior.GetProperties(behaviorContent.GetContent())["Speed"]
+                .GetValue() == "0.1");
+
+    REQUIRE(behavior.UpdateProperty(
+        behaviorContent.GetContent(), "Speed", "123456.78901234567"));
+    REQUIRE(behavior.GetProperties(behaviorContent.GetContent())["Speed"]
+                .GetValue()
+                .To<double>() == 123456.78901234567);
+  }
+
+  SECTION("Properties are kept by the behavior content until modified") {
+    const auto& properties = behaviorContent.GetProperties(behavior);
+    REQUIRE(properties.at("Speed").GetValue() == "200");
+    REQUIRE(&behaviorContent.GetProperties(behavior) == &properties);
+
+    REQUIRE(behaviorContent.UpdateProperty(behavior, "Speed", "100"));
+    REQUIRE(behaviorContent.GetProperties(behavior).at("Speed").GetValue() ==
+            "100");
+
+    behaviorContent.GetContent().GetChild("Speed").SetDoubleValue(50);
+    REQUIRE(behaviorContent.GetProperties(behavior).at("Speed").GetValue() ==
+            "50");
+
+    // A copy of the behavior returns the same properties.
+    std::unique_ptr<gd::Behavior> clone(behavior.Clone());
+    const auto& cloneProperties = behaviorContent.GetProperties(*clone);
+    REQUIRE(&behaviorContent.GetProperties(behavior) == &cloneProperties);
+
+    // Another behavior can return other properties.
+    gd::Behavior emptyBehavior;
+    REQUIRE(behaviorContent.GetProperties(emptyBehavior).empty());
+  }
+}
@@ -0,0 +1,294 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/DeadEventsEliminator.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "catch.hpp"
+
+namespace {
+
+void AddInstructionsToPlatform(gd::Platform &platform) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "BuiltinVariables", "Dummy variables extension", "", "", "");
+  extension->AddAction("ModVarScene", "Change a variable", "", "", "", "", "")
+      .AddParameter("scenevar", "Variable")
+      .AddParameter("operator", "Modification's sign")
+      .AddParameter("expression", "Value");
+  extension->AddAction("Create", "Create an object", "", "", "", "", "")
+      .AddCodeOnlyParameter("objectsContext", "")
+      .AddParameter("objectListWithoutPicking", "Object to create")
+      .AddParameter("expression", "X position")
+      .AddParameter("expression", "Y position");
+  platform.AddExtension(extension);
+}
+
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const std::vector<gd::String> &parameters,
+                                bool inverted = false) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetInverted(inverted);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+
+gd::StandardEvent MakeEvent(const gd::Instruction &condition,
+                            const gd::Instruction &action) {
+  gd::StandardEvent event;
+  event.GetConditions().Insert(condition);
+  event.GetActions().Insert(action);
+
+  return event;
+}
+
+gd::Instruction MakeDoSomething() {
+  return MakeInstruction("MyExtension::DoSomething", {"1"});
+}
+
+}  // namespace
+
+TEST_CASE("DeadEventsEliminator", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  AddInstructionsToPlatform(platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+
+  SECTION("Constant conditions") {
+    gd::EventsList &events = layout.GetEvents();
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("BuiltinCommonInstructions::CompareNumbers",
+                        {"1", "=", "2"}),
+        MakeDoSomething()));
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("BuiltinCommonInstructions::CompareNumbers",
+                        {"1", "=", "2"},
+                        /*inverted=*/true),
+        MakeDoSomething()));
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("BuiltinCommonInstructions::CompareNumbers",
+                        {"1 + 1", "=", "3"}),
+        MakeDoSomething()));
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("BuiltinCommonInstructions::CompareStrings",
+                        {"\"Hello\"", "!=", "\"Hello\""}),
+        MakeDoSomething()));
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("BuiltinCommonInstructions::Always", {""}, true),
+        MakeDoSomething()));
+
+    gd::DeadEventsProjectFacts projectFacts(platform, project);
+    gd::DeadEventsEliminator eliminator(
+        platform, project, layout, projectFacts);
+    eliminator.Launch(events);
+
+    // Only the inverted comparison and the non literal one are kept.
+    REQUIRE(events.GetEventsCount() == 2);
+    REQUIRE(eliminator.GetRemovedEventsCount() == 3);
+    REQUIRE(events.GetEvent(0).GetAllConditionsVectors()[0]->Get(0).IsInverted() ==
+            true);
+    REQUIRE(events.GetEvent(1)
+                .GetAllConditionsVectors()[0]
+                ->Get(0)
+                .GetParameter(0)
+                .GetPlainString() == "1 + 1");
+  }
+
+  SECTION("Conditions before an always false condition") {
+    gd::EventsList &events = layout.GetEvents();
+    gd::Instruction alwaysFalse = MakeInstruction(
+        "BuiltinCommonInstructions::CompareNumbers", {"1", "=", "2"});
+
+    // Comparisons of literals have no side effects.
+    gd::StandardEvent eventWithPureConditions;
+    eventWithPureConditions.GetConditions().Insert(MakeInstruction(
+        "BuiltinCommonInstructions::CompareNumbers", {"1", "<", "2"}));
+    eventWithPureConditions.GetConditions().Insert(alwaysFalse);
+    events.InsertEvent(eventWithPureConditions);
+
+    // Unknown conditions, or expressions calling functions, could have side
+    // effects that must still happen.
+    gd::StandardEvent eventWithUnknownCondition;
+    eventWithUnknownCondition.GetConditions().Insert(
+        MakeInstruction("BuiltinCommonInstructions::Once", {}));
+    eventWithUnknownCondition.GetConditions().Insert(alwaysFalse);
+    events.InsertEvent(eventWithUnknownCondition);
+
+    gd::StandardEvent eventWithFunctionCall;
+    eventWithFunctionCall.GetConditions().Insert(
+        MakeInstruction("BuiltinCommonInstructions::CompareNumbers",
+                        {"MyExtension::DoSomething()", "=", "1"}));
+    eventWithFunctionCall.GetConditions().Insert(alwaysFalse);
+    events.InsertEvent(eventWithFunctionCall);
+
+    gd::DeadEventsProjectFacts projectFacts(platform, project);
+    gd::DeadEventsEliminator eliminator(
+        platform, project, layout, projectFacts);
+    eliminator.Launch(events);
+
+    REQUIRE(events.GetEventsCount() == 2);
+    REQUIRE(eliminator.GetRemovedEventsCount() == 1);
+    REQUIRE(events.GetEvent(0).GetAllConditionsVectors()[0]->Get(0).GetType() ==
+            "BuiltinCommonInstructions::Once");
+  }
+
+  SECTION("Sub events of a dead event are removed") {
+    gd::StandardEvent event = MakeEvent(
+        MakeInstruction("BuiltinCommonInstructions::CompareNumbers",
+                        {"0", ">", "1"}),
+        MakeDoSomething());
+    event.GetSubEvents().InsertEvent(gd::StandardEvent());
+    layout.GetEvents().InsertEvent(event);
+    layout.GetEvents().InsertEvent(gd::StandardEvent());
+
+    gd::DeadEventsProjectFacts projectFacts(platform, project);
+    gd::DeadEventsEliminator eliminator(
+        platform, project, layout, projectFacts);
+    eliminator.Launch(layout.GetEvents());
+
+    REQUIRE(layout.GetEvents().GetEventsCount() == 1);
+    REQUIRE(layout.GetEvents().GetEvent(0).GetSubEvents().IsEmpty());
+  }
+
+  SECTION("Scene variables never modified") {
+    layout.GetVariables().InsertNew("Unmodified", 0).SetValue(3);
+    layout.GetVariables().InsertNew("Modified", 0).SetValue(3);
+
+    gd::EventsList &events = layout.GetEvents();
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("VarScene", {"Unmodified", "=", "4"}),
+        MakeDoSomething()));
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("VarScene", {"Unmodified", "=", "3"}),
+        MakeDoSomething()));
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("VarScene", {"Modified", "=", "4"}),
+        MakeInstruction("ModVarScene", {"Modified", "+", "1"})));
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("VarScene", {"Undeclared", ">", "0"}),
+        MakeDoSomething()));
+
+    gd::DeadEventsProjectFacts projectFacts(platform, project);
+    gd::DeadEventsEliminator eliminator(
+        platform, project, layout, projectFacts);
+    eliminator.Launch(events);
+
+    REQUIRE(events.GetEventsCount() == 2);
+    REQUIRE(events.GetEvent(0)
+                .GetAllConditionsVectors()[0]
+                ->Get(0)
+                .GetParameter(2)
+                .GetPlainString() == "3");
+    REQUIRE(events.GetEvent(1)
+                .GetAllConditionsVectors()[0]
+                ->Get(0)
+                .GetParameter(0)
+                .GetPlainString() == "Modified");
+  }
+
+  SECTION("Objects without instances") {
+    auto &object = layout.InsertNewObject(
+        project, "MyExtension::Sprite", "ObjectWithoutInstances", 0);
+    object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    auto &objectWithInstances = layout.InsertNewObject(
+        project, "MyExtension::Sprite", "ObjectWithInstances", 0);
+    objectWithInstances.AddNewBehavior(
+        project, "MyExtension::MyBehavior", "MyBehavior");
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "ObjectWithInstances");
+
+    gd::EventsList &events = layout.GetEvents();
+    gd::StandardEvent event;
+    event.GetActions().Insert(MakeInstruction(
+        "MyExtension::BehaviorDoSomething",
+        {"ObjectWithoutInstances", "MyBehavior", "123"}));
+    event.GetActions().Insert(MakeInstruction(
+        "MyExtension::BehaviorDoSomething",
+        {"ObjectWithInstances", "MyBehavior", "123"}));
+    events.InsertEvent(event);
+
+    gd::ForEachEvent forEachEvent;
+    forEachEvent.SetObjectToPick("ObjectWithoutInstances");
+    events.InsertEvent(forEachEvent);
+
+    gd::DeadEventsProjectFacts projectFacts(platform, project);
+    gd::DeadEventsEliminator eliminator(
+        platform, project, layout, projectFacts);
+    eliminator.Launch(events);
+
+    REQUIRE(events.GetEventsCount() == 1);
+    REQUIRE(eliminator.GetRemovedActionsCount() == 1);
+    REQUIRE(events.GetEvent(0).GetAllActionsVectors()[0]->size() == 1);
+    REQUIRE(events.GetEvent(0)
+                .GetAllActionsVectors()[0]
+                ->Get(0)
+                .GetParameter(0)
+                .GetPlainString() == "ObjectWithInstances");
+  }
+
+  SECTION("Objects created by an action are kept") {
+    auto &object = layout.InsertNewObject(
+        project, "MyExtension::Sprite", "CreatedObject", 0);
+    object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+
+    gd::EventsList &events = layout.GetEvents();
+    gd::StandardEvent event;
+    event.GetActions().Insert(
+        MakeInstruction("Create", {"", "CreatedObject", "0", "0"}));
+    event.GetActions().Insert(MakeInstruction(
+        "MyExtension::BehaviorDoSomething",
+        {"CreatedObject", "MyBehavior", "123"}));
+    events.InsertEvent(event);
+
+    gd::DeadEventsProjectFacts projectFacts(platform, project);
+    gd::DeadEventsEliminator eliminator(
+        platform, project, layout, projectFacts);
+    eliminator.Launch(events);
+
+    REQUIRE(events.GetEventsCount() == 1);
+    REQUIRE(events.GetEvent(0).GetAllActionsVectors()[0]->size() == 2);
+  }
+
+  SECTION("Arbitrary code disables object and variable analysis") {
+    layout.InsertNewObject(
+        project, "MyExtension::Sprite", "ObjectWithoutInstances", 0);
+
+    gd::EventsList &events = layout.GetEvents();
+    gd::ForEachEvent forEachEvent;
+    forEachEvent.SetObjectToPick("ObjectWithoutInstances");
+    events.InsertEvent(forEachEvent);
+    events.InsertEvent(MakeEvent(
+        MakeInstruction("VarScene", {"Undeclared", ">", "0"}),
+        MakeDoSomething()));
+
+    gd::BaseEvent unknownEvent;
+    unknownEvent.SetType("MyExtension::SomeCodeEvent");
+    events.InsertEvent(unknownEvent);
+
+    gd::DeadEventsProjectFacts projectFacts(platform, project);
+    gd::DeadEventsEliminator eliminator(
+        platform, project, layout, projectFacts);
+    eliminator.Launch(events);
+
+    REQUIRE(events.GetEventsCount() == 3);
+  }
+}
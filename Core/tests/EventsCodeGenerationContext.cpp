@@ -186,4 +186,30 @@ TEST_CASE("EventsCodeGenerationContext", "[common][events]") {
     REQUIRE(c7.IsSameObjectsList("c6.object3", c6) == false);
     REQUIRE(c7.IsSameObjectsList("c5.empty1", c5) == false);
   }
+  SECTION("Objects lists only read") {
+    gd::EventsCodeGenerationContext parent;
+    parent.ObjectsListNeeded("object1");
+
+    gd::EventsCodeGenerationContext context;
+    context.InheritsFrom(parent);
+    context.ObjectsListNeededForReading("object1");
+    context.ObjectsListNeededForReading("object2");
+    context.ObjectsListNeededForReading("object3");
+    context.ObjectsListNeeded("object3");
+    context.EmptyObjectsListNeeded("empty1");
+
+    REQUIRE(context.GetObjectsListsToBeDeclared() ==
+            std::set<gd::String>({"object1", "object2", "object3"}));
+    REQUIRE(context.GetObjectsListsToBeDeclaredOnlyRead() ==
+            std::set<gd::String>({"object1", "object2"}));
+    REQUIRE(context.GetLastDepthObjectListWasNeeded("object1") == 1);
+
+    context.SetObjectsListDeclaredElsewhere("object1");
+    context.SetObjectsListDeclaredElsewhere("empty1");
+    REQUIRE(context.GetAllObjectsToBeDeclared() ==
+            std::set<gd::String>({"object2", "object3"}));
+    REQUIRE(context.ObjectAlreadyDeclared("object1") == true);
+    REQUIRE(context.ObjectAlreadyDeclared("empty1") == true);
+    REQUIRE(context.GetLastDepthObjectListWasNeeded("object1") == 1);
+  }
 }
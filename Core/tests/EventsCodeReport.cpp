@@ -0,0 +1,90 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/EventsCodeReport.h"
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("EventsCodeReport", "[common][events]") {
+  gd::EventsList events;
+  gd::BaseEvent& event0 = events.InsertEvent(gd::StandardEvent());
+  gd::BaseEvent& event1 = events.InsertEvent(gd::StandardEvent());
+  gd::BaseEvent& subEvent =
+      event1.GetSubEvents().InsertEvent(gd::StandardEvent());
+  gd::BaseEvent& event2 = events.InsertEvent(gd::StandardEvent());
+
+  SECTION("Positions and statistics excluding sub events") {
+    gd::EventsCodeReport codeReport;
+    codeReport.RegisterEventsPositions(events);
+
+    codeReport.BeginEvent(event0, 0, 0, 0);
+    codeReport.EndEvent(100, 0, 2, 1);
+
+    // The sub event code is put outside of the main events list.
+    codeReport.BeginEvent(event1, 0, 2, 1);
+    codeReport.BeginEvent(subEvent, 0, 2, 1);
+    codeReport.EndEvent(40, 0, 5, 3);
+    codeReport.EndEvent(60, 40, 6, 3);
+
+    gd::StandardEvent eventFromLink;
+    codeReport.BeginEvent(eventFromLink, 40, 6, 3);
+    codeReport.EndEvent(10, 40, 6, 3);
+
+    codeReport.BeginEvent(event2, 40, 6, 3);
+    codeReport.EndEvent(20, 40, 6, 3);
+
+    const auto& reports = codeReport.GetEventsReports();
+    REQUIRE(reports.size() == 5);
+
+    REQUIRE(reports[0].position == 0);
+    REQUIRE(reports[0].depth == 0);
+    REQUIRE(reports[0].codeSize == 100);
+    REQUIRE(reports[0].instancesLoopsCount == 2);
+    REQUIRE(reports[0].objectsListsCopiesCount == 1);
+
+    REQUIRE(reports[1].position == 1);
+    REQUIRE(reports[1].depth == 0);
+    REQUIRE(reports[1].codeSize == 60);
+    REQUIRE(reports[1].instancesLoopsCount == 1);
+    REQUIRE(reports[1].objectsListsCopiesCount == 0);
+
+    REQUIRE(reports[2].position == 2);
+    REQUIRE(reports[2].depth == 1);
+    REQUIRE(reports[2].codeSize == 40);
+    REQUIRE(reports[2].instancesLoopsCount == 3);
+    REQUIRE(reports[2].objectsListsCopiesCount == 2);
+
+    REQUIRE(reports[3].position == gd::String::npos);
+
+    REQUIRE(reports[4].position == 3);
+    REQUIRE(reports[4].codeSize == 20);
+
+    REQUIRE(codeReport.GetTotalCodeSize() == 230);
+  }
+
+  SECTION("Serialization") {
+    gd::EventsCodeReport codeReport;
+    codeReport.RegisterEventsPositions(events);
+    codeReport.BeginEvent(event2, 0, 0, 0);
+    codeReport.EndEvent(12, 0, 1, 0);
+
+    gd::SerializerElement element;
+    codeReport.SerializeTo(element);
+
+    REQUIRE(element.GetIntAttribute("totalCodeSize") == 12);
+    REQUIRE(element.GetChild("events").GetChildrenCount() == 1);
+    const gd::SerializerElement& eventElement =
+        element.GetChild("events").GetChild(0);
+    REQUIRE(eventElement.GetIntAttribute("position") == 3);
+    REQUIRE(eventElement.GetIntAttribute("depth") == 0);
+    REQUIRE(eventElement.GetIntAttribute("codeSize") == 12);
+    REQUIRE(eventElement.GetIntAttribute("instancesLoopsCount") == 1);
+    REQUIRE(eventElement.GetIntAttribute("objectsListsCopiesCount") == 0);
+  }
+}
@@ -0,0 +1,136 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsExpressionsValidator.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const std::vector<gd::String> &parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+}  // namespace
+
+TEST_CASE("EventsExpressionsValidator", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "MyConditionsExtension", "My conditions extension", "", "", "");
+  extension
+      ->AddCondition("CompareText", "Compare a text", "", "", "", "", "")
+      .AddParameter("object", "Object")
+      .AddParameter("string", "Text");
+  platform.AddExtension(extension);
+
+  gd::EventsList events;
+  {
+    gd::StandardEvent event;
+    event.GetActions().Insert(
+        MakeInstruction("MyExtension::DoSomething", {"1 + 2"}));
+    events.InsertEvent(event);
+  }
+  {
+    gd::StandardEvent event;
+    event.GetConditions().Insert(MakeInstruction(
+        "MyConditionsExtension::CompareText", {"MySpriteObject", "1"}));
+    event.GetActions().Insert(
+        MakeInstruction("MyExtension::DoSomething", {"1 +"}));
+
+    gd::StandardEvent subEvent;
+    subEvent.GetActions().Insert(
+        MakeInstruction("MyExtension::DoSomething", {"2"}));
+    subEvent.GetActions().Insert(
+        MakeInstruction("MyExtension::DoSomething", {"\"Not a number\""}));
+    event.GetSubEvents().InsertEvent(subEvent);
+    events.InsertEvent(event);
+  }
+  {
+    gd::StandardEvent event;
+    // Instructions without metadata and parameters that are not expressions
+    // are not validated.
+    event.GetActions().Insert(MakeInstruction("UnknownAction", {"1 +"}));
+    event.GetConditions().Insert(MakeInstruction(
+        "MyConditionsExtension::CompareText", {"Unknown object", "\"Text\""}));
+    events.InsertEvent(event);
+  }
+  {
+    gd::StandardEvent event;
+    event.GetActions().Insert(
+        MakeInstruction("MyExtension::DoSomething", {"MyExtension::Unknown()"}));
+    events.InsertEvent(event);
+  }
+
+  gd::EventsExpressionsValidator validator(platform);
+  validator.Launch(events, project, layout1);
+
+  const auto &diagnostics = validator.GetDiagnostics();
+  REQUIRE(diagnostics.size() == 4);
+
+  REQUIRE(diagnostics[0].GetEventPath() == std::vector<std::size_t>({1}));
+  REQUIRE(diagnostics[0].IsCondition());
+  REQUIRE(&diagnostics[0].GetInstruction() ==
+          &events.GetEvent(1).GetAllConditionsVectors()[0]->Get(0));
+  REQUIRE(diagnostics[0].GetParameterIndex() == 1);
+  REQUIRE(diagnostics[0].GetStartPosition() == 0);
+  REQUIRE(diagnostics[0].GetEndPosition() == 1);
+
+  REQUIRE(diagnostics[1].GetEventPath() == std::vector<std::size_t>({1}));
+  REQUIRE(!diagnostics[1].IsCondition());
+  REQUIRE(diagnostics[1].GetParameterIndex() == 0);
+
+  REQUIRE(diagnostics[2].GetEventPath() == std::vector<std::size_t>({1, 0}));
+  REQUIRE(&diagnostics[2].GetInstruction() ==
+          &events.GetEvent(1)
+               .GetSubEvents()
+               .GetEvent(0)
+               .GetAllActionsVectors()[0]
+               ->Get(1));
+  REQUIRE(diagnostics[2].GetMessage() ==
+          "You entered a text, but a number was expected.");
+
+  REQUIRE(diagnostics[3].GetEventPath() == std::vector<std::size_t>({3}));
+  REQUIRE(diagnostics[3].GetMessage() ==
+          "Cannot find an expression with this name: MyExtension::Unknown\n"
+          "Double check that you've not made any typo in the name.");
+
+  SECTION("Diagnostics are the same as when validating expressions one by one") {
+    gd::EventsExpressionsValidator otherValidator(platform);
+    otherValidator.Launch(events.GetEvent(1).GetSubEvents(), project, layout1);
+    REQUIRE(otherValidator.GetDiagnostics().size() == 1);
+    REQUIRE(otherValidator.GetDiagnostics()[0].GetEventPath() ==
+            std::vector<std::size_t>({0}));
+    REQUIRE(otherValidator.GetDiagnostics()[0].GetMessage() ==
+            diagnostics[2].GetMessage());
+
+    // Launching again accumulates the diagnostics, with paths relative to the
+    // new events list.
+    otherValidator.Launch(events, project, layout1);
+    REQUIRE(otherValidator.GetDiagnostics().size() == 5);
+    REQUIRE(otherValidator.GetDiagnostics()[3].GetEventPath() ==
+            std::vector<std::size_t>({1, 0}));
+  }
+}
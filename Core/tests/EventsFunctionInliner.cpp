@@ -0,0 +1,176 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/EventsFunctionInliner.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::EventsFunction &InsertNewExpressionFunction(
+    gd::EventsFunctionsExtension &eventsExtension,
+    const gd::String &name,
+    const gd::String &returnedExpression) {
+  auto &eventsFunction = eventsExtension.InsertNewEventsFunction(
+      name, eventsExtension.GetEventsFunctionsCount());
+  eventsFunction.SetFunctionType(gd::EventsFunction::Expression);
+  eventsFunction.GetParameters().push_back(
+      gd::ParameterMetadata().SetName("A").SetType("expression"));
+  eventsFunction.GetParameters().push_back(
+      gd::ParameterMetadata().SetName("B").SetType("expression"));
+
+  gd::StandardEvent event;
+  gd::Instruction instruction;
+  instruction.SetType("SetReturnNumber");
+  instruction.SetParametersCount(1);
+  instruction.SetParameter(0, gd::Expression(returnedExpression));
+  event.GetActions().Insert(instruction);
+  eventsFunction.GetEvents().InsertEvent(event);
+
+  return eventsFunction;
+}
+}  // namespace
+
+TEST_CASE("EventsFunctionInliner", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+
+  std::shared_ptr<gd::PlatformExtension> advancedExtension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  gd::BuiltinExtensionsImplementer::ImplementsAdvancedExtension(
+      *advancedExtension);
+  platform.AddExtension(advancedExtension);
+
+  // Declare the functions made with events, as the IDE would do.
+  std::shared_ptr<gd::PlatformExtension> eventsFunctionsPlatformExtension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  eventsFunctionsPlatformExtension->SetExtensionInformation(
+      "MyEventsExtension", "My events extension", "", "", "");
+  for (gd::String name : {"Sum", "Twice", "Swapped", "WithVariable"}) {
+    eventsFunctionsPlatformExtension->AddExpression(name, name, "", "", "")
+        .AddParameter("expression", "A")
+        .AddParameter("expression", "B")
+        .SetFunctionName("myEventsExtension" + name);
+  }
+  platform.AddExtension(eventsFunctionsPlatformExtension);
+
+  auto &eventsExtension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  InsertNewExpressionFunction(eventsExtension,
+                              "Sum",
+                              "GetArgumentAsNumber(\"A\") + "
+                              "GetArgumentAsNumber(\"B\") * 2");
+  InsertNewExpressionFunction(
+      eventsExtension,
+      "Twice",
+      "GetArgumentAsNumber(\"A\") + GetArgumentAsNumber(\"A\")");
+  InsertNewExpressionFunction(
+      eventsExtension,
+      "Swapped",
+      "GetArgumentAsNumber(\"B\") - GetArgumentAsNumber(\"A\")");
+  InsertNewExpressionFunction(eventsExtension,
+                              "WithVariable",
+                              "GetArgumentAsNumber(\"A\") + MyVariable");
+
+  gd::ExpressionParser2 parser(platform, project, layout1);
+  unsigned int maxDepth = 0;
+  gd::EventsCodeGenerationContext context(&maxDepth);
+  gd::EventsCodeGenerator codeGenerator(project, layout1, platform);
+  codeGenerator.SetProjectForEventsFunctionsInlining(project);
+
+  auto generate = [&](const gd::String &expression) {
+    auto node = parser.ParseExpression("number", expression);
+    REQUIRE(node);
+    gd::ExpressionCodeGenerator expressionCodeGenerator(codeGenerator,
+                                                        context);
+    node->Visit(expressionCodeGenerator);
+    return expressionCodeGenerator.GetOutput();
+  };
+
+  SECTION("Inlinable expressions") {
+    REQUIRE(gd::EventsFunctionInliner::IsEventsFunction(
+        project, "MyEventsExtension::Sum"));
+    REQUIRE(!gd::EventsFunctionInliner::IsEventsFunction(
+        project, "MyExtension::GetNumber"));
+    REQUIRE(gd::EventsFunctionInliner::GetInlinableExpression(
+                platform, project, "MyEventsExtension::Sum") != nullptr);
+    REQUIRE(gd::EventsFunctionInliner::GetInlinableExpression(
+                platform, project, "MyEventsExtension::WithVariable") ==
+            nullptr);
+    REQUIRE(gd::EventsFunctionInliner::GetInlinableExpression(
+                platform, project, "MyExtension::GetNumber") == nullptr);
+
+    // Disabling the event makes the function not inlinable anymore.
+    eventsExtension.GetEventsFunction("Sum").GetEvents().GetEvent(0).SetDisabled(
+        true);
+    REQUIRE(gd::EventsFunctionInliner::GetInlinableExpression(
+                platform, project, "MyEventsExtension::Sum") == nullptr);
+  }
+
+  SECTION("Arguments are put in place of the parameters") {
+    REQUIRE(generate("MyEventsExtension::Sum(1, 2)") == "((1) + (2) * 2)");
+    REQUIRE(generate("MyEventsExtension::Sum(MyExtension::GetNumber(), 2)") ==
+            "((getNumber()) + (2) * 2)");
+
+    // Literals can be used any number of times.
+    REQUIRE(generate("MyEventsExtension::Twice(3, 4)") == "((3) + (3))");
+  }
+
+  SECTION("Arguments are not evaluated twice or in another order") {
+    REQUIRE(generate("MyEventsExtension::Twice(MyExtension::GetNumber(), 4)") ==
+            "myEventsExtensionTwice(getNumber(), 4)");
+    REQUIRE(generate("MyEventsExtension::Swapped(MyExtension::GetNumber(), "
+                     "MyExtension::GetNumber())") ==
+            "myEventsExtensionSwapped(getNumber(), getNumber())");
+    REQUIRE(generate("MyEventsExtension::Swapped(1, "
+                     "MyExtension::GetNumber())") ==
+            "((getNumber()) - (1))");
+  }
+
+  SECTION("Expressions are parsed once per code generation") {
+    const auto *inlinableExpression =
+        codeGenerator.GetInlinableExpression("MyEventsExtension::Sum");
+    REQUIRE(inlinableExpression != nullptr);
+    REQUIRE(codeGenerator.GetInlinableExpression("MyEventsExtension::Sum") ==
+            inlinableExpression);
+    REQUIRE(codeGenerator.GetInlinableExpression(
+                "MyEventsExtension::WithVariable") == nullptr);
+
+    // The parsed expression can be generated at every call.
+    REQUIRE(generate("MyEventsExtension::Sum(1, 2)") == "((1) + (2) * 2)");
+    REQUIRE(generate("MyEventsExtension::Sum(3, 4)") == "((3) + (4) * 2)");
+  }
+
+  SECTION("Functions using variables are not inlined") {
+    REQUIRE(generate("MyEventsExtension::WithVariable(1, 2)") ==
+            "myEventsExtensionWithVariable(1, 2)");
+  }
+
+  SECTION("Nothing is inlined unless enabled") {
+    gd::EventsCodeGenerator otherCodeGenerator(project, layout1, platform);
+    auto node = parser.ParseExpression("number", "MyEventsExtension::Sum(1, 2)");
+    REQUIRE(node);
+    gd::ExpressionCodeGenerator expressionCodeGenerator(otherCodeGenerator,
+                                                        context);
+    node->Visit(expressionCodeGenerator);
+    REQUIRE(expressionCodeGenerator.GetOutput() ==
+            "myEventsExtensionSum(1, 2)");
+  }
+}
@@ -0,0 +1,201 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+void InsertEventDoingSomething(gd::EventsList &events,
+                               const gd::String &parameter) {
+  gd::StandardEvent event;
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomething");
+  instruction.SetParametersCount(1);
+  instruction.SetParameter(0, gd::Expression(parameter));
+  event.GetActions().Insert(instruction);
+  events.InsertEvent(event);
+}
+
+gd::String GetResultsListName(
+    const gd::EventsListSearchResults &eventsListResults) {
+  return eventsListResults.GetExtensionName() + "/" +
+         eventsListResults.GetBehaviorName() + "/" +
+         eventsListResults.GetName();
+}
+}  // namespace
+
+TEST_CASE("EventsRefactorer", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  InsertEventDoingSomething(layout1.GetEvents(), "\"Hello world\"");
+  InsertEventDoingSomething(layout1.GetEvents(), "1 + 2");
+  InsertEventDoingSomething(layout1.GetEvents()[1].GetSubEvents(),
+                            "\"HELLO again\"");
+  auto &layout2 = project.InsertNewLayout("Layout2", 1);
+  InsertEventDoingSomething(layout2.GetEvents(), "\"Goodbye\"");
+  auto &externalEvents = project.InsertNewExternalEvents("External", 0);
+  InsertEventDoingSomething(externalEvents.GetEvents(), "\"Hello there\"");
+
+  auto &eventsExtension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  auto &eventsFunction =
+      eventsExtension.InsertNewEventsFunction("MyEventsFunction", 0);
+  InsertEventDoingSomething(eventsFunction.GetEvents(), "\"hello\"");
+  auto &behaviorEventsFunction =
+      eventsExtension.GetEventsBasedBehaviors()
+          .InsertNew("MyEventsBasedBehavior", 0)
+          .GetEventsFunctions()
+          .InsertNewEventsFunction("MyBehaviorEventsFunction", 0);
+  InsertEventDoingSomething(behaviorEventsFunction.GetEvents(), "\"Hello\"");
+
+  SECTION("Search in the events of a list") {
+    auto results = gd::EventsRefactorer::SearchInEvents(
+        platform, layout1.GetEvents(), "hello", false, true, true, true, false);
+    REQUIRE(results.size() == 2);
+    REQUIRE(&results[0].GetEventsList() == &layout1.GetEvents());
+    REQUIRE(results[0].GetPositionInList() == 0);
+    REQUIRE(&results[1].GetEventsList() ==
+            &layout1.GetEvents()[1].GetSubEvents());
+
+    // Ignored characters and spaces are removed from the search.
+    REQUIRE(gd::EventsRefactorer::SearchInEvents(platform,
+                                                 layout1.GetEvents(),
+                                                 "  (Hello)  ",
+                                                 true,
+                                                 true,
+                                                 true,
+                                                 true,
+                                                 false)
+                .size() == 1);
+    REQUIRE(gd::EventsRefactorer::SearchInEvents(platform,
+                                                 layout1.GetEvents(),
+                                                 "hello",
+                                                 false,
+                                                 true,
+                                                 false,
+                                                 true,
+                                                 false)
+                .empty());
+  }
+
+  SECTION("Search in all the events of the project") {
+    std::map<gd::String, std::size_t> resultsCounts;
+    std::map<gd::String, gd::EventsListSearchResults::EventsListType>
+        resultsTypes;
+    gd::EventsRefactorer::SearchInProjectEvents(
+        platform,
+        project,
+        "hello",
+        false,
+        true,
+        true,
+        true,
+        false,
+        [&](const gd::EventsListSearchResults &eventsListResults) {
+          gd::String name = GetResultsListName(eventsListResults);
+          REQUIRE(resultsCounts.find(name) == resultsCounts.end());
+          resultsCounts[name] = eventsListResults.GetResults().size();
+          resultsTypes[name] = eventsListResults.GetType();
+
+          // Results are the same as when searching in the list alone.
+          auto results = gd::EventsRefactorer::SearchInEvents(
+              platform,
+              eventsListResults.GetEventsList(),
+              "hello",
+              false,
+              true,
+              true,
+              true,
+              false);
+          REQUIRE(results.size() == eventsListResults.GetResults().size());
+          for (std::size_t i = 0; i < results.size(); ++i) {
+            REQUIRE(&results[i].GetEventsList() ==
+                    &eventsListResults.GetResults()[i].GetEventsList());
+            REQUIRE(results[i].GetPositionInList() ==
+                    eventsListResults.GetResults()[i].GetPositionInList());
+          }
+        });
+
+    // Lists without results are not reported.
+    REQUIRE(resultsCounts.size() == 4);
+    REQUIRE(resultsCounts["//Layout1"] == 2);
+    REQUIRE(resultsTypes["//Layout1"] ==
+            gd::EventsListSearchResults::Layout);
+    REQUIRE(resultsCounts["//External"] == 1);
+    REQUIRE(resultsTypes["//External"] ==
+            gd::EventsListSearchResults::ExternalEvents);
+    REQUIRE(resultsCounts["MyEventsExtension//MyEventsFunction"] == 1);
+    REQUIRE(resultsTypes["MyEventsExtension//MyEventsFunction"] ==
+            gd::EventsListSearchResults::ExtensionEventsFunction);
+    REQUIRE(resultsCounts["MyEventsExtension/MyEventsBasedBehavior/"
+                          "MyBehaviorEventsFunction"] == 1);
+    REQUIRE(resultsTypes["MyEventsExtension/MyEventsBasedBehavior/"
+                         "MyBehaviorEventsFunction"] ==
+            gd::EventsListSearchResults::BehaviorEventsFunction);
+  }
+
+  SECTION("Search in all the events of the project, matching the case") {
+    std::vector<gd::String> names;
+    gd::EventsRefactorer::SearchInProjectEvents(
+        platform,
+        project,
+        "Hello",
+        true,
+        true,
+        true,
+        true,
+        false,
+        [&](const gd::EventsListSearchResults &eventsListResults) {
+          names.push_back(GetResultsListName(eventsListResults));
+        });
+
+    std::sort(names.begin(), names.end());
+    REQUIRE(names == (std::vector<gd::String>{
+                         "//External",
+                         "//Layout1",
+                         "MyEventsExtension/MyEventsBasedBehavior/"
+                         "MyBehaviorEventsFunction"}));
+  }
+
+  SECTION("Errors when reporting results stop the search") {
+    std::size_t reportedCount = 0;
+    REQUIRE_THROWS_AS(
+        gd::EventsRefactorer::SearchInProjectEvents(
+            platform,
+            project,
+            "hello",
+            false,
+            true,
+            true,
+            true,
+            false,
+            [&](const gd::EventsListSearchResults &eventsListResults) {
+              reportedCount++;
+              throw std::runtime_error("Unable to report the results");
+            }),
+        const std::runtime_error &);
+    REQUIRE(reportedCount == 1);
+  }
+}
@@ -0,0 +1,233 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ExpressionCompletionIndex.h"
+
+#include <algorithm>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "catch.hpp"
+
+namespace {
+std::vector<gd::String> GetCompletionNames(
+    const gd::ExpressionCompletionIndex &index,
+    const gd::ExpressionCompletionDescription &description,
+    std::size_t maxCount = 100) {
+  std::vector<gd::String> names;
+  for (const auto &completion : index.GetCompletions(description, maxCount)) {
+    REQUIRE(completion.GetCompletionKind() ==
+            description.GetCompletionKind());
+    names.push_back(completion.GetCompletion());
+  }
+  return names;
+}
+}  // namespace
+
+TEST_CASE("ExpressionCompletionIndex", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  auto &mySpriteObject = layout1.InsertNewObject(
+      project, "MyExtension::Sprite", "MySpriteObject", 0);
+  mySpriteObject.AddNewBehavior(
+      project, "MyExtension::MyBehavior", "MyBehavior");
+  mySpriteObject.GetVariables().InsertNew("MyObjectVariable");
+  layout1.InsertNewObject(project,
+                          "MyExtension::FakeObjectWithUnsupportedCapability",
+                          "MyFakeObjectWithUnsupportedCapability",
+                          1);
+  project.InsertNewObject(
+      project, "MyExtension::Sprite", "MyGlobalSpriteObject", 0);
+  layout1.GetObjectGroups().InsertNew("MyGroup").AddObject("MySpriteObject");
+
+  auto &myStructure = layout1.GetVariables().InsertNew("MyStructure");
+  myStructure.GetChild("MyChild").SetValue(1);
+  myStructure.GetChild("Invalid child").SetValue(2);
+  layout1.GetVariables().InsertNew("My invalid variable");
+  project.GetVariables().InsertNew("MyGlobalVariable");
+
+  gd::ExpressionCompletionIndex index;
+  index.IndexPlatform(platform);
+  index.IndexObjects(project, layout1);
+  index.IndexVariables(project.GetVariables(), layout1.GetVariables());
+
+  SECTION("Free expressions") {
+    auto completions =
+        index.GetCompletions(gd::ExpressionCompletionDescription::ForExpression(
+                                 "number", "GetNumber", 0, 0),
+                             100);
+    REQUIRE(completions.size() == 3);
+    // Names starting with the prefix, ignoring the namespace, come first.
+    REQUIRE(completions[0].GetCompletion() == "MyExtension::GetNumber");
+    REQUIRE(completions[0].HasExpressionMetadata());
+    REQUIRE(completions[0].GetExpressionMetadata().GetFullName() ==
+            "Get me a number");
+    REQUIRE(completions[1].GetCompletion() ==
+            "MyExtension::GetNumberWith2Params");
+    REQUIRE(completions[2].GetCompletion() ==
+            "MyExtension::GetNumberWith3Params");
+
+    // Then the names containing it.
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "Mouse", 0, 0)) ==
+            std::vector<gd::String>({"MyExtension::MouseX"}));
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "variableasnumber", 0, 0)) ==
+            std::vector<gd::String>({"MyExtension::GetGlobalVariableAsNumber",
+                                     "MyExtension::GetVariableAsNumber"}));
+
+    // Only the requested type is returned.
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "string", "tostr", 0, 0)) ==
+            std::vector<gd::String>({"MyExtension::ToString"}));
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "tostr", 0, 0))
+                .empty());
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number|string", "tostr", 0, 0)) ==
+            std::vector<gd::String>({"MyExtension::ToString"}));
+
+    // The namespace can be typed.
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "string", "MyExtension::ToStr", 0, 0)) ==
+            std::vector<gd::String>({"MyExtension::ToString"}));
+
+    // The number of completions is limited.
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "GetNumber", 0, 0),
+                2) == std::vector<gd::String>({
+                          "MyExtension::GetNumber",
+                          "MyExtension::GetNumberWith2Params"}));
+  }
+
+  SECTION("Exact expressions") {
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "MyExtension::GetNumber", 0, 0)
+                    .SetIsExact(true)) ==
+            std::vector<gd::String>({"MyExtension::GetNumber"}));
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "GetNumber", 0, 0)
+                    .SetIsExact(true))
+                .empty());
+  }
+
+  SECTION("Object and behavior expressions") {
+    auto objectExpressions = GetCompletionNames(
+        index,
+        gd::ExpressionCompletionDescription::ForExpression(
+            "string", "", 0, 0, "MySpriteObject"));
+    REQUIRE(std::find(objectExpressions.begin(),
+                      objectExpressions.end(),
+                      "GetObjectStringWith1Param") != objectExpressions.end());
+    // Expressions of the base object are also listed.
+    REQUIRE(std::find(objectExpressions.begin(),
+                      objectExpressions.end(),
+                      "GetSomethingRequiringEffectCapability") !=
+            objectExpressions.end());
+
+    // ...unless they are not supported by the object.
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "string",
+                    "GetSomething",
+                    0,
+                    0,
+                    "MyFakeObjectWithUnsupportedCapability"))
+                .empty());
+
+    // Global objects and groups are also indexed.
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "GetObjectNumber", 0, 0, "MyGlobalSpriteObject"))
+                .size() == 1);
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "GetObjectNumber", 0, 0, "MyGroup"))
+                .size() == 1);
+
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "", 0, 0, "MySpriteObject", "MyBehavior"))
+                .size() == 1);
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForExpression(
+                    "number", "", 0, 0, "MySpriteObject", "UnknownBehavior"))
+                .empty());
+  }
+
+  SECTION("Objects and behaviors") {
+    REQUIRE(GetCompletionNames(index,
+                               gd::ExpressionCompletionDescription::ForObject(
+                                   "unknown", "myg", 0, 0)) ==
+            std::vector<gd::String>({"MyGlobalSpriteObject", "MyGroup"}));
+    REQUIRE(GetCompletionNames(index,
+                               gd::ExpressionCompletionDescription::ForObject(
+                                   "unknown", "sprite", 0, 0)) ==
+            std::vector<gd::String>({"MyGlobalSpriteObject", "MySpriteObject"}));
+
+    // Objects already fully typed are not suggested.
+    REQUIRE(GetCompletionNames(index,
+                               gd::ExpressionCompletionDescription::ForObject(
+                                   "unknown", "MySpriteObject", 0, 0))
+                .empty());
+
+    REQUIRE(GetCompletionNames(index,
+                               gd::ExpressionCompletionDescription::ForBehavior(
+                                   "My", 0, 0, "MySpriteObject")) ==
+            std::vector<gd::String>({"MyBehavior"}));
+    REQUIRE(GetCompletionNames(index,
+                               gd::ExpressionCompletionDescription::ForBehavior(
+                                   "My", 0, 0, "MyGlobalSpriteObject"))
+                .empty());
+  }
+
+  SECTION("Variables") {
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForVariable(
+                    "scenevar", "My", 0, 0)) ==
+            std::vector<gd::String>({"MyStructure", "MyStructure.MyChild"}));
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForVariable(
+                    "globalvar", "", 0, 0)) ==
+            std::vector<gd::String>({"MyGlobalVariable"}));
+    REQUIRE(GetCompletionNames(
+                index,
+                gd::ExpressionCompletionDescription::ForVariable(
+                    "objectvar", "", 0, 0, "MySpriteObject")) ==
+            std::vector<gd::String>({"MyObjectVariable"}));
+  }
+}
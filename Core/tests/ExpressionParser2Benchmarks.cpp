@@ -3,8 +3,7 @@
  * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
  * reserved. This project is released under the MIT License.
  */
-#include <chrono>
-#include <numeric>
+#include "BenchmarkTools.h"
 #include "DummyPlatform.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Extensions/Platform.h"
@@ -40,31 +39,8 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
     parseExpressionWithType("unknown");
   };
 
-  auto doBenchmark = [](const gd::String &benchmarkName,
-                        const size_t runsCount,
-                        std::function<void()> func) {
-    std::vector<long long> timesInMicroseconds;
-
-    for (size_t i = 0; i < runsCount; i++) {
-      auto start = std::chrono::steady_clock::now();
-      func();
-      auto end = std::chrono::steady_clock::now();
-
-      timesInMicroseconds.push_back(
-          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
-              .count());
-    }
-
-    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
-              << (float)std::accumulate(timesInMicroseconds.begin(),
-                                        timesInMicroseconds.end(),
-                                        0) /
-                     (float)runsCount
-              << " microseconds" << std::endl;
-  };
-
   SECTION("Parse long expression") {
-    doBenchmark("Parse long expression", 10, [&]() {
+    DoBenchmark("Parse long expression", 10, [&]() {
       REQUIRE_NOTHROW(parseExpression(
           "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
           "MySpriteObject.X()+MySpriteObject.X()/cos(3.123456789)+"
@@ -112,7 +88,7 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
   }
 
   SECTION("Parse long expression") {
-    doBenchmark("Long identifier", 100, [&]() {
+    DoBenchmark("Long identifier", 100, [&]() {
       REQUIRE_NOTHROW(parseExpression(
           "MyLoooooongIdentifierThatNeverStoooooopsAndContinueAgainAndAgainAndA"
           "gainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"
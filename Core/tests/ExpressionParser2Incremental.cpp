@@ -0,0 +1,142 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::String DescribeErrors(gd::ExpressionNode &node) {
+  gd::ExpressionValidator validator;
+  node.Visit(validator);
+
+  gd::String errors;
+  for (auto *error : validator.GetErrors()) {
+    errors += error->GetMessage() + " [" +
+              gd::String::From(error->GetStartPosition()) + "-" +
+              gd::String::From(error->GetEndPosition()) + "]\n";
+  }
+  return errors;
+}
+}  // namespace
+
+TEST_CASE("ExpressionParser2 incremental parsing", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  gd::ExpressionParser2 parser(platform, project, layout1);
+
+  // Apply an edit incrementally and check that the result is the same as
+  // parsing the whole new expression.
+  auto edit = [&](const gd::String &type,
+                  const gd::String &previousExpression,
+                  size_t editPosition,
+                  size_t removedLength,
+                  const gd::String &insertedText) {
+    auto node = parser.ParseExpression(type, previousExpression);
+    REQUIRE(node != nullptr);
+    gd::ExpressionNode *previousRoot = node.get();
+
+    gd::ExpressionNode &parsedNode =
+        parser.ParseExpressionIncrementally(type,
+                                            node,
+                                            previousExpression,
+                                            editPosition,
+                                            removedLength,
+                                            insertedText);
+
+    gd::String newExpression =
+        previousExpression.substr(0, editPosition) + insertedText +
+        previousExpression.substr(editPosition + removedLength);
+    auto expectedNode = parser.ParseExpression(type, newExpression);
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            gd::ExpressionParser2NodePrinter::PrintNode(*expectedNode));
+    REQUIRE(DescribeErrors(*node) == DescribeErrors(*expectedNode));
+    REQUIRE(node->location.GetStartPosition() ==
+            expectedNode->location.GetStartPosition());
+    REQUIRE(node->location.GetEndPosition() ==
+            expectedNode->location.GetEndPosition());
+
+    // Return if only a part of the tree was parsed again.
+    return node.get() == previousRoot && &parsedNode != previousRoot;
+  };
+
+  SECTION("Edits inside a parameter only parse the parameter") {
+    REQUIRE(edit("number", "MyExtension::GetNumberWith2Params(1, \"a\")", 34, 1,
+                 "12 + 3"));
+    REQUIRE(edit("number",
+                 "MyExtension::GetNumberWith2Params(1, \"a\") + 4",
+                 38,
+                 0,
+                 "bc"));
+    REQUIRE(edit("string", "MyExtension::ToString(1 + 2)", 26, 1, "3 * 4"));
+
+    // Nested functions: the innermost parameter is parsed again.
+    REQUIRE(edit("number",
+                 "MyExtension::GetNumberWith2Params("
+                 "MyExtension::GetNumberWith2Params(1, \"a\"), \"b\")",
+                 68,
+                 1,
+                 "2"));
+
+    // Errors are kept and updated.
+    REQUIRE(edit("string", "MyExtension::ToString(1 + \"a\")", 26, 3, "2"));
+    REQUIRE(edit("string", "MyExtension::ToString(1 + 2)", 23, 4, ""));
+    REQUIRE(edit("string", "MyExtension::ToString(1 + 2)", 22, 1, "\"1\""));
+  }
+
+  SECTION("Locations after the edit are moved") {
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(1, \"a\") + 4";
+    auto node = parser.ParseExpression("number", expression);
+    REQUIRE(node != nullptr);
+
+    gd::ExpressionNode &parameter = parser.ParseExpressionIncrementally(
+        "number", node, expression, 34, 1, "123");
+    REQUIRE(parameter.location.GetStartPosition() == 34);
+    REQUIRE(parameter.location.GetEndPosition() == 37);
+
+    auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*node);
+    REQUIRE(operatorNode.location.GetEndPosition() == 47);
+    REQUIRE(operatorNode.rightHandSide->location.GetStartPosition() == 46);
+    auto &function =
+        dynamic_cast<gd::FunctionCallNode &>(*operatorNode.leftHandSide);
+    REQUIRE(function.openingParenthesisLocation.GetStartPosition() == 33);
+    REQUIRE(function.closingParenthesisLocation.GetStartPosition() == 42);
+    REQUIRE(function.parameters[1]->location.GetStartPosition() == 39);
+  }
+
+  SECTION("Edits changing the structure parse the whole expression") {
+    // Edits outside of parameters.
+    REQUIRE(!edit("number", "MyExtension::GetNumberWith2Params(1, \"a\")", 0, 0,
+                  "2 + "));
+    REQUIRE(!edit("number", "MyExtension::GetNumberWith2Params(1, \"a\")", 12,
+                  1, ""));
+
+    // Edits adding or removing parameters.
+    REQUIRE(!edit("number", "MyExtension::GetNumberWith2Params(1, \"a\")", 35,
+                  0, ", 2"));
+    REQUIRE(!edit("number", "MyExtension::GetNumberWith2Params(1, \"a\")", 35,
+                  2, ""));
+    REQUIRE(!edit("string", "MyExtension::ToString(1 + 2)", 27, 0, ")"));
+    REQUIRE(!edit("string", "MyExtension::ToString(1 + 2)", 22, 6, ""));
+
+    // Edits opening a text or a parenthesis that is not closed.
+    REQUIRE(!edit("string", "MyExtension::ToString(1 + 2)", 26, 0, "\""));
+    REQUIRE(!edit("string", "MyExtension::ToString(1 + 2)", 26, 0, "("));
+
+    // Parameters that are not a number or a string.
+    REQUIRE(!edit("number", "MyExtension::GetVariableAsNumber(MyVar)", 35, 0,
+                  "2"));
+  }
+}
@@ -0,0 +1,161 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/FlattenedEventsTree.h"
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/IDE/Events/EventsPositionFinder.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * Check that the flattened tree is the same as the one made from scratch,
+ * and that visible events can be found.
+ */
+void RequireUpToDate(gd::FlattenedEventsTree &tree, gd::EventsList &events) {
+  gd::FlattenedEventsTree expectedTree(events);
+  REQUIRE(tree.GetEventsCount() == expectedTree.GetEventsCount());
+
+  gd::EventsPositionFinder positionFinder;
+  for (std::size_t i = 0; i < expectedTree.GetEventsCount(); ++i) {
+    REQUIRE(&tree.GetEventAt(i) == &expectedTree.GetEventAt(i));
+    REQUIRE(&tree.GetEventsListAt(i) == &expectedTree.GetEventsListAt(i));
+    REQUIRE(tree.GetDepthAt(i) == expectedTree.GetDepthAt(i));
+    REQUIRE(tree.IsFoldedAt(i) == expectedTree.IsFoldedAt(i));
+    REQUIRE(tree.IsVisibleAt(i) == expectedTree.IsVisibleAt(i));
+    REQUIRE(tree.GetSubtreeSizeAt(i) == expectedTree.GetSubtreeSizeAt(i));
+    REQUIRE(tree.GetPositionOf(tree.GetEventAt(i)) == i);
+    positionFinder.AddEventToSearch(&tree.GetEventAt(i));
+  }
+
+  // Positions are the same as the ones found by browsing the events.
+  positionFinder.Launch(events);
+  for (std::size_t i = 0; i < expectedTree.GetEventsCount(); ++i)
+    REQUIRE(positionFinder.GetPositions()[i] == i);
+
+  std::size_t visibleIndex = 0;
+  for (std::size_t i = 0; i < tree.GetEventsCount(); ++i) {
+    if (tree.IsVisibleAt(i)) {
+      REQUIRE(tree.GetVisibleIndexAt(i) == visibleIndex);
+      REQUIRE(tree.GetPositionOfVisibleEvent(visibleIndex) == i);
+      visibleIndex++;
+    } else {
+      REQUIRE(tree.GetVisibleIndexAt(i) == gd::String::npos);
+    }
+  }
+  REQUIRE(tree.GetVisibleEventsCount() == visibleIndex);
+  REQUIRE(tree.GetPositionOfVisibleEvent(visibleIndex) == gd::String::npos);
+}
+}  // namespace
+
+TEST_CASE("FlattenedEventsTree", "[common][events]") {
+  // Make events like:
+  // 0
+  //   0.0
+  //   0.1
+  //     0.1.0
+  // 1
+  // 2
+  //   2.0
+  gd::EventsList events;
+  gd::StandardEvent event;
+  for (std::size_t i = 0; i < 3; ++i) events.InsertEvent(event);
+  events[0].GetSubEvents().InsertEvent(event);
+  events[0].GetSubEvents().InsertEvent(event);
+  events[0].GetSubEvents()[1].GetSubEvents().InsertEvent(event);
+  events[2].GetSubEvents().InsertEvent(event);
+
+  gd::FlattenedEventsTree tree(events);
+
+  SECTION("Flattened events") {
+    REQUIRE(tree.GetEventsCount() == 7);
+    REQUIRE(&tree.GetEventAt(0) == &events[0]);
+    REQUIRE(&tree.GetEventAt(3) ==
+            &events[0].GetSubEvents()[1].GetSubEvents()[0]);
+    REQUIRE(&tree.GetEventAt(4) == &events[1]);
+    REQUIRE(&tree.GetEventsListAt(6) == &events[2].GetSubEvents());
+    REQUIRE(tree.GetDepthAt(3) == 2);
+    REQUIRE(tree.GetSubtreeSizeAt(0) == 4);
+    REQUIRE(tree.GetSubtreeSizeAt(2) == 2);
+    REQUIRE(tree.GetSubtreeSizeAt(4) == 1);
+    REQUIRE(tree.GetVisibleEventsCount() == 7);
+    RequireUpToDate(tree, events);
+
+    gd::StandardEvent otherEvent;
+    REQUIRE(tree.GetPositionOf(otherEvent) == gd::String::npos);
+  }
+
+  SECTION("Folding") {
+    tree.SetFolded(events[0].GetSubEvents()[1], true);
+    REQUIRE(events[0].GetSubEvents()[1].IsFolded());
+    REQUIRE(tree.GetVisibleEventsCount() == 6);
+    REQUIRE(!tree.IsVisibleAt(3));
+    RequireUpToDate(tree, events);
+
+    tree.SetFolded(events[0], true);
+    REQUIRE(tree.GetVisibleEventsCount() == 4);
+    REQUIRE(tree.GetPositionOfVisibleEvent(1) == 4);
+    RequireUpToDate(tree, events);
+
+    // Unfolding keeps the folded sub events folded.
+    tree.SetFolded(events[0], false);
+    REQUIRE(tree.GetVisibleEventsCount() == 6);
+    RequireUpToDate(tree, events);
+  }
+
+  SECTION("Insertions") {
+    gd::StandardEvent eventWithSubEvents;
+    eventWithSubEvents.GetSubEvents().InsertEvent(event);
+    eventWithSubEvents.GetSubEvents().InsertEvent(event);
+
+    tree.InsertEvent(eventWithSubEvents, events, 1);
+    RequireUpToDate(tree, events);
+    tree.InsertEvent(eventWithSubEvents, events[0].GetSubEvents(), 2);
+    RequireUpToDate(tree, events);
+    tree.InsertEvent(event, events, 100);
+    RequireUpToDate(tree, events);
+    REQUIRE(tree.GetEventsCount() == 14);
+
+    // Inserting in a folded event.
+    tree.SetFolded(events[3], true);
+    gd::BaseEvent &insertedEvent =
+        tree.InsertEvent(eventWithSubEvents, events[3].GetSubEvents(), 0);
+    REQUIRE(!tree.IsVisibleAt(tree.GetPositionOf(insertedEvent)));
+    RequireUpToDate(tree, events);
+  }
+
+  SECTION("Removals") {
+    tree.RemoveEvent(events[0].GetSubEvents(), 1);
+    RequireUpToDate(tree, events);
+    REQUIRE(tree.GetEventsCount() == 5);
+
+    tree.SetFolded(events[0], true);
+    tree.RemoveEvent(events, 0);
+    RequireUpToDate(tree, events);
+    REQUIRE(tree.GetVisibleEventsCount() == 3);
+  }
+
+  SECTION("Moves") {
+    tree.SetFolded(events[2], true);
+    REQUIRE(tree.MoveEventToAnotherEventsList(
+        events[0].GetSubEvents()[1], events[2].GetSubEvents(), 0));
+    RequireUpToDate(tree, events);
+    REQUIRE(tree.GetVisibleEventsCount() == 4);
+
+    REQUIRE(tree.MoveEventToAnotherEventsList(
+        events[2], events[0].GetSubEvents(), 1));
+    RequireUpToDate(tree, events);
+
+    REQUIRE(tree.MoveEventToAnotherEventsList(events[1], events, 0));
+    RequireUpToDate(tree, events);
+    REQUIRE(tree.MoveEventToAnotherEventsList(events[0], events, 100));
+    RequireUpToDate(tree, events);
+
+    gd::StandardEvent otherEvent;
+    REQUIRE(!tree.MoveEventToAnotherEventsList(otherEvent, events, 0));
+  }
+}
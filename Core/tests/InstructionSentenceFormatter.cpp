@@ -0,0 +1,130 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
+
+#include <atomic>
+#include <thread>
+
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String &type,
+                                const std::vector<gd::String> &parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+
+std::vector<gd::String> GetTexts(
+    const std::vector<std::pair<gd::String, gd::TextFormatting> >
+        &formattedTexts) {
+  std::vector<gd::String> texts;
+  for (const auto &formattedText : formattedTexts)
+    texts.push_back(formattedText.first);
+  return texts;
+}
+}  // namespace
+
+TEST_CASE("InstructionSentenceFormatter", "[common][events]") {
+  gd::PlatformExtension extension;
+  extension.SetExtensionInformation(
+      "MyExtension", "My testing extension", "", "", "");
+  auto &metadata =
+      extension
+          .AddAction("Move",
+                     "Move an object",
+                     "",
+                     "Move _PARAM0_ to _PARAM2_;_PARAM1_ (in\nlayer _PARAM3_)",
+                     "",
+                     "",
+                     "")
+          .AddParameter("object", "Object")
+          .AddParameter("expression", "Y")
+          .AddParameter("expression", "X")
+          .AddParameter("layer", "Layer");
+  auto &formatter = *gd::InstructionSentenceFormatter::Get();
+  formatter.ClearCache();
+
+  auto formattedTexts = formatter.GetAsFormattedText(
+      MakeInstruction("MyExtension::Move",
+                      {"MyObject", "20", "10", "\"My\nlayer\""}),
+      metadata);
+  REQUIRE(GetTexts(formattedTexts) ==
+          std::vector<gd::String>({"Move ",
+                                   "MyObject",
+                                   " to ",
+                                   "10",
+                                   ";",
+                                   "20",
+                                   " (in layer ",
+                                   "\"My layer\"",
+                                   ")"}));
+  REQUIRE(formattedTexts[1].second.userData == 0);
+  REQUIRE(formattedTexts[3].second.userData == 2);
+  REQUIRE(formattedTexts[5].second.userData == 1);
+  REQUIRE(formattedTexts[7].second.userData == 3);
+  REQUIRE(formattedTexts[0].second.userData == gd::String::npos);
+
+  // Formatting is the same when done again...
+  REQUIRE(GetTexts(formatter.GetAsFormattedText(
+              MakeInstruction("MyExtension::Move",
+                              {"MyObject", "20", "10", "\"My\nlayer\""}),
+              metadata)) == GetTexts(formattedTexts));
+
+  // ...but depends on the parameters...
+  REQUIRE(GetTexts(formatter.GetAsFormattedText(
+              MakeInstruction("MyExtension::Move",
+                              {"MyObject", "30", "10", "\"My\nlayer\""}),
+              metadata))[5] == "30");
+  REQUIRE(GetTexts(formatter.GetAsFormattedText(
+              MakeInstruction("MyExtension::Move", {"MyObject"}), metadata))
+              .size() == 9);
+
+  // ...and on the sentence.
+  auto &otherMetadata =
+      extension
+          .AddAction("MoveAway",
+                     "Move an object away",
+                     "",
+                     "Move _PARAM0_ away",
+                     "",
+                     "",
+                     "")
+          .AddParameter("object", "Object");
+  REQUIRE(GetTexts(formatter.GetAsFormattedText(
+              MakeInstruction("MyExtension::MoveAway", {"MyObject"}),
+              otherMetadata)) ==
+          std::vector<gd::String>({"Move ", "MyObject", " away"}));
+  REQUIRE(formatter.GetFullText(
+              MakeInstruction("MyExtension::MoveAway", {"MyOtherObject"}),
+              otherMetadata) == "Move MyOtherObject away");
+
+  // Sentences can be formatted from several threads, even while the caches
+  // are cleared.
+  std::atomic<std::size_t> wrongSentencesCount(0);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      for (std::size_t i = 0; i < 200; ++i) {
+        gd::String objectName = "Object" + gd::String::From(t * 1000 + i);
+        if (formatter.GetFullText(
+                MakeInstruction("MyExtension::MoveAway", {objectName}),
+                otherMetadata) != "Move " + objectName + " away")
+          wrongSentencesCount++;
+        if (i % 50 == 0) formatter.ClearCache();
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  REQUIRE(wrongSentencesCount == 0);
+}
@@ -0,0 +1,134 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/LocalFileSystem.h"
+
+#include "BenchmarkTools.h"
+#include "catch.hpp"
+
+namespace {
+gd::String MakeTestDirectory(gd::LocalFileSystem& fs, const gd::String& name) {
+  gd::String directory = fs.GetTempDir() + "/GDCore_tests/" + name;
+  fs.MkDir(directory);
+  fs.ClearDir(directory);
+  return directory;
+}
+}  // namespace
+
+TEST_CASE("LocalFileSystem", "[common]") {
+  gd::LocalFileSystem fs;
+
+  SECTION("Paths") {
+    gd::String filename = "../images/./player.png";
+    REQUIRE(fs.MakeAbsolute(filename, "/game/project"));
+    REQUIRE(filename == "/game/images/player.png");
+    REQUIRE(fs.IsAbsolute(filename));
+    REQUIRE_FALSE(fs.IsAbsolute("images/player.png"));
+#if defined(WINDOWS)
+    REQUIRE(fs.IsAbsolute("C:\\game\\player.png"));
+#else
+    // Drive letters are only a thing on Windows.
+    REQUIRE_FALSE(fs.IsAbsolute("C:\\game\\player.png"));
+    REQUIRE_FALSE(fs.IsAbsolute("C:"));
+#endif
+
+    REQUIRE(fs.MakeRelative(filename, "/game/project"));
+    REQUIRE(filename == "../images/player.png");
+
+    REQUIRE(fs.FileNameFrom("/game/images/player.png") == "player.png");
+    REQUIRE(fs.DirNameFrom("/game/images/player.png") == "/game/images");
+    REQUIRE(fs.DirNameFrom("/player.png") == "/");
+  }
+
+  SECTION("Files") {
+    gd::String directory = MakeTestDirectory(fs, "Files");
+    REQUIRE(fs.DirExists(directory));
+
+    REQUIRE(fs.WriteToFile(directory + "/file.txt", u8"Hello Ԙ"));
+    REQUIRE(fs.AppendToFile(directory + "/file.txt", " world"));
+    REQUIRE(fs.FileExists(directory + "/file.txt"));
+    REQUIRE_FALSE(fs.DirExists(directory + "/file.txt"));
+    REQUIRE(fs.ReadFile(directory + "/file.txt") == u8"Hello Ԙ world");
+
+    double size, modificationTime;
+    REQUIRE(fs.GetFileStats(directory + "/file.txt", size, modificationTime));
+    REQUIRE(size == 14);  // "Ԙ" is encoded with 2 bytes.
+    REQUIRE_FALSE(
+        fs.GetFileStats(directory + "/missing.txt", size, modificationTime));
+
+    REQUIRE(fs.CopyFile(directory + "/file.txt", directory + "/copy.txt"));
+    REQUIRE(fs.GetFileHash(directory + "/copy.txt") ==
+            fs.GetFileHash(directory + "/file.txt"));
+    REQUIRE(fs.GetFileHash(directory + "/copy.txt").size() == 16);
+    REQUIRE(fs.ReadDir(directory, ".TXT").size() == 2);
+
+    fs.MkDir(directory + "/sub/empty");
+    REQUIRE(fs.WriteToFile(directory + "/sub/kept.txt", "Kept"));
+    REQUIRE(fs.ClearDirExcept(directory, {directory + "/./sub/kept.txt"}));
+    REQUIRE(fs.FileExists(directory + "/sub/kept.txt"));
+    REQUIRE_FALSE(fs.FileExists(directory + "/copy.txt"));
+    REQUIRE_FALSE(fs.DirExists(directory + "/sub/empty"));
+
+    REQUIRE(fs.ClearDir(directory));
+    REQUIRE_FALSE(fs.FileExists(directory + "/file.txt"));
+    REQUIRE(fs.DirExists(directory));
+  }
+
+  SECTION("Copy of a batch of files") {
+    gd::String directory = MakeTestDirectory(fs, "CopyFiles");
+    std::vector<gd::AbstractFileSystem::FileCopy> copies;
+    for (std::size_t i = 0; i < 50; ++i) {
+      gd::String file = directory + "/file" + gd::String::From(i) + ".txt";
+      fs.WriteToFile(file, "Content " + gd::String::From(i));
+      copies.push_back(gd::AbstractFileSystem::FileCopy(
+          file,
+          directory + "/copies/" + gd::String::From(i % 5) + "/file" +
+              gd::String::From(i) + ".txt"));
+    }
+    copies.push_back(gd::AbstractFileSystem::FileCopy(
+        directory + "/missing.txt", directory + "/copies/missing.txt"));
+
+    REQUIRE(fs.GetMaxConcurrentCopies() >= 1);
+    fs.SetMaxConcurrentCopies(4);
+    auto errors = fs.CopyFiles(copies);
+    REQUIRE(errors.size() == 1);
+    REQUIRE(errors[0].file == directory + "/missing.txt");
+    REQUIRE(!errors[0].message.empty());
+
+    REQUIRE(fs.ReadFile(directory + "/copies/2/file42.txt") == "Content 42");
+    REQUIRE(fs.ReadDir(directory + "/copies/4").size() == 10);
+  }
+}
+
+TEST_CASE("LocalFileSystem - Benchmarks", "[common][.]") {
+  gd::LocalFileSystem fs;
+  gd::String directory = MakeTestDirectory(fs, "Benchmarks");
+
+  std::vector<gd::AbstractFileSystem::FileCopy> copies;
+  gd::String content = "0123456789abcdef";
+  for (std::size_t i = 0; i < 8; ++i) content += content;  // 4 KiB files.
+  for (std::size_t i = 0; i < 2000; ++i) {
+    gd::String file = directory + "/file" + gd::String::From(i) + ".bin";
+    fs.WriteToFile(file, content);
+    copies.push_back(gd::AbstractFileSystem::FileCopy(
+        file,
+        directory + "/copies/" + gd::String::From(i % 20) + "/file" +
+            gd::String::From(i) + ".bin"));
+  }
+
+  auto benchmarkCopies = [&](const gd::String& benchmarkName,
+                             std::size_t maxConcurrentCopies) {
+    fs.ClearDir(directory + "/copies");
+    fs.SetMaxConcurrentCopies(maxConcurrentCopies);
+    DoBenchmark(benchmarkName, 1, [&]() {
+      REQUIRE(fs.CopyFiles(copies).empty());
+    });
+  };
+
+  benchmarkCopies("LocalFileSystem::CopyFiles of 2000 files (1 thread)", 1);
+  benchmarkCopies("LocalFileSystem::CopyFiles of 2000 files (8 threads)", 8);
+
+  fs.ClearDir(directory);
+}
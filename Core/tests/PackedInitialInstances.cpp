@@ -0,0 +1,82 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Project/PackedInitialInstances.h"
+
+#include <cstring>
+
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Tools/PackedStrings.h"
+#include "catch.hpp"
+
+TEST_CASE("PackedStrings", "[common]") {
+  gd::PackedStrings strings({"Hello", "", u8"Ελληνικά"});
+  REQUIRE(strings.GetCount() == 3);
+  REQUIRE(strings.Add("World") == 3);
+
+  REQUIRE(strings.Get(0) == "Hello");
+  REQUIRE(strings.Get(1) == "");
+  REQUIRE(strings.Get(2) == u8"Ελληνικά");
+  REQUIRE(strings.Get(3) == "World");
+  REQUIRE(strings.Get(4) == "");
+
+  // Strings are stored null terminated, one after the other.
+  REQUIRE(strings.GetOffsets() == std::vector<std::uint32_t>({0, 6, 7, 24}));
+  REQUIRE(strings.GetData().size() == 30);
+  REQUIRE(std::strcmp(&strings.GetData()[strings.GetOffsets()[3]], "World") ==
+          0);
+
+  strings.Clear();
+  REQUIRE(strings.GetCount() == 0);
+  REQUIRE(strings.GetData().empty());
+}
+
+TEST_CASE("PackedInitialInstances", "[common]") {
+  gd::InitialInstancesContainer instances;
+  auto addInstance = [&instances](const gd::String& objectName,
+                                  const gd::String& layer,
+                                  double x,
+                                  double y,
+                                  int zOrder) {
+    gd::InitialInstance& instance = instances.InsertNewInitialInstance();
+    instance.SetObjectName(objectName);
+    instance.SetLayer(layer);
+    instance.SetX(x);
+    instance.SetY(y);
+    instance.SetZOrder(zOrder);
+    return std::ref(instance);
+  };
+  addInstance("Player", "", 10, 20, 1).get().SetAngle(90);
+  addInstance("Enemy", "Foreground", -5.5, 30, 2);
+  addInstance("Enemy", "", 100, 200, -3);
+
+  gd::PackedInitialInstances packedInstances;
+  packedInstances.Pack(instances);
+  REQUIRE(packedInstances.GetInstancesCount() == 3);
+  REQUIRE(packedInstances.GetPositions() ==
+          std::vector<double>({10, 20, -5.5, 30, 100, 200}));
+  REQUIRE(packedInstances.GetAngles() == std::vector<double>({90, 0, 0}));
+  REQUIRE(packedInstances.GetZOrders() == std::vector<std::int32_t>({1, 2, -3}));
+
+  // Names are stored once.
+  REQUIRE(packedInstances.GetLayers() == std::vector<std::uint32_t>({0, 1, 0}));
+  REQUIRE(packedInstances.GetLayerNames().GetCount() == 2);
+  REQUIRE(packedInstances.GetLayerNames().Get(1) == "Foreground");
+  REQUIRE(packedInstances.GetObjects() ==
+          std::vector<std::uint32_t>({0, 1, 1}));
+  REQUIRE(packedInstances.GetObjectNames().GetCount() == 2);
+  REQUIRE(packedInstances.GetObjectNames().Get(0) == "Player");
+
+  // Packing again replaces the stored instances.
+  gd::InitialInstancesContainer otherInstances;
+  otherInstances.InsertNewInitialInstance().SetObjectName("Coin");
+  packedInstances.Pack(otherInstances);
+  REQUIRE(packedInstances.GetInstancesCount() == 1);
+  REQUIRE(packedInstances.GetPositions().size() == 2);
+  REQUIRE(packedInstances.GetObjectNames().GetCount() == 1);
+  REQUIRE(packedInstances.GetObjectNames().Get(0) == "Coin");
+  REQUIRE(packedInstances.GetLayerNames().GetCount() == 1);
+}
@@ -0,0 +1,240 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+
+#include <algorithm>
+#include <map>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief A file system storing files in memory, with a modification time
+ * increased at each write.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  struct File {
+    gd::String content;
+    double modificationTime;
+  };
+
+  virtual void MkDir(const gd::String& path) { directories[path] = true; };
+  virtual bool DirExists(const gd::String& path) {
+    return directories.find(path) != directories.end();
+  };
+  virtual bool FileExists(const gd::String& path) {
+    return files.find(path) != files.end();
+  };
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    return file.substr(file.rfind("/") + 1);
+  };
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    return file.substr(0, file.rfind("/"));
+  };
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (filename.find(baseDirectory + "/") != 0) return false;
+    filename = filename.substr(baseDirectory.size() + 1);
+    return true;
+  };
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    if (!FileExists(file)) return false;
+    copiedFiles.push_back(destination);
+    return WriteToFile(destination, files[file].content);
+  }
+  virtual bool ClearDir(const gd::String& directory) { return true; }
+  virtual bool ClearDirExcept(const gd::String& directory,
+                              const std::vector<gd::String>& filesToKeep) {
+    for (auto it = files.begin(); it != files.end();) {
+      if (it->first.find(directory + "/") == 0 &&
+          std::find(filesToKeep.begin(), filesToKeep.end(), it->first) ==
+              filesToKeep.end())
+        it = files.erase(it);
+      else
+        ++it;
+    }
+    return true;
+  }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    files[file].content = content;
+    files[file].modificationTime = ++time;
+    return true;
+  }
+  virtual gd::String ReadFile(const gd::String& file) {
+    return files[file].content;
+  }
+  virtual bool GetFileStats(const gd::String& file,
+                            double& size,
+                            double& modificationTime) {
+    if (!FileExists(file)) return false;
+    size = files[file].content.size();
+    modificationTime = files[file].modificationTime;
+    return true;
+  }
+  virtual gd::String GetFileHash(const gd::String& file) {
+    hashedFiles.push_back(file);
+    return "hash of " + files[file].content;
+  }
+  virtual gd::String GetTempDir() { return "/tmp"; }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return std::vector<gd::String>();
+  }
+
+  InMemoryFileSystem() : time(0){};
+  virtual ~InMemoryFileSystem(){};
+
+  std::map<gd::String, File> files;
+  std::map<gd::String, bool> directories;
+  std::vector<gd::String> copiedFiles;
+  std::vector<gd::String> hashedFiles;
+  double time;
+};
+}  // namespace
+
+TEST_CASE("ProjectResourcesCopier", "[common][resources]") {
+  InMemoryFileSystem fs;
+  fs.WriteToFile("/project/image1.png", "Image 1");
+  fs.WriteToFile("/project/image2.png", "Image 2");
+  fs.WriteToFile("/project/sub/image3.png", "Image 1");  // Same as image1.
+
+  gd::Project project;
+  project.SetProjectFile("/project/game.json");
+  project.GetResourcesManager().AddResource(
+      "Image1", "image1.png", "image");
+  project.GetResourcesManager().AddResource(
+      "Image2", "image2.png", "image");
+  project.GetResourcesManager().AddResource(
+      "Image3", "sub/image3.png", "image");
+
+  SECTION("Copy without updating the project") {
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", false, true, true);
+
+    REQUIRE(fs.copiedFiles.size() == 3);
+    REQUIRE(fs.files["/export/sub/image3.png"].content == "Image 1");
+    REQUIRE(fs.DirExists("/export/sub"));
+    REQUIRE_FALSE(fs.FileExists(
+        "/export/" + gd::ProjectResourcesCopier::GetManifestFilename()));
+    REQUIRE(project.GetResourcesManager().GetResource("Image3").GetFile() ==
+            "sub/image3.png");
+  }
+
+  SECTION("Incremental copies") {
+    gd::ResourcesManager resourcesManager = project.GetResourcesManager();
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, resourcesManager, fs, "/export", true, true, true);
+
+    // Identical files are only copied once.
+    REQUIRE(fs.copiedFiles.size() == 2);
+    REQUIRE(fs.FileExists("/export/image1.png"));
+    REQUIRE(fs.FileExists("/export/image2.png"));
+    REQUIRE_FALSE(fs.FileExists("/export/sub/image3.png"));
+    REQUIRE(resourcesManager.GetResource("Image1").GetFile() == "image1.png");
+    REQUIRE(resourcesManager.GetResource("Image3").GetFile() == "image1.png");
+    REQUIRE(fs.FileExists(
+        "/export/" + gd::ProjectResourcesCopier::GetManifestFilename()));
+
+    // Unchanged files are neither copied nor hashed again.
+    fs.copiedFiles.clear();
+    fs.hashedFiles.clear();
+    resourcesManager = project.GetResourcesManager();
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, resourcesManager, fs, "/export", true, true, true);
+    REQUIRE(fs.copiedFiles.empty());
+    REQUIRE(fs.hashedFiles.empty());
+    REQUIRE(resourcesManager.GetResource("Image3").GetFile() == "image1.png");
+
+    // Modified files are copied again.
+    fs.WriteToFile("/project/image2.png", "Image 2, modified");
+    resourcesManager = project.GetResourcesManager();
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, resourcesManager, fs, "/export", true, true, true);
+    REQUIRE(fs.copiedFiles.size() == 1);
+    REQUIRE(fs.files["/export/image2.png"].content == "Image 2, modified");
+
+    // Files touched without being modified are hashed but not copied.
+    fs.copiedFiles.clear();
+    fs.WriteToFile("/project/image2.png", "Image 2, modified");
+    resourcesManager = project.GetResourcesManager();
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, resourcesManager, fs, "/export", true, true, true);
+    REQUIRE(fs.copiedFiles.empty());
+
+    // Files removed from the destination are copied again.
+    fs.files.erase("/export/image1.png");
+    resourcesManager = project.GetResourcesManager();
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, resourcesManager, fs, "/export", true, true, true);
+    REQUIRE(fs.copiedFiles.size() == 1);
+    REQUIRE(fs.copiedFiles[0] == "/export/image1.png");
+
+    // Only the copied files and the manifest are kept when clearing.
+    fs.WriteToFile("/export/code.js", "Code");
+    gd::ProjectResourcesCopier::ClearDirExceptCopiedResources(fs, "/export");
+    REQUIRE_FALSE(fs.FileExists("/export/code.js"));
+    REQUIRE(fs.FileExists("/export/image1.png"));
+    REQUIRE(fs.FileExists("/export/image2.png"));
+    REQUIRE(fs.FileExists(
+        "/export/" + gd::ProjectResourcesCopier::GetManifestFilename()));
+  }
+
+  SECTION("Files referenced directly by events") {
+    gd::Platform platform;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Layout1", 0);
+    REQUIRE_FALSE(
+        gd::ProjectResourcesCopier::HasFilesOutsideOfResources(project));
+
+    project.GetResourcesManager().AddResource("Sound", "sound.wav", "audio");
+    gd::StandardEvent event;
+    gd::Instruction instruction;
+    instruction.SetType("MyExtension::DoSomethingWithResources");
+    instruction.SetParametersCount(3);
+    instruction.SetParameter(2, gd::Expression("Sound"));
+    event.GetActions().Insert(instruction);
+    layout.GetEvents().InsertEvent(event);
+    REQUIRE_FALSE(
+        gd::ProjectResourcesCopier::HasFilesOutsideOfResources(project));
+
+    // Older projects refer to audio files instead of resources.
+    instruction.SetParameter(2, gd::Expression("sounds/sound.wav"));
+    event.GetActions().Insert(instruction);
+    layout.GetEvents().InsertEvent(event);
+    REQUIRE(gd::ProjectResourcesCopier::HasFilesOutsideOfResources(project));
+
+    // These files are not deduplicated, as only resources would be updated.
+    fs.WriteToFile("/project/sound.wav", "Sound");
+    fs.WriteToFile("/project/sounds/sound.wav", "Sound");
+    gd::ProjectResourcesCopier::CopyAllResourcesTo(
+        project, fs, "/export", true, true, true, true);
+    REQUIRE(fs.FileExists("/export/sound.wav"));
+    REQUIRE(fs.FileExists("/export/sounds/sound.wav"));
+    auto& insertedEvent =
+        dynamic_cast<gd::StandardEvent&>(layout.GetEvents().GetEvent(1));
+    REQUIRE(insertedEvent.GetActions()
+                .Get(1)
+                .GetParameter(2)
+                .GetPlainString() == "sounds/sound.wav");
+  }
+}
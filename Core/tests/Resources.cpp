@@ -32,4 +32,71 @@ TEST_CASE("Resources", "[common][resources]") {
     image.SetFile("Lots\\\\Of\\\\\\..\\Backslashs");
     REQUIRE(image.GetFile() == "Lots//Of///../Backslashs");
   }
+  SECTION("Lookups in ResourcesManager") {
+    gd::ResourcesManager resourcesManager;
+    resourcesManager.AddResource("Image1", "images/image1.png", "image");
+    resourcesManager.AddResource("Image2", "images/image2.png", "image");
+    resourcesManager.AddResource("Audio1", "audio/audio1.wav", "audio");
+    resourcesManager.GetResource("Image2").SetOrigin("asset-store", "id-2");
+
+    REQUIRE(resourcesManager.HasResource("Image1"));
+    REQUIRE(!resourcesManager.HasResource("Image3"));
+    REQUIRE(resourcesManager.GetResourcePosition("Audio1") == 2);
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/image2.png") ==
+            "Image2");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images\\image2.png") ==
+            "Image2");
+    REQUIRE(resourcesManager.GetResourceNameWithOrigin("asset-store",
+                                                       "id-2") == "Image2");
+    REQUIRE(resourcesManager.GetResourceNameWithOrigin("asset-store", "id-1") ==
+            "");
+
+    // Indexes are kept up to date when resources are modified...
+    resourcesManager.RenameResource("Image1", "RenamedImage1");
+    REQUIRE(!resourcesManager.HasResource("Image1"));
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedImage1") == 0);
+    resourcesManager.GetResource("RenamedImage1").SetFile("images/new.png");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/image1.png") ==
+            "");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/new.png") ==
+            "RenamedImage1");
+    resourcesManager.GetResource("Audio1").SetOrigin("asset-store", "id-1");
+    REQUIRE(resourcesManager.GetResourceNameWithOrigin("asset-store", "id-1") ==
+            "Audio1");
+
+    // ...moved...
+    resourcesManager.MoveResource(2, 0);
+    REQUIRE(resourcesManager.GetResourcePosition("Audio1") == 0);
+    REQUIRE(resourcesManager.GetResourcePosition("RenamedImage1") == 1);
+    REQUIRE(resourcesManager.MoveResourceDownInList("Audio1"));
+    REQUIRE(resourcesManager.GetResourcePosition("Audio1") == 1);
+
+    // ...or removed.
+    resourcesManager.RemoveResource("RenamedImage1");
+    REQUIRE(resourcesManager.GetResourcePosition("Audio1") == 0);
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/new.png") == "");
+
+    // The first resource using a file is returned.
+    resourcesManager.AddResource("OtherImage2", "images/image2.png", "image");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/image2.png") ==
+            "Image2");
+    REQUIRE(resourcesManager.FindFilesNotInResources(
+                {"images/image2.png", "images/image3.png"}) ==
+            std::vector<gd::String>{"images/image3.png"});
+    resourcesManager.GetResource("Image2").SetFile("images/other.png");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/image2.png") ==
+            "OtherImage2");
+    resourcesManager.GetResource("OtherImage2").SetFile("images/other.png");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/image2.png") ==
+            "");
+    REQUIRE(resourcesManager.GetResourceNameWithFile("images/other.png") ==
+            "Image2");
+
+    // Copies have their own indexes, not updated by the original resources.
+    gd::ResourcesManager resourcesManagerCopy = resourcesManager;
+    resourcesManager.GetResource("Image2").SetName("RenamedImage2");
+    REQUIRE(resourcesManagerCopy.HasResource("Image2"));
+    REQUIRE(!resourcesManagerCopy.HasResource("RenamedImage2"));
+    REQUIRE(resourcesManager.HasResource("RenamedImage2"));
+  }
 }
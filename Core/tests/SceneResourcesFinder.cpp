@@ -0,0 +1,103 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/SceneResourcesFinder.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+void InsertSpriteObject(gd::ObjectsContainer& objects,
+                        const gd::String& name,
+                        const gd::String& imageName) {
+  gd::SpriteObject object(name);
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  gd::Sprite sprite;
+  sprite.SetImageName(imageName);
+  animation.GetDirection(0).AddSprite(sprite);
+  object.AddAnimation(animation);
+  objects.InsertObject(object, 0);
+}
+
+void InsertResourcesAction(gd::EventsList& events,
+                           const gd::String& imageName,
+                           const gd::String& audioName) {
+  gd::StandardEvent standardEvent;
+  gd::Instruction instruction;
+  instruction.SetType("MyExtension::DoSomethingWithResources");
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(1, imageName);
+  instruction.SetParameter(2, audioName);
+  standardEvent.GetActions().Insert(instruction);
+  events.InsertEvent(standardEvent);
+}
+}  // namespace
+
+TEST_CASE("SceneResourcesFinder", "[common][resources]") {
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& resources = project.GetResourcesManager();
+  resources.AddResource("GlobalImage", "global.png", "image");
+  resources.AddResource("Image1", "image1.png", "image");
+  resources.AddResource("Image2", "image2.png", "image");
+  resources.AddResource("EventsImage1", "events-image1.png", "image");
+  resources.AddResource("ExternalEventsImage", "external.png", "image");
+  resources.AddResource("Music1", "music1.ogg", "audio");
+  resources.AddResource("Unused", "unused.png", "image");
+
+  InsertSpriteObject(project, "GlobalObject", "GlobalImage");
+  auto& layout1 = project.InsertNewLayout("Scene1", 0);
+  auto& layout2 = project.InsertNewLayout("Scene2", 1);
+  InsertSpriteObject(layout1, "Object1", "Image1");
+  InsertSpriteObject(layout2, "Object2", "Image2");
+
+  InsertResourcesAction(layout1.GetEvents(), "EventsImage1", "Music1");
+  // An old event referring directly to a file.
+  InsertResourcesAction(layout2.GetEvents(), "", "sounds/legacy.wav");
+
+  auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+  InsertResourcesAction(externalEvents.GetEvents(), "ExternalEventsImage", "");
+  gd::LinkEvent linkEvent;
+  linkEvent.SetTarget("External");
+  layout2.GetEvents().InsertEvent(linkEvent);
+
+  SECTION("Resources of each scene") {
+    auto scene1Resources =
+        gd::SceneResourcesFinder::FindSceneResources(project, layout1);
+    REQUIRE(scene1Resources == std::set<gd::String>({"GlobalImage",
+                                                     "Image1",
+                                                     "EventsImage1",
+                                                     "Music1"}));
+
+    auto scene2Resources =
+        gd::SceneResourcesFinder::FindSceneResources(project, layout2);
+    REQUIRE(scene2Resources == std::set<gd::String>({"GlobalImage",
+                                                     "Image2",
+                                                     "ExternalEventsImage"}));
+  }
+
+  SECTION("Resources of the project") {
+    REQUIRE(gd::SceneResourcesFinder::FindProjectResources(project) ==
+            std::set<gd::String>({"GlobalImage"}));
+  }
+
+  SECTION("Serialization") {
+    gd::SerializerElement element;
+    gd::SceneResourcesFinder::SerializeTo({"Image1", "Music1"}, element);
+    REQUIRE(gd::Serializer::ToJSON(element) ==
+            "[{\"name\":\"Image1\"},{\"name\":\"Music1\"}]");
+  }
+}
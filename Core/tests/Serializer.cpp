@@ -4,9 +4,11 @@
  * reserved. This project is released under the MIT License.
  */
 /**
- * @file Tests covering serialization to JSON.
+ * @file Tests covering serialization to JSON and to binary.
  */
 #include "GDCore/Serialization/Serializer.h"
+
+#include "BenchmarkTools.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
@@ -203,4 +205,141 @@ TEST_CASE("Serializer", "[common]") {
     gd::String json = Serializer::ToJSON(element);
     REQUIRE(json == "{\"hello\":\"world1\",\"ok\":true,\"hello2\":\"world2\"}");
   }
+
+  SECTION("Binary round trip") {
+    auto binaryRoundTripToJSON = [](const gd::String& json) {
+      return Serializer::ToJSON(
+          Serializer::FromBinary(Serializer::ToBinary(Serializer::FromJSON(json))));
+    };
+
+    gd::String json =
+        "{\"a\":true,\"b\":false,\"c\":\"hello\",\"d\":-42,\"e\":3.25,"
+        "\"f\":[1,{\"a\":\"world\"},[]],\"g\":{},"
+        "\"h\":\"Ελληνικά 中文\",\"i\":[{\"a\":1},{\"a\":2}]}";
+    REQUIRE(binaryRoundTripToJSON(json) == json);
+
+    // Types, arrays and attributes are kept.
+    SerializerElement element;
+    element.SetAttribute("attribute", 12);
+    element.AddChild("int").SetIntValue(-2147483647 - 1);
+    element.AddChild("double").SetDoubleValue(0.1);
+    element.AddChild("bool").SetBoolValue(true);
+    element.AddChild("string").SetStringValue(u8"Ελληνικά");
+    SerializerElement& array = element.AddChild("layers");
+    array.ConsiderAsArrayOf("layer");
+    array.AddChild("layer").SetAttribute("name", "Foreground");
+    array.AddChild("layer").SetAttribute("name", "Background");
+
+    SerializerElement result =
+        Serializer::FromBinary(Serializer::ToBinary(element));
+    REQUIRE(result.GetIntAttribute("attribute") == 12);
+    REQUIRE(result.GetChild("int").GetValue().IsInt());
+    REQUIRE(result.GetChild("int").GetIntValue() == -2147483647 - 1);
+    REQUIRE(result.GetChild("double").GetValue().IsDouble());
+    REQUIRE(result.GetChild("double").GetDoubleValue() == 0.1);
+    REQUIRE(result.GetChild("bool").GetBoolValue() == true);
+    REQUIRE(result.GetChild("string").GetStringValue() == u8"Ελληνικά");
+    REQUIRE(result.GetChild("layers").ConsideredAsArray());
+    REQUIRE(result.GetChild("layers").ConsideredAsArrayOf() == "layer");
+    REQUIRE(result.GetChild("layers").GetChildrenCount() == 2);
+    REQUIRE(result.GetChild("layers")
+                .GetChild("layer", 1)
+                .GetStringAttribute("name") == "Background");
+
+    // Names used more than once are only stored once.
+    std::string binary = Serializer::ToBinary(result);
+    REQUIRE(binary.find("Background") != std::string::npos);
+    REQUIRE(binary.find("\x05layer") == binary.rfind("\x05layer"));
+    REQUIRE(binary.find("\x04name") == binary.rfind("\x04name"));
+  }
+
+  SECTION("Invalid binary data") {
+    SerializerElement element = Serializer::FromJSON("{\"a\":[1,2,\"b\"]}");
+    std::string binary = Serializer::ToBinary(element);
+    REQUIRE(Serializer::ToJSON(Serializer::FromBinary(binary)) ==
+            "{\"a\":[1,2,\"b\"]}");
+
+    // Truncated data, wrong header or another version are not read.
+    for (std::size_t size = 0; size < binary.size(); ++size) {
+      REQUIRE(Serializer::FromBinary(binary.data(), size)
+                  .GetAllChildren()
+                  .empty());
+    }
+    std::string otherVersion = binary;
+    otherVersion[4] = 2;
+    REQUIRE(Serializer::FromBinary(otherVersion).GetAllChildren().empty());
+    REQUIRE(Serializer::FromBinary("{\"a\":1}").GetAllChildren().empty());
+
+    // Strings not valid in UTF8 are not read.
+    std::string invalidString =
+        Serializer::ToBinary(Serializer::FromJSON("{\"a\":\"hello\"}"));
+    invalidString[invalidString.find("hello")] = '\xff';
+    REQUIRE(Serializer::FromBinary(invalidString).GetAllChildren().empty());
+
+    // Too deeply nested elements are not read.
+    auto nestedElementBinary = [](std::size_t depth) {
+      SerializerElement root;
+      SerializerElement* element = &root;
+      for (std::size_t i = 0; i < depth; ++i)
+        element = &element->AddChild("child");
+      return Serializer::ToBinary(root);
+    };
+    REQUIRE(!Serializer::FromBinary(nestedElementBinary(1000))
+                 .GetAllChildren()
+                 .empty());
+    REQUIRE(Serializer::FromBinary(nestedElementBinary(2000))
+                .GetAllChildren()
+                .empty());
+  }
+
+  SECTION("Binary strings with NUL characters") {
+    gd::String str;
+    str.Raw().assign("a\0b", 3);
+    SerializerElement element;
+    element.AddChild("string").SetStringValue(str);
+
+    SerializerElement result =
+        Serializer::FromBinary(Serializer::ToBinary(element));
+    REQUIRE(result.GetChild("string").GetStringValue().Raw() ==
+            std::string("a\0b", 3));
+  }
+}
+
+TEST_CASE("Serializer - Benchmarks", "[common][.]") {
+  // A project-like element, with a lot of repeated names.
+  SerializerElement element;
+  SerializerElement& instances = element.AddChild("instances");
+  instances.ConsiderAsArrayOf("instance");
+  for (int i = 0; i < 5000; ++i) {
+    SerializerElement& instance = instances.AddChild("instance");
+    instance.SetAttribute("name", "Player" + gd::String::From(i % 10));
+    instance.SetAttribute("layer", "");
+    instance.SetAttribute("x", i * 1.5);
+    instance.SetAttribute("y", i * 2.5);
+    instance.SetAttribute("zOrder", i);
+    instance.SetAttribute("locked", false);
+  }
+
+  gd::String json = Serializer::ToJSON(element);
+  std::string binary = Serializer::ToBinary(element);
+  std::cout << "JSON size: " << json.Raw().size()
+            << " bytes, binary size: " << binary.size() << " bytes"
+            << std::endl;
+  REQUIRE(binary.size() < json.Raw().size());
+
+  DoBenchmark("Serialization to JSON", 10, [&]() {
+    REQUIRE(!Serializer::ToJSON(element).empty());
+  });
+  DoBenchmark("Serialization to binary", 10, [&]() {
+    REQUIRE(!Serializer::ToBinary(element).empty());
+  });
+  DoBenchmark("Unserialization from JSON", 10, [&]() {
+    REQUIRE(Serializer::FromJSON(json).GetChild("instances").GetChildrenCount() ==
+            5000);
+  });
+  DoBenchmark("Unserialization from binary", 10, [&]() {
+    REQUIRE(
+        Serializer::FromBinary(binary).GetChild("instances").GetChildrenCount() ==
+        5000);
+  });
 }
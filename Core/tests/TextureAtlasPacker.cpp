@@ -0,0 +1,243 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
+
+#include <map>
+#include <set>
+
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/Effect.h"
+#include "GDCore/Project/EffectsContainer.h"
+#include "GDCore/Project/Layer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/LoadingScreen.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief A file system knowing the size of some images, and recording the
+ * atlases written.
+ */
+class ImagesFileSystem : public gd::AbstractFileSystem {
+ public:
+  struct Atlas {
+    unsigned int width;
+    unsigned int height;
+    std::vector<ImagePlacement> images;
+  };
+
+  virtual void MkDir(const gd::String& path) { directories[path] = true; };
+  virtual bool DirExists(const gd::String& path) {
+    return directories.find(path) != directories.end();
+  };
+  virtual bool FileExists(const gd::String& path) { return true; };
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    return file.substr(file.rfind("/") + 1);
+  };
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    return file.substr(0, file.rfind("/"));
+  };
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    return false;
+  };
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    return false;
+  }
+  virtual bool ClearDir(const gd::String& directory) { return true; }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    return false;
+  }
+  virtual gd::String ReadFile(const gd::String& file) { return ""; }
+  virtual gd::String GetTempDir() { return "/tmp"; }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return std::vector<gd::String>();
+  }
+  virtual bool GetImageSize(const gd::String& file,
+                            unsigned int& width,
+                            unsigned int& height) {
+    if (imagesSizes.find(file) == imagesSizes.end()) return false;
+    width = imagesSizes[file].first;
+    height = imagesSizes[file].second;
+    return true;
+  }
+  virtual bool WriteAtlasImage(const gd::String& file,
+                               unsigned int width,
+                               unsigned int height,
+                               const std::vector<ImagePlacement>& images) {
+    atlases[file].width = width;
+    atlases[file].height = height;
+    atlases[file].images = images;
+    return true;
+  }
+  virtual bool RemoveFile(const gd::String& file) {
+    removedFiles.insert(file);
+    return true;
+  }
+
+  std::map<gd::String, bool> directories;
+  std::map<gd::String, std::pair<unsigned int, unsigned int>> imagesSizes;
+  std::map<gd::String, Atlas> atlases;
+  std::set<gd::String> removedFiles;
+};
+
+void AddSpriteObject(gd::ObjectsContainer& objects,
+                     const gd::String& name,
+                     const std::vector<gd::String>& images) {
+  gd::SpriteObject object(name);
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  for (auto& image : images) {
+    gd::Sprite sprite;
+    sprite.SetImageName(image);
+    animation.GetDirection(0).AddSprite(sprite);
+  }
+  object.AddAnimation(animation);
+  objects.InsertObject(object, objects.GetObjectsCount());
+}
+}  // namespace
+
+TEST_CASE("TextureAtlasPacker", "[common][resources]") {
+  ImagesFileSystem fs;
+  gd::Project project;
+  gd::ResourcesManager& resources = project.GetResourcesManager();
+  auto addImage = [&](const gd::String& name,
+                      unsigned int width,
+                      unsigned int height) {
+    resources.AddResource(name, name + ".png", "image");
+    fs.imagesSizes["/export/" + name + ".png"] = std::make_pair(width, height);
+  };
+
+  addImage("Player1", 64, 64);
+  addImage("Player2", 64, 64);
+  addImage("Enemy", 32, 48);
+  addImage("Coin", 16, 16);
+  addImage("Background", 1024, 768);  // Too big to be packed.
+  addImage("LoadingScreen", 32, 32);  // Used by the loading screen.
+  addImage("Blurry", 32, 32);         // Not smoothed: packed in another page.
+  dynamic_cast<gd::ImageResource&>(resources.GetResource("Blurry"))
+      .SetSmooth(false);
+
+  AddSpriteObject(project, "Coin", {"Coin"});
+  gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+  AddSpriteObject(layout, "Player", {"Player1", "Player2", "Player1"});
+  AddSpriteObject(layout, "Enemy", {"Enemy", "Blurry"});
+  AddSpriteObject(layout, "Background", {"Background"});
+  AddSpriteObject(layout, "Logo", {"LoadingScreen"});
+  project.GetLoadingScreen().SetBackgroundImageResourceName("LoadingScreen");
+
+  SECTION("Images used only by sprites are packed") {
+    gd::TextureAtlasPacker packer(fs);
+    packer.PackImages(project, resources, "/export");
+
+    REQUIRE(packer.GetPages().size() == 1);
+    const auto& page = packer.GetPages()[0];
+    REQUIRE(page.imageName == "atlas0");
+    REQUIRE(page.regions.size() == 4);
+
+    // Highest images are placed first, on the same shelf.
+    REQUIRE(page.regions[0].imageName == "Player1");
+    REQUIRE(page.regions[0].x == 0);
+    REQUIRE(page.regions[1].imageName == "Player2");
+    REQUIRE(page.regions[1].x == 66);
+    REQUIRE(page.regions[2].imageName == "Enemy");
+    REQUIRE(page.regions[2].x == 132);
+    REQUIRE(page.regions[3].imageName == "Coin");
+    REQUIRE(page.regions[3].x == 166);
+    REQUIRE(page.width == 182);
+    REQUIRE(page.height == 64);
+
+    REQUIRE(fs.atlases.size() == 1);
+    REQUIRE(fs.atlases["/export/atlases/atlas0.png"].width == 182);
+    REQUIRE(fs.atlases["/export/atlases/atlas0.png"].images.size() == 4);
+    REQUIRE(fs.atlases["/export/atlases/atlas0.png"].images[2].file ==
+            "/export/Enemy.png");
+
+    // Packed images are replaced by the page.
+    REQUIRE(resources.HasResource("atlas0"));
+    REQUIRE(resources.GetResource("atlas0").GetFile() == "atlases/atlas0.png");
+    REQUIRE(!resources.HasResource("Player1"));
+    REQUIRE(!resources.HasResource("Coin"));
+    REQUIRE(resources.HasResource("Background"));
+    REQUIRE(resources.HasResource("LoadingScreen"));
+    REQUIRE(resources.HasResource("Blurry"));  // Alone in its page.
+
+    gd::SerializerElement element;
+    packer.SerializeTo(element);
+    REQUIRE(gd::Serializer::ToJSON(element).find(
+                "{\"height\":64,\"image\":\"atlas0\",\"width\":182") !=
+            gd::String::npos);
+  }
+
+  SECTION("Files of the packed images are removed, unless still used") {
+    resources.AddResource("CoinIcon", "Coin.png", "image");
+
+    gd::TextureAtlasPacker packer(fs);
+    packer.PackImages(project, resources, "/export");
+
+    REQUIRE(packer.GetPages()[0].regions.size() == 4);
+    REQUIRE(fs.removedFiles.size() == 3);
+    REQUIRE(fs.removedFiles.count("/export/Player1.png") == 1);
+    REQUIRE(fs.removedFiles.count("/export/Player2.png") == 1);
+    REQUIRE(fs.removedFiles.count("/export/Enemy.png") == 1);
+  }
+
+  SECTION("Images used by effects are not packed") {
+    gd::Effect& effect = layout.GetLayer("").GetEffects().InsertNewEffect(
+        "ColorMap", 0);
+    effect.SetEffectType("Effects::ColorMap");
+    effect.SetStringParameter("colorMapTexture", "Coin");
+
+    gd::TextureAtlasPacker packer(fs);
+    packer.PackImages(project, resources, "/export");
+
+    REQUIRE(packer.GetPages().size() == 1);
+    REQUIRE(packer.GetPages()[0].regions.size() == 3);
+    REQUIRE(resources.HasResource("Coin"));
+  }
+
+  SECTION("Pages are filled shelf by shelf") {
+    gd::TextureAtlasPacker packer(fs);
+    packer.SetMaxPageSize(128).SetPadding(0);
+    packer.PackImages(project, resources, "/export");
+
+    REQUIRE(packer.GetPages().size() == 1);
+    const auto& page = packer.GetPages()[0];
+    REQUIRE(page.regions[1].imageName == "Player2");
+    REQUIRE(page.regions[1].x == 64);
+    REQUIRE(page.regions[2].imageName == "Enemy");
+    REQUIRE(page.regions[2].x == 0);
+    REQUIRE(page.regions[2].y == 64);
+    REQUIRE(page.regions[3].x == 32);
+    REQUIRE(page.regions[3].y == 64);
+    REQUIRE(page.width == 128);
+    REQUIRE(page.height == 112);
+  }
+
+  SECTION("Nothing is packed if images can't be read") {
+    fs.imagesSizes.clear();
+    gd::TextureAtlasPacker packer(fs);
+    packer.PackImages(project, resources, "/export");
+
+    REQUIRE(packer.GetPages().empty());
+    REQUIRE(fs.atlases.empty());
+    REQUIRE(resources.HasResource("Player1"));
+  }
+}
@@ -0,0 +1,99 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Utf8Scanner.h"
+
+#include <string>
+#include <vector>
+
+#include "GDCore/String.h"
+#include "GDCore/Utf8/utf8.h"
+#include "catch.hpp"
+
+namespace {
+std::size_t CountCodePointsWithIterator(const std::string &str) {
+  return ::utf8::unchecked::distance(str.begin(), str.end());
+}
+
+std::vector<std::string> GetTestedStrings() {
+  // Strings long enough to be scanned by blocks, with multi-bytes characters
+  // at various positions (including across blocks).
+  std::vector<std::string> strings = {
+      "",
+      "a",
+      u8"é",
+      "Hello world",
+      u8"UTF8 a été testé !",
+      std::string(100, 'a'),
+      u8"日本語のテキスト、日本語のテキスト、日本語のテキスト",
+      u8"😀😁😂🤣😃😄😅😆😉😊😋😎😍😘🥰😗😙😚☺️🙂🤗🤩🤔",
+  };
+  for (std::size_t i = 0; i < 40; ++i) {
+    strings.push_back(std::string(i, 'a') + u8"€" + std::string(40, 'b') +
+                      u8"ß😀");
+  }
+
+  return strings;
+}
+}  // namespace
+
+TEST_CASE("Utf8Scanner", "[common][utf8]") {
+  SECTION("CountCodePoints") {
+    for (const std::string &str : GetTestedStrings()) {
+      REQUIRE(gd::Utf8Scanner::CountCodePoints(str.data(), str.size()) ==
+              CountCodePointsWithIterator(str));
+    }
+  }
+
+  SECTION("IsAscii") {
+    REQUIRE(gd::Utf8Scanner::IsAscii("", 0));
+    std::string asciiStr(100, 'a');
+    REQUIRE(gd::Utf8Scanner::IsAscii(asciiStr.data(), asciiStr.size()));
+    for (std::size_t i = 0; i < asciiStr.size(); ++i) {
+      std::string str = asciiStr;
+      str[i] = '\x80';
+      REQUIRE(!gd::Utf8Scanner::IsAscii(str.data(), str.size()));
+    }
+  }
+
+  SECTION("IsValid") {
+    for (const std::string &str : GetTestedStrings()) {
+      REQUIRE(gd::Utf8Scanner::IsValid(str.data(), str.size()));
+    }
+
+    for (std::size_t i = 0; i < 40; ++i) {
+      // Truncated, overlong and lonely continuation characters.
+      std::string prefix(i, 'a');
+      std::string suffix(40, 'b');
+      for (const std::string &invalidSequence :
+           std::vector<std::string>{"\xE2\x82", "\xC0\xAF", "\x80", "\xFF"}) {
+        std::string str = prefix + invalidSequence + suffix;
+        REQUIRE(!gd::Utf8Scanner::IsValid(str.data(), str.size()));
+      }
+      std::string truncatedStr = prefix + "\xF0\x9F\x98";
+      REQUIRE(!gd::Utf8Scanner::IsValid(truncatedStr.data(),
+                                        truncatedStr.size()));
+    }
+  }
+
+  SECTION("GetByteOffset and GetCodePointIndex") {
+    for (const std::string &str : GetTestedStrings()) {
+      std::size_t index = 0;
+      for (auto it = str.begin(); it != str.end();
+           ::utf8::unchecked::next(it), ++index) {
+        std::size_t byteOffset = it - str.begin();
+        REQUIRE(gd::Utf8Scanner::GetByteOffset(str.data(), str.size(), index) ==
+                byteOffset);
+        REQUIRE(gd::Utf8Scanner::GetCodePointIndex(str.data(), byteOffset) ==
+                index);
+      }
+
+      REQUIRE(gd::Utf8Scanner::GetByteOffset(str.data(), str.size(), index) ==
+              str.size());
+      REQUIRE(gd::Utf8Scanner::GetByteOffset(
+                  str.data(), str.size(), index + 1) == gd::String::npos);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <string>
+
+#include "BenchmarkTools.h"
+#include "GDCore/String.h"
+#include "GDCore/Tools/Utf8Scanner.h"
+#include "GDCore/Utf8/utf8.h"
+#include "catch.hpp"
+
+TEST_CASE("Utf8Scanner - Benchmarks", "[common][utf8][.]") {
+  // A long text, mostly made of ASCII characters (like events and
+  // expressions), and one with only multi-bytes characters.
+  std::string latinText;
+  std::string japaneseText;
+  for (std::size_t i = 0; i < 20000; ++i) {
+    latinText += u8"MySpriteObject.X() + Variable(été) ";
+    japaneseText += u8"日本語のテキスト";
+  }
+
+  auto benchmarkText = [&](const gd::String &textName,
+                           const std::string &text) {
+    std::size_t expectedCount =
+        ::utf8::unchecked::distance(text.begin(), text.end());
+
+    DoBenchmark("Count code points by decoding them (" + textName + ")",
+                10,
+                [&]() {
+                  REQUIRE(::utf8::unchecked::distance(
+                              text.begin(), text.end()) == expectedCount);
+                });
+    DoBenchmark("Count code points with Utf8Scanner (" + textName + ")",
+                10,
+                [&]() {
+                  REQUIRE(gd::Utf8Scanner::CountCodePoints(
+                              text.data(), text.size()) == expectedCount);
+                });
+
+    DoBenchmark("Validate by decoding (" + textName + ")", 10, [&]() {
+      REQUIRE(::utf8::is_valid(text.begin(), text.end()));
+    });
+    DoBenchmark("Validate with Utf8Scanner (" + textName + ")", 10, [&]() {
+      REQUIRE(gd::Utf8Scanner::IsValid(text.data(), text.size()));
+    });
+
+    std::size_t middleIndex = expectedCount / 2;
+    auto middleIt = text.begin();
+    ::utf8::unchecked::advance(middleIt, middleIndex);
+    std::size_t middleByteOffset = middleIt - text.begin();
+    DoBenchmark("Find the middle byte offset by decoding (" + textName + ")",
+                10,
+                [&]() {
+                  auto it = text.begin();
+                  ::utf8::unchecked::advance(it, middleIndex);
+                  REQUIRE(std::size_t(it - text.begin()) == middleByteOffset);
+                });
+    DoBenchmark(
+        "Find the middle byte offset with Utf8Scanner (" + textName + ")",
+        10,
+        [&]() {
+          REQUIRE(gd::Utf8Scanner::GetByteOffset(
+                      text.data(), text.size(), middleIndex) ==
+                  middleByteOffset);
+        });
+
+    gd::String str = gd::String::FromUTF8(text);
+    DoBenchmark("gd::String::substr (" + textName + ")", 10, [&]() {
+      REQUIRE(str.substr(middleIndex, 10).size() == 10);
+    });
+  };
+
+  SECTION("Latin text") { benchmarkText("latin text", latinText); }
+  SECTION("Japanese text") { benchmarkText("japanese text", japaneseText); }
+}
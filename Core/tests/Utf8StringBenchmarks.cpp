@@ -0,0 +1,49 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkTools.h"
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("Utf8 String - Benchmarks", "[common][utf8][.]") {
+  // Expressions are mostly ASCII, but can contain texts in other languages.
+  gd::String asciiStr;
+  gd::String latinStr;
+  for (std::size_t i = 0; i < 200; ++i) {
+    asciiStr += "MySpriteObject.X() + Variable(MyVariable) ";
+    latinStr += u8"MySpriteObject.X() + Variable(MyVariable) été ";
+  }
+
+  auto benchmarkString = [&](const gd::String &stringName,
+                             const gd::String &str) {
+    DoBenchmark("Call size() (" + stringName + ")", 10, [&]() {
+      std::size_t totalSize = 0;
+      for (std::size_t i = 0; i < 1000; ++i) totalSize += str.size();
+      REQUIRE(totalSize == str.size() * 1000);
+    });
+
+    DoBenchmark("Read all the characters with operator[] (" + stringName + ")",
+                10,
+                [&]() {
+                  std::size_t spacesCount = 0;
+                  for (std::size_t i = 0; i < str.size(); ++i)
+                    if (str[i] == U' ') spacesCount++;
+                  REQUIRE(spacesCount > 0);
+                });
+
+    DoBenchmark("Find all the variables (" + stringName + ")", 10, [&]() {
+      std::size_t variablesCount = 0;
+      std::size_t pos = str.find("Variable(");
+      while (pos != gd::String::npos) {
+        if (str.substr(pos + 9, 10) == "MyVariable") variablesCount++;
+        pos = str.find("Variable(", pos + 1);
+      }
+      REQUIRE(variablesCount == 200);
+    });
+  };
+
+  SECTION("ASCII string") { benchmarkString("ASCII string", asciiStr); }
+  SECTION("Latin string") { benchmarkString("latin string", latinStr); }
+}
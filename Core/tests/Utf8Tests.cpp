@@ -325,4 +325,73 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     REQUIRE(gd::String("-/=aß=/-").LeftTrim("-/") == "=aß=/-");
     REQUIRE(gd::String("-/=aß=/-").RightTrim("-/") == "-/=aß=");
   }
+
+  SECTION("length and ASCII status kept after modifications") {
+    gd::String str = u8"This is a sentence";
+    REQUIRE(str.IsAscii());
+    REQUIRE(str.size() == 18);
+    REQUIRE(str[8] == U'a');
+
+    str += u8" écrite";
+    REQUIRE(!str.IsAscii());
+    REQUIRE(str.size() == 25);
+    REQUIRE(str[19] == U'é');
+
+    str.erase(18);
+    REQUIRE(str.IsAscii());
+    REQUIRE(str.size() == 18);
+
+    str.push_back(U'€');
+    REQUIRE(str.size() == 19);
+    str.pop_back();
+    REQUIRE(str.size() == 18);
+    REQUIRE(str.IsAscii());
+
+    str.insert(0, u8"ß");
+    REQUIRE(str.size() == 19);
+    REQUIRE(str.find(u8"sentence") == 11);
+    str.replace(0, 1, "");
+    REQUIRE(str.find(u8"sentence") == 10);
+    REQUIRE(str.IsAscii());
+
+    str.Raw() += u8"…";
+    REQUIRE(str.size() == 19);
+    REQUIRE(!str.IsAscii());
+
+    gd::String substr = str.substr(0, 4);
+    REQUIRE(substr == "This");
+    REQUIRE(substr.IsAscii());
+    REQUIRE(str.substr(15).size() == 4);
+
+    gd::String copiedStr = str;
+    REQUIRE(copiedStr.size() == 19);
+    gd::String movedStr = std::move(copiedStr);
+    REQUIRE(movedStr.size() == 19);
+    REQUIRE(copiedStr.size() == 0);
+    copiedStr = movedStr;
+    REQUIRE(copiedStr.size() == 19);
+    movedStr = std::move(substr);
+    REQUIRE(movedStr.size() == 4);
+    REQUIRE(substr.empty());
+
+    str.clear();
+    REQUIRE(str.size() == 0);
+    REQUIRE(str.IsAscii());
+  }
+
+  SECTION("strings with invalid UTF8 bytes are not ASCII") {
+    // A lone 0xE9 (é in Latin-1) is counted as one character, so the string
+    // has as many characters as bytes.
+    gd::String str = "Caf\xE9 ok";
+    REQUIRE(str.size() == 7);
+    REQUIRE(!str.IsAscii());
+
+    gd::String asciiStr = "Cafe";
+    REQUIRE(asciiStr.IsAscii());
+    asciiStr += str;
+    REQUIRE(asciiStr.size() == 11);
+    REQUIRE(!asciiStr.IsAscii());
+    REQUIRE(!asciiStr.substr(0, 9).IsAscii());
+    REQUIRE(asciiStr.substr(0, 4).IsAscii());
+  }
 }
@@ -10,8 +10,11 @@
 #include <initializer_list>
 #include <map>
 
+#include "BenchmarkTools.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "catch.hpp"
 
 TEST_CASE("Variable", "[common][variables]") {
@@ -91,4 +94,82 @@ TEST_CASE("Variable", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(variable3.GetChild("Child2").GetValue() == 44);
   }
+  SECTION("Structure children are sorted by name") {
+    gd::Variable variable;
+    variable.GetChild("c").SetValue(3);
+    variable.GetChild("a").SetValue(1);
+    variable.GetChild("b").SetValue(2);
+    REQUIRE(variable.GetAllChildrenNames() ==
+            std::vector<gd::String>({"a", "b", "c"}));
+
+    REQUIRE(variable.RenameChild("a", "d"));
+    REQUIRE_FALSE(variable.RenameChild("b", "c"));
+    REQUIRE(variable.GetAllChildrenNames() ==
+            std::vector<gd::String>({"b", "c", "d"}));
+    REQUIRE(variable.GetChild("d").GetValue() == 1);
+
+    variable.RemoveChild("c");
+    REQUIRE(!variable.HasChild("c"));
+    REQUIRE(variable.GetChildrenCount() == 2);
+  }
+  SECTION("Conversions between structures and arrays") {
+    gd::Variable variable;
+    for (std::size_t i = 0; i < 12; ++i) variable.PushNew().SetValue(i);
+
+    variable.CastTo(gd::Variable::Type::Structure);
+    REQUIRE(variable.GetChildrenCount() == 12);
+    REQUIRE(variable.GetChild("10").GetValue() == 10);
+    REQUIRE(variable.GetAllChildrenNames()[2] == "10");
+
+    variable.CastTo(gd::Variable::Type::Array);
+    REQUIRE(variable.GetChildrenCount() == 12);
+    REQUIRE(variable.GetAtIndex(2).GetValue() == 10);
+    REQUIRE(!variable.HasChild("10"));
+  }
+  SECTION("Serialization") {
+    gd::Variable variable;
+    variable.GetChild("b").SetBool(true);
+    variable.GetChild("a").GetAtIndex(1).SetString("Hello");
+
+    gd::SerializerElement element;
+    variable.SerializeTo(element);
+    gd::Variable unserializedVariable;
+    unserializedVariable.UnserializeFrom(element);
+
+    gd::SerializerElement unserializedElement;
+    unserializedVariable.SerializeTo(unserializedElement);
+    REQUIRE(gd::Serializer::ToJSON(unserializedElement) ==
+            gd::Serializer::ToJSON(element));
+    REQUIRE(unserializedVariable.GetChild("b").GetBool() == true);
+    REQUIRE(unserializedVariable.GetChild("a").GetAtIndex(1).GetString() ==
+            "Hello");
+  }
+}
+
+TEST_CASE("Variable - Benchmarks", "[common][variables][.]") {
+  // A structure like the ones used for dialogue trees or level data.
+  gd::Variable variable;
+  for (std::size_t i = 0; i < 200; ++i) {
+    gd::Variable& level = variable.GetChild("Level" + gd::String::From(i));
+    level.GetChild("Name").SetString("Level " + gd::String::From(i));
+    level.GetChild("Unlocked").SetBool(i % 2 == 0);
+    for (std::size_t j = 0; j < 50; ++j) {
+      gd::Variable& tile = level.GetChild("Tiles").PushNew();
+      tile.GetChild("X").SetValue(j);
+      tile.GetChild("Y").SetValue(i);
+    }
+  }
+
+  DoBenchmark("Variable copy", 10, [&]() {
+    gd::Variable copy(variable);
+    REQUIRE(copy.GetChildrenCount() == 200);
+  });
+
+  gd::SerializerElement element;
+  variable.SerializeTo(element);
+  DoBenchmark("Variable unserialization", 10, [&]() {
+    gd::Variable unserializedVariable;
+    unserializedVariable.UnserializeFrom(element);
+    REQUIRE(unserializedVariable.GetChildrenCount() == 200);
+  });
 }
@@ -84,10 +84,15 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
     const gd::Layout& scene,
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    gd::EventsCodeReport* codeReport,
+    const gd::DeadEventsProjectFacts* deadEventsProjectFacts) {
   EventsCodeGenerator codeGenerator(project, scene);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetCodeReport(codeReport);
+  codeGenerator.SetDeadEventsProjectFacts(deadEventsProjectFacts);
+  codeGenerator.SetProjectForEventsFunctionsInlining(project);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       project,
@@ -103,12 +108,43 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
   return output;
 }
 
+gd::String EventsCodeGenerator::GenerateExternalEventsCode(
+    gd::Project& project,
+    const gd::ExternalEvents& externalEvents,
+    const gd::Layout& scene,
+    const gd::String& codeNamespace,
+    std::set<gd::String>& includeFiles,
+    bool compilationForRuntime,
+    gd::EventsCodeReport* codeReport,
+    const gd::DeadEventsProjectFacts* deadEventsProjectFacts) {
+  EventsCodeGenerator codeGenerator(project, scene);
+  codeGenerator.SetCodeNamespace(codeNamespace);
+  codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetCodeReport(codeReport);
+  codeGenerator.SetDeadEventsProjectFacts(deadEventsProjectFacts);
+  codeGenerator.SetProjectForEventsFunctionsInlining(project);
+
+  gd::String output = GenerateEventsListCompleteFunctionCode(
+      project,
+      codeGenerator,
+      codeGenerator.GetCodeNamespaceAccessor() + "func",
+      "runtimeScene",
+      "",
+      externalEvents.GetEvents(),
+      "return;\n");
+
+  includeFiles.insert(codeGenerator.GetIncludeFiles().begin(),
+                      codeGenerator.GetIncludeFiles().end());
+  return output;
+}
+
 gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
     gd::Project& project,
     const gd::EventsFunction& eventsFunction,
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    gd::EventsCodeReport* codeReport) {
   gd::ObjectsContainer globalObjectsAndGroups;
   gd::ObjectsContainer objectsAndGroups;
   gd::EventsFunctionTools::FreeEventsFunctionToObjectsContainer(
@@ -117,6 +153,8 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetCodeReport(codeReport);
+  codeGenerator.SetProjectForEventsFunctionsInlining(project);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       project,
@@ -143,7 +181,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
     const gd::String& onceTriggersVariable,
     const gd::String& preludeCode,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    gd::EventsCodeReport* codeReport) {
   gd::ObjectsContainer globalObjectsAndGroups;
   gd::ObjectsContainer objectsAndGroups;
   gd::EventsFunctionTools::BehaviorEventsFunctionToObjectsContainer(
@@ -156,6 +195,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetCodeReport(codeReport);
+  codeGenerator.SetProjectForEventsFunctionsInlining(project);
 
   // Generate the code setting up the context of the function.
   gd::String fullPreludeCode =
@@ -163,12 +204,6 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
       // runtimeScene is supposed to be always accessible, read
       // it from the behavior
       "var runtimeScene = this._runtimeScene;\n" +
-      // By convention of Behavior Events Function, the object is accessible
-      // as a parameter called "Object", and thisObjectList is an array
-      // containing it (for faster access, without having to go through the
-      // hashmap).
-      "var thisObjectList = [this.owner];\n" +
-      "var Object = Hashtable.newFrom({Object: thisObjectList});\n" +
       // By convention of Behavior Events Function, the behavior is accessible
       // as a parameter called "Behavior".
       "var Behavior = this.name;\n" +
@@ -177,7 +212,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
           eventsFunction.GetParameters(),
           onceTriggersVariable,
           // Pass the names of the parameters considered as the current
-          // object and behavior parameters:
+          // object (accessible as a parameter called "Object", by convention
+          // of Behavior Events Function) and behavior parameters:
           "Object",
           "Behavior");
 
@@ -221,10 +257,7 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionParameterDeclarationsList(
 gd::String EventsCodeGenerator::GenerateFreeEventsFunctionContext(
     const vector<gd::ParameterMetadata>& parameters,
     const gd::String& onceTriggersVariable) {
-  gd::String objectsGettersMap;
-  gd::String objectArraysMap;
-  gd::String behaviorNamesMap;
-  return GenerateEventsFunctionContext(parameters, onceTriggersVariable, objectsGettersMap, objectArraysMap, behaviorNamesMap);
+  return GenerateEventsFunctionContext(parameters, onceTriggersVariable, {});
 }
 
 gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionContext(
@@ -235,60 +268,45 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionContext(
     const gd::String& thisBehaviorName) {
   // See the comment at the start of the GenerateEventsFunctionContext function
 
-  gd::String objectsGettersMap;
-  gd::String objectArraysMap;
-  gd::String behaviorNamesMap;
-
-  // If we have an object considered as the current object ("this") (usually
-  // called Object in behavior events function), generate a slightly more
-  // optimized getter for it (bypassing "Object" hashmap, and directly return
-  // the array containing it).
-  if (!thisObjectName.empty()) {
-    objectsGettersMap +=
-        ConvertToStringExplicit(thisObjectName) + ": " + thisObjectName + "\n";
-    objectArraysMap +=
-        ConvertToStringExplicit(thisObjectName) + ": thisObjectList\n";
-  }
-
+  std::vector<std::pair<gd::String, gd::String>> behaviorNames;
   if (!thisBehaviorName.empty()) {
     // If we have a behavior considered as the current behavior ("this") (usually
     // called Behavior in behavior events function), generate a slightly more
     // optimized getter for it.
-    behaviorNamesMap += ConvertToStringExplicit(thisBehaviorName) + ": " +
-                        thisBehaviorName + "\n";
-    
+    behaviorNames.push_back(std::make_pair(thisBehaviorName, thisBehaviorName));
+
     // Add required behaviors from properties
     for (size_t i = 0; i < eventsBasedBehavior.GetPropertyDescriptors().GetCount(); i++)
     {
       const gd::NamedPropertyDescriptor& propertyDescriptor = eventsBasedBehavior.GetPropertyDescriptors().Get(i);
-      const std::vector<gd::String>& extraInfo = propertyDescriptor.GetExtraInfo();
       if (propertyDescriptor.GetType() == "Behavior") {
-        // Generate map that will be used to transform from behavior name used in
-        // function to the "real" behavior name from the caller.
-        gd::String comma = behaviorNamesMap.empty() ? "" : ", ";
-        behaviorNamesMap += comma + ConvertToStringExplicit(propertyDescriptor.GetName()) +
-                            ": this._get" + propertyDescriptor.GetName() + "()\n";
+        // The behavior name used in the function is transformed to the "real"
+        // behavior name given by the property.
+        behaviorNames.push_back(std::make_pair(
+            propertyDescriptor.GetName(),
+            "this._get" + propertyDescriptor.GetName() + "()"));
       }
     }
   }
-  
-  return GenerateEventsFunctionContext(
-      parameters,
-      onceTriggersVariable,
-      objectsGettersMap,
-      objectArraysMap,
-      behaviorNamesMap,
-      thisObjectName,
-      thisBehaviorName);
+
+  // If we have an object considered as the current object ("this") (usually
+  // called Object in behavior events function), it's the owner of the
+  // behavior, directly put in a list stored by the context (bypassing the
+  // lists that would otherwise be passed as parameter).
+  return GenerateEventsFunctionContext(parameters,
+                                       onceTriggersVariable,
+                                       behaviorNames,
+                                       thisObjectName,
+                                       "this.owner",
+                                       thisBehaviorName);
 }
 
 gd::String EventsCodeGenerator::GenerateEventsFunctionContext(
     const vector<gd::ParameterMetadata>& parameters,
     const gd::String& onceTriggersVariable,
-    gd::String& objectsGettersMap,
-    gd::String& objectArraysMap,
-    gd::String& behaviorNamesMap,
+    const std::vector<std::pair<gd::String, gd::String>>& behaviorNames,
     const gd::String& thisObjectName,
+    const gd::String& thisObjectCode,
     const gd::String& thisBehaviorName) {
   // When running in the context of a function generated from events, we
   // need some indirection to deal with objects, behaviors and parameters in
@@ -302,126 +320,263 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionContext(
   // the parameter name).
   // * For other parameters, allow to access to them without transformation.
   // Conditions/expressions are available to deal with them in events.
-
+  //
+  // *Optimization*: functions can be called for each instance, each frame, so
+  // the context must not be allocated at each call. A class is generated for
+  // the context of each function, with all the names known in advance, and
+  // its instances are pooled: one is taken from the pool when the function is
+  // called and given back when it returns (a function calling itself just
+  // takes another one).
+
+  gd::String contextClassName = GetCodeNamespaceAccessor() + "EventsFunctionContext";
+  gd::String contextsPoolName = GetCodeNamespaceAccessor() + "eventsFunctionContextsPool";
+
+  gd::String objectsMapDeclaration;
+  gd::String objectArraysMapDeclaration;
+  gd::String objectArraysMaterializedDeclaration;
+  gd::String behaviorNamesMapDeclaration;
+  gd::String argumentsDeclaration;
   gd::String argumentsGetters;
+  gd::String materializeObjectArraysCode;
+  gd::String releaseCode;
+  gd::String setupCode;
+
+  auto declareObject = [&](const gd::String& objectName,
+                           const gd::String& objectsLists) {
+    gd::String name = ConvertToStringExplicit(objectName);
+    gd::String comma = objectsMapDeclaration.empty() ? "" : ", ";
+    objectsMapDeclaration += comma + name + ": " + objectsLists + "\n";
+    objectArraysMapDeclaration += comma + name + ": []\n";
+    objectArraysMaterializedDeclaration += comma + name + ": false\n";
+    materializeObjectArraysCode += "  if (!this._objectArraysMaterialized[" +
+                                   name + "]) this._materializeObjectArray(" +
+                                   name + ");\n";
+    releaseCode += "  this._objectArraysMap[" + name +
+                   "].length = 0;\n"
+                   "  this._objectArraysMaterialized[" +
+                   name + "] = false;\n";
+  };
+  auto declareBehaviorName = [&](const gd::String& behaviorName,
+                                 const gd::String& behaviorNameCode) {
+    gd::String name = ConvertToStringExplicit(behaviorName);
+    gd::String comma = behaviorNamesMapDeclaration.empty() ? "" : ", ";
+    behaviorNamesMapDeclaration += comma + name + ": \"\"\n";
+    setupCode += "eventsFunctionContext._behaviorNamesMap[" + name +
+                 "] = " + behaviorNameCode + ";\n";
+  };
+
+  if (!thisObjectName.empty()) {
+    // The list containing the current object is owned by the context.
+    gd::String name = ConvertToStringExplicit(thisObjectName);
+    declareObject(thisObjectName, "Hashtable.newFrom({" + name + ": []})");
+    setupCode += "var thisObjectList = eventsFunctionContext._objectsMap[" +
+                 name + "].get(" + name +
+                 ");\n"
+                 "thisObjectList.length = 0;\n"
+                 "thisObjectList.push(" +
+                 thisObjectCode + ");\n";
+    releaseCode += "  this._objectsMap[" + name + "].get(" + name +
+                   ").length = 0;\n";
+  }
+  for (const auto& behaviorName : behaviorNames)
+    declareBehaviorName(behaviorName.first, behaviorName.second);
 
   for (const auto& parameter : parameters) {
     if (parameter.GetName().empty()) continue;
 
+    gd::String name = ConvertToStringExplicit(parameter.GetName());
     if (gd::ParameterMetadata::IsObject(parameter.GetType())) {
       if (parameter.GetName() == thisObjectName) {
         continue;
       }
 
-      // Generate map that will be used to get the lists of objects passed
-      // as parameters (either as objects lists or array).
-      gd::String comma = objectsGettersMap.empty() ? "" : ", ";
-      objectsGettersMap += comma +
-                           ConvertToStringExplicit(parameter.GetName()) + ": " +
-                           parameter.GetName() + "\n";
-      objectArraysMap += comma + ConvertToStringExplicit(parameter.GetName()) +
-                         ": gdjs.objectsListsToArray(" + parameter.GetName() +
-                         ")\n";
+      // The lists of objects passed as parameters are stored by the context,
+      // and only converted to an array when needed.
+      declareObject(parameter.GetName(), "null");
+      setupCode += "eventsFunctionContext._objectsMap[" + name +
+                   "] = " + parameter.GetName() + ";\n";
+      releaseCode += "  this._objectsMap[" + name + "] = null;\n";
     } else if (gd::ParameterMetadata::IsBehavior(parameter.GetType())) {
       if (parameter.GetName() == thisBehaviorName) {
         continue;
       }
 
-      // Generate map that will be used to transform from behavior name used in
-      // function to the "real" behavior name from the caller.
-      gd::String comma = behaviorNamesMap.empty() ? "" : ", ";
-      behaviorNamesMap += comma + ConvertToStringExplicit(parameter.GetName()) +
-                          ": " + parameter.GetName() + "\n";
+      declareBehaviorName(parameter.GetName(), parameter.GetName());
     } else {
-      argumentsGetters +=
-          "if (argName === " + ConvertToStringExplicit(parameter.GetName()) +
-          ") return " + parameter.GetName() + ";\n";
+      gd::String comma = argumentsDeclaration.empty() ? "" : ", ";
+      argumentsDeclaration += comma + name + ": undefined\n";
+      argumentsGetters += "  if (argName === " + name +
+                          ") return this._arguments[" + name + "];\n";
+      setupCode += "eventsFunctionContext._arguments[" + name +
+                   "] = " + parameter.GetName() + ";\n";
+      releaseCode += "  this._arguments[" + name + "] = undefined;\n";
     }
   }
 
-  return gd::String("var eventsFunctionContext = {\n") +
-         // The object name to parameter map:
-         "  _objectsMap: {\n" + objectsGettersMap +
-         "},\n"
-         // The object name to arrays map:
-         "  _objectArraysMap: {\n" +
-         objectArraysMap +
-         "},\n"
-         // The behavior name to parameter map:
-         "  _behaviorNamesMap: {\n" +
-         behaviorNamesMap +
-         "},\n"
-         // Function that will be used to query objects, when a new object list
-         // is needed by events. We assume it's used a lot by the events
-         // generated code, so we cache the arrays in a map.
-         "  getObjects: function(objectName) {\n" +
-         "    return eventsFunctionContext._objectArraysMap[objectName] || "
-         "[];\n" +
-         "  },\n" +
-         // Function that can be used in JS code to get the lists of objects
-         // and filter/alter them (not actually used in events).
-         "  getObjectsLists: function(objectName) {\n" +
-         "    return eventsFunctionContext._objectsMap[objectName] || null;\n"
-         "  },\n" +
-         // Function that will be used to query behavior name (as behavior name
-         // can be different between the parameter name vs the actual behavior
-         // name passed as argument).
-         "  getBehaviorName: function(behaviorName) {\n" +
-         "    return eventsFunctionContext._behaviorNamesMap[behaviorName];\n"
-         "  },\n" +
-         // Creator function that will be used to create new objects. We
-         // need to check if the function was given the context of the calling
-         // function (parentEventsFunctionContext). If this is the case, use it
-         // to create the new object as the object names used in the function
-         // are not the same as the objects available in the scene.
-         "  createObject: function(objectName) {\n"
-         "    var objectsList = "
-         "eventsFunctionContext._objectsMap[objectName];\n" +
-         // TODO: we could speed this up by storing a map of object names, but
-         // the cost of creating/storing it for each events function might not
-         // be worth it.
-         "    if (objectsList) {\n" +
-         "      const object = parentEventsFunctionContext ?\n" +
-         "        "
-         "parentEventsFunctionContext.createObject(objectsList.firstKey()) "
-         ":\n" +
-         "        runtimeScene.createObject(objectsList.firstKey());\n" +
-         // Add the new instance to object lists
-         "      if (object) {\n" +
-         "        objectsList.get(objectsList.firstKey()).push(object);\n" +
-         "        eventsFunctionContext._objectArraysMap[objectName].push(object);\n" +
-         "      }\n" +
-         "      return object;" +
-         "    }\n" +
-         // Unknown object, don't create anything:
-         "    return null;\n" +
-         "  },\n"
-         // Allow to get a layer directly from the context for convenience:
-         "  getLayer: function(layerName) {\n"
-         "    return runtimeScene.getLayer(layerName);\n"
-         "  },\n"
-         // Getter for arguments that are not objects
-         "  getArgument: function(argName) {\n" +
-         argumentsGetters + "    return \"\";\n" + "  },\n" +
-         // Expose OnceTriggers (will be pointing either to the runtime scene
-         // ones, or the ones from the behavior):
-         "  getOnceTriggers: function() { return " + onceTriggersVariable +
-         "; }\n" + "};\n";
+  AddCustomCodeOutsideMain(
+      contextClassName + " = function() {\n" +
+      "  this.returnValue = undefined;\n"
+      "  this._runtimeScene = null;\n"
+      "  this._parentEventsFunctionContext = null;\n"
+      "  this._onceTriggers = null;\n"
+      // The object name to parameter map:
+      "  this._objectsMap = {\n" +
+      objectsMapDeclaration +
+      "};\n"
+      // The object name to arrays map, and if the arrays were filled:
+      "  this._objectArraysMap = {\n" +
+      objectArraysMapDeclaration +
+      "};\n"
+      "  this._objectArraysMaterialized = {\n" +
+      objectArraysMaterializedDeclaration +
+      "};\n"
+      // The behavior name to parameter map:
+      "  this._behaviorNamesMap = {\n" +
+      behaviorNamesMapDeclaration +
+      "};\n"
+      // The other arguments:
+      "  this._arguments = {\n" +
+      argumentsDeclaration +
+      "};\n"
+      "  this._objectsListsValues = [];\n"
+      "};\n" +
+      // Function that will be used to query objects, when a new object list
+      // is needed by events. The array is only filled the first time it's
+      // needed, and then kept (and updated when objects are created).
+      contextClassName +
+      ".prototype.getObjects = function(objectName) {\n"
+      "  var objectArray = this._objectArraysMap[objectName];\n"
+      "  if (!objectArray) return [];\n"
+      "  if (!this._objectArraysMaterialized[objectName]) "
+      "this._materializeObjectArray(objectName);\n"
+      "  return objectArray;\n"
+      "};\n" +
+      contextClassName +
+      ".prototype._materializeObjectArray = function(objectName) {\n"
+      "  var objectArray = this._objectArraysMap[objectName];\n"
+      "  var objectsLists = this._objectsMap[objectName];\n"
+      "  objectArray.length = 0;\n"
+      "  if (objectsLists) {\n"
+      "    var lists = this._objectsListsValues;\n"
+      "    objectsLists.values(lists);\n"
+      "    for (var i = 0; i < lists.length; ++i) {\n"
+      "      var list = lists[i];\n"
+      "      for (var k = 0; k < list.length; ++k) objectArray.push(list[k]);\n"
+      "    }\n"
+      "  }\n"
+      "  this._objectArraysMaterialized[objectName] = true;\n"
+      "};\n" +
+      // The arrays are built from the lists of the caller, which could be
+      // modified by another call to the same function: they must be filled
+      // before this function calls another one.
+      contextClassName +
+      ".prototype.materializeObjectArrays = function() {\n" +
+      materializeObjectArraysCode + "};\n" +
+      // Function that can be used in JS code to get the lists of objects
+      // and filter/alter them (not actually used in events).
+      contextClassName +
+      ".prototype.getObjectsLists = function(objectName) {\n"
+      "  return this._objectsMap[objectName] || null;\n"
+      "};\n" +
+      // Function that will be used to query behavior name (as behavior name
+      // can be different between the parameter name vs the actual behavior
+      // name passed as argument).
+      contextClassName +
+      ".prototype.getBehaviorName = function(behaviorName) {\n"
+      "  return this._behaviorNamesMap[behaviorName];\n"
+      "};\n" +
+      // Creator function that will be used to create new objects. We
+      // need to check if the function was given the context of the calling
+      // function (parentEventsFunctionContext). If this is the case, use it
+      // to create the new object as the object names used in the function
+      // are not the same as the objects available in the scene.
+      contextClassName +
+      ".prototype.createObject = function(objectName) {\n"
+      "  var objectsList = this._objectsMap[objectName];\n"
+      "  if (objectsList) {\n"
+      "    const object = this._parentEventsFunctionContext ?\n"
+      "      "
+      "this._parentEventsFunctionContext.createObject(objectsList.firstKey()) "
+      ":\n"
+      "      this._runtimeScene.createObject(objectsList.firstKey());\n"
+      // Add the new instance to object lists
+      "    if (object) {\n"
+      "      objectsList.get(objectsList.firstKey()).push(object);\n"
+      "      if (this._objectArraysMaterialized[objectName]) "
+      "this._objectArraysMap[objectName].push(object);\n"
+      "    }\n"
+      "    return object;\n"
+      "  }\n"
+      // Unknown object, don't create anything:
+      "  return null;\n"
+      "};\n" +
+      // Allow to get a layer directly from the context for convenience:
+      contextClassName +
+      ".prototype.getLayer = function(layerName) {\n"
+      "  return this._runtimeScene.getLayer(layerName);\n"
+      "};\n" +
+      // Getter for arguments that are not objects
+      contextClassName +
+      ".prototype.getArgument = function(argName) {\n" + argumentsGetters +
+      "  return \"\";\n"
+      "};\n" +
+      // Expose OnceTriggers (will be pointing either to the runtime scene
+      // ones, or the ones from the behavior):
+      contextClassName +
+      ".prototype.getOnceTriggers = function() {\n"
+      "  return this._onceTriggers;\n"
+      "};\n" +
+      // Give back the context to the pool, without keeping references to
+      // objects or to the scene.
+      contextClassName +
+      ".prototype.release = function() {\n"
+      "  this.returnValue = undefined;\n"
+      "  this._runtimeScene = null;\n"
+      "  this._parentEventsFunctionContext = null;\n"
+      "  this._onceTriggers = null;\n"
+      "  this._objectsListsValues.length = 0;\n" +
+      releaseCode + "  " + contextsPoolName +
+      ".push(this);\n"
+      "};\n" +
+      contextsPoolName + " = [];\n");
+
+  return "var eventsFunctionContext = " + contextsPoolName + ".pop() || new " +
+         contextClassName +
+         "();\n"
+         "if (parentEventsFunctionContext && "
+         "parentEventsFunctionContext.materializeObjectArrays) "
+         "parentEventsFunctionContext.materializeObjectArrays();\n"
+         "eventsFunctionContext._runtimeScene = runtimeScene;\n"
+         "eventsFunctionContext._parentEventsFunctionContext = "
+         "parentEventsFunctionContext;\n"
+         "eventsFunctionContext._onceTriggers = " +
+         onceTriggersVariable + ";\n" + setupCode +
+         // When the function is called by itself, the lists given as
+         // parameters are the ones that will be modified by its events.
+         "if (parentEventsFunctionContext instanceof " + contextClassName +
+         ") eventsFunctionContext.materializeObjectArrays();\n";
 }
 
 gd::String EventsCodeGenerator::GenerateEventsFunctionReturn(
     const gd::EventsFunction& eventsFunction) {
+  // The context is given back to the pool before returning, so the value
+  // to return is read before.
+  gd::String returnValueCode;
   if (eventsFunction.GetFunctionType() == gd::EventsFunction::Condition) {
-    return "return !!eventsFunctionContext.returnValue;";
+    returnValueCode = "!!eventsFunctionContext.returnValue";
   } else if (eventsFunction.GetFunctionType() ==
              gd::EventsFunction::Expression) {
-    return "return Number(eventsFunctionContext.returnValue) || 0;";
+    returnValueCode = "Number(eventsFunctionContext.returnValue) || 0";
   } else if (eventsFunction.GetFunctionType() ==
              gd::EventsFunction::StringExpression) {
-    return "return \"\" + eventsFunctionContext.returnValue;";
+    returnValueCode = "\"\" + eventsFunctionContext.returnValue";
   }
 
-  return "return;";
+  if (returnValueCode.empty())
+    return "eventsFunctionContext.release();\nreturn;";
+
+  return "var returnValue = " + returnValueCode +
+         ";\neventsFunctionContext.release();\nreturn returnValue;";
 }
 
 std::pair<gd::String, gd::String>
@@ -798,6 +953,7 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
     if (context.IsSameObjectsList(object, *context.GetParentContext()))
       return "/* Reuse " + objectListName + " */";
 
+    objectsListsCopiesCount++;
     gd::String copiedListName =
         GetObjectListName(object, *context.GetParentContext());
     return "gdjs.copyArray(" + copiedListName + ", " + objectListName + ");\n";
@@ -810,6 +966,7 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
       objectListDeclaration += "gdjs.copyArray(" +
                                GenerateAllInstancesGetterCode(object) + ", " +
                                GetObjectListName(object, context) + ");";
+      objectsListsCopiesCount++;
       context.SetObjectDeclared(object);
     } else
       objectListDeclaration = declareObjectList(object, context);
@@ -870,6 +1027,14 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
                                   ? "runtimeScene"
                                   : "runtimeScene, eventsFunctionContext";
 
+  // *Optimization*: events lists generating the same code (for example, the
+  // same external events linked in multiple places) are using the same
+  // function, as everything they use is stored in static variables. This
+  // reduces the code to be parsed and compiled by JS engines.
+  auto existingFunction = eventsListsFunctionNames.find(code);
+  if (existingFunction != eventsListsFunctionNames.end())
+    return existingFunction->second + "(" + parametersCode + ");";
+
   // Generate a unique name for the function.
   gd::String uniqueId =
       gd::String::From(GenerateSingleUsageUniqueIdForEventsList());
@@ -882,6 +1047,7 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // code.
   AddCustomCodeOutsideMain(functionName + " = function(" + parametersCode +
                            ") {\n" + code + "\n" + "};");
+  eventsListsFunctionNames[code] = functionName;
 
   // Replace the code of the events by the call to the function. This does not
   // interfere with the objects picking as the lists are in static variables
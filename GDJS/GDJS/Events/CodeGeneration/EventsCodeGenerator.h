@@ -7,6 +7,7 @@
 #define EVENTSCODEGENERATOR_H
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
@@ -21,6 +22,7 @@ class BehaviorMetadata;
 class InstructionMetadata;
 class ExpressionCodeGenerationInformation;
 class EventsCodeGenerationContext;
+class DeadEventsProjectFacts;
 }  // namespace gd
 
 namespace gdjs {
@@ -41,14 +43,53 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param codeReport If not null, will be filled with statistics about the
+   * code generated for each event.
+   * \param deadEventsProjectFacts If not null, the facts about the project
+   * used to remove the events that can never run (see
+   * gd::EventsCodeGenerator::SetDeadEventsProjectFacts).
    *
    * \return JavaScript code
    */
-  static gd::String GenerateLayoutCode(gd::Project& project,
-                                       const gd::Layout& scene,
-                                       const gd::String& codeNamespace,
-                                       std::set<gd::String>& includeFiles,
-                                       bool compilationForRuntime = false);
+  static gd::String GenerateLayoutCode(
+      gd::Project& project,
+      const gd::Layout& scene,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      bool compilationForRuntime = false,
+      gd::EventsCodeReport* codeReport = nullptr,
+      const gd::DeadEventsProjectFacts* deadEventsProjectFacts = nullptr);
+
+  /**
+   * Generate JavaScript for executing external events, as if they were the
+   * events of a scene.
+   *
+   * \note External events are usually generated as part of the scenes linking
+   * to them. This is used to generate statistics about them.
+   *
+   * \param project Project the external events belong to.
+   * \param externalEvents The external events to generate the code for.
+   * \param scene The scene used for the objects of the external events.
+   * \param codeNamespace Where to store the context used by the events.
+   * \param includeFiles Will be filled with the necessary include files.
+   * \param compilationForRuntime Set this to true if the code is generated for
+   * runtime.
+   * \param codeReport If not null, will be filled with statistics about the
+   * code generated for each event.
+   * \param deadEventsProjectFacts If not null, the facts about the project
+   * used to remove the events that can never run.
+   *
+   * \return JavaScript code
+   */
+  static gd::String GenerateExternalEventsCode(
+      gd::Project& project,
+      const gd::ExternalEvents& externalEvents,
+      const gd::Layout& scene,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      bool compilationForRuntime = false,
+      gd::EventsCodeReport* codeReport = nullptr,
+      const gd::DeadEventsProjectFacts* deadEventsProjectFacts = nullptr);
 
   /**
    * Generate JavaScript for executing events of an events based function.
@@ -59,6 +100,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param codeReport If not null, will be filled with statistics about the
+   * code generated for each event.
    *
    * \return JavaScript code
    */
@@ -67,7 +110,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::EventsFunction& eventsFunction,
       const gd::String& codeNamespace,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime = false);
+      bool compilationForRuntime = false,
+      gd::EventsCodeReport* codeReport = nullptr);
 
   /**
    * Generate JavaScript for executing events of a events based behavior
@@ -81,6 +125,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param preludeCode The code to run just before the events generated code.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param codeReport If not null, will be filled with statistics about the
+   * code generated for each event.
    *
    * \return JavaScript code
    */
@@ -93,7 +139,8 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       const gd::String& onceTriggersVariable,
       const gd::String& preludeCode,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime = false);
+      bool compilationForRuntime = false,
+      gd::EventsCodeReport* codeReport = nullptr);
 
   /**
    * \brief Generate code for executing an event list
@@ -101,6 +148,7 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * a separate JS function (see
    * gd::EventsCodeGenerator::AddCustomCodeOutsideMain). This method will return
    * the code to call this separate function.
+   * \note Events lists generating exactly the same code share the same function.
    *
    * \param events std::vector of events
    * \param context Context used for generation
@@ -263,6 +311,15 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
 
   virtual gd::String GenerateBadObject() { return "null"; }
 
+  virtual gd::String GenerateInlinedNumberCoercion(const gd::String& code) {
+    // Same as the conversion of arguments and returned values of functions.
+    return "(Number(" + code + ") || 0)";
+  }
+
+  virtual gd::String GenerateInlinedStringCoercion(const gd::String& code) {
+    return "(\"\" + " + code + ")";
+  }
+
   virtual gd::String GenerateObject(const gd::String& objectName,
                                     const gd::String& type,
                                     gd::EventsCodeGenerationContext& context);
@@ -360,19 +417,29 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
 
   gd::String codeNamespace;  ///< Optional namespace for the generated code,
                              ///< used when generating events function.
+  std::unordered_map<gd::String, gd::String>
+      eventsListsFunctionNames;  ///< The names of the functions generated for
+                                 ///< the events lists of the generated file
+                                 ///< (scene, external events or events
+                                 ///< function), indexed by their code. Not
+                                 ///< shared across files, as the code of each
+                                 ///< file uses its own namespace.
 private:
   /**
    * \brief Generate the "eventsFunctionContext" object that allow a function
    * to provides access objects, object creation and access to arguments from
    * the rest of the events.
+   *
+   * The class of the context is declared outside of the function, and the
+   * returned code takes an instance from a pool of contexts (it's given back by
+   * the code generated by GenerateEventsFunctionReturn).
    */
   gd::String GenerateEventsFunctionContext(
       const std::vector<gd::ParameterMetadata>& parameters,
       const gd::String& onceTriggersVariable,
-      gd::String& objectsGettersMap,
-      gd::String& objectArraysMap,
-      gd::String& behaviorNamesMap,
+      const std::vector<std::pair<gd::String, gd::String>>& behaviorNames,
       const gd::String& thisObjectName = "",
+      const gd::String& thisObjectCode = "",
       const gd::String& thisBehaviorName = "");
 };
 
@@ -10,6 +10,10 @@
 #include <string>
 #include <vector>
 #include "GDCore/Project/Layout.h"
+namespace gd {
+class EventsCodeReport;
+class DeadEventsProjectFacts;
+}  // namespace gd
 
 namespace gdjs {
 
@@ -27,11 +31,18 @@ class LayoutCodeGenerator {
 
   /**
    * \brief Generate the complete code for the events of the specified scene.
+   *
+   * If \a codeReport is not null, it is filled with statistics about the
+   * code generated for each event. If \a deadEventsProjectFacts is not null,
+   * it is used to remove the events that can never run (see
+   * gd::EventsCodeGenerator::SetDeadEventsProjectFacts).
    */
   gd::String GenerateLayoutCompleteCode(
       const gd::Layout& layout,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime);
+      bool compilationForRuntime,
+      gd::EventsCodeReport* codeReport = nullptr,
+      const gd::DeadEventsProjectFacts* deadEventsProjectFacts = nullptr);
 
  private:
   gd::Project& project;
@@ -750,6 +750,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (realObjects.empty()) return gd::String("");
         for (unsigned int i = 0; i < realObjects.size(); ++i)
           parentContext.ObjectsListNeeded(realObjects[i]);
+        codeGenerator.CountInstancesLoop();
 
         // Context is "reset" each time the event is repeated (i.e. objects are
         // picked again)
@@ -779,6 +780,28 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         gd::String subevents =
             codeGenerator.GenerateEventsListCode(event.GetSubEvents(), context);
 
+        //*Optimization*: objects lists that are only read by the conditions
+        // and actions (for example, in expressions) can't be modified by the
+        // loop. They are declared once before the loop, instead of being copied
+        // again for each instance. This is not done when there are sub events,
+        // as they could create or delete objects, which the next iterations
+        // must see.
+        std::set<gd::String> readOnlyObjectsLists;
+        if (!event.HasSubEvents())
+          readOnlyObjectsLists = context.GetObjectsListsToBeDeclaredOnlyRead();
+        gd::EventsCodeGenerationContext readOnlyObjectsListsContext = context;
+        for (auto& objectName : context.GetAllObjectsToBeDeclared()) {
+          if (readOnlyObjectsLists.find(objectName) ==
+              readOnlyObjectsLists.end())
+            readOnlyObjectsListsContext.SetObjectsListDeclaredElsewhere(
+                objectName);
+        }
+        for (auto& objectName : readOnlyObjectsLists)
+          context.SetObjectsListDeclaredElsewhere(objectName);
+
+        gd::String readOnlyObjectsDeclaration =
+            codeGenerator.GenerateObjectsDeclarationCode(
+                readOnlyObjectsListsContext);
         gd::String objectDeclaration =
             codeGenerator.GenerateObjectsDeclarationCode(context) + "\n";
 
@@ -790,23 +813,22 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
             codeGenerator.GetCodeNamespaceAccessor() + "forEachIndex" +
             gd::String::From(context.GetContextDepth());
         codeGenerator.AddGlobalDeclaration(forEachIndexVar + " = 0;\n");
-        gd::String forEachObjectsList =
-            codeGenerator.GetCodeNamespaceAccessor() + "forEachObjects" +
-            gd::String::From(context.GetContextDepth());
-        codeGenerator.AddGlobalDeclaration(forEachObjectsList + " = [];\n");
 
-        if (realObjects.size() !=
-            1)  //(We write a slighty more simple ( and optimized ) output code
-                // when only one object list is used.)
-        {
+        outputCode += readOnlyObjectsDeclaration;
+
+        //*Optimization*: for a group, the lists of the objects are iterated in
+        // place (one after the other), without concatenating them in a
+        // temporary array.
+        std::vector<gd::String> forEachCountVars;
+        if (realObjects.size() != 1) {
           outputCode += forEachTotalCountVar + " = 0;\n";
-          outputCode += forEachObjectsList + ".length = 0;\n";
           for (unsigned int i = 0; i < realObjects.size(); ++i) {
             gd::String forEachCountVar =
                 codeGenerator.GetCodeNamespaceAccessor() + "forEachCount" +
                 gd::String::From(i) + "_" +
                 gd::String::From(context.GetContextDepth());
             codeGenerator.AddGlobalDeclaration(forEachCountVar + " = 0;\n");
+            forEachCountVars.push_back(forEachCountVar);
 
             outputCode +=
                 forEachCountVar + " = " +
@@ -814,10 +836,6 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                 ".length;\n";
             outputCode +=
                 forEachTotalCountVar + " += " + forEachCountVar + ";\n";
-            outputCode +=
-                forEachObjectsList + ".push.apply(" + forEachObjectsList + "," +
-                codeGenerator.GetObjectListName(realObjects[i], parentContext) +
-                ");\n";
           }
         }
 
@@ -843,39 +861,36 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (realObjects.size() == 1) {
           // We write a slighty more simple ( and optimized ) output code
           // when only one object list is used.
-          gd::String temporary = codeGenerator.GetCodeNamespaceAccessor() +
-                                 "forEachTemporary" +
-                                 gd::String::From(context.GetContextDepth());
-          codeGenerator.AddGlobalDeclaration(temporary + " = null;\n");
-          outputCode +=
-              temporary + " = " +
-              codeGenerator.GetObjectListName(realObjects[0], parentContext) +
-              "[" + forEachIndexVar + "];\n";
-
           outputCode +=
               codeGenerator.GetObjectListName(realObjects[0], context) +
-              ".push(" + temporary + ");\n";
+              ".push(" +
+              codeGenerator.GetObjectListName(realObjects[0], parentContext) +
+              "[" + forEachIndexVar + "]);\n";
         } else {
-          // Generate the code to pick only one object in the lists
+          // Generate the code to pick only one object in the lists, reading
+          // the instance directly from the list it belongs to.
+          gd::String countBefore;
           for (unsigned int i = 0; i < realObjects.size(); ++i) {
-            gd::String count;
-            for (unsigned int j = 0; j <= i; ++j) {
-              gd::String forEachCountVar =
-                  codeGenerator.GetCodeNamespaceAccessor() + "forEachCount" +
-                  gd::String::From(j) + "_" +
-                  gd::String::From(context.GetContextDepth());
-
-              if (j != 0) count += "+";
-              count += forEachCountVar;
-            }
+            gd::String countUntil = countBefore.empty()
+                                        ? forEachCountVars[i]
+                                        : countBefore + "+" + forEachCountVars[i];
+            gd::String indexInList =
+                countBefore.empty()
+                    ? forEachIndexVar
+                    : forEachIndexVar + "-(" + countBefore + ")";
 
             if (i != 0) outputCode += "else ";
-            outputCode += "if (" + forEachIndexVar + " < " + count + ") {\n";
+            outputCode +=
+                "if (" + forEachIndexVar + " < " + countUntil + ") {\n";
             outputCode +=
                 "    " +
                 codeGenerator.GetObjectListName(realObjects[i], context) +
-                ".push(" + forEachObjectsList + "[" + forEachIndexVar + "]);\n";
+                ".push(" +
+                codeGenerator.GetObjectListName(realObjects[i], parentContext) +
+                "[" + indexInList + "]);\n";
             outputCode += "}\n";
+
+            countBefore = countUntil;
           }
         }
 
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <streambuf>
 #include <string>
@@ -15,11 +16,15 @@
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Events/UsedExtensionsFinder.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+#include "GDCore/IDE/Project/SceneResourcesFinder.h"
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
 #include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/LoadingScreen.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/TinyXml/tinyxml.h"
@@ -50,19 +55,52 @@ bool Exporter::ExportWholePixiProject(
     gd::String exportDir,
     std::map<gd::String, bool> &exportOptions) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
-  gd::Project exportedProject = project;
+
+  // The project is modified by the export, so it's copied (sharing what is
+  // not modified, like the instances of layouts) - unless it's
+  // exported layout by layout: in this case, only the resources and the
+  // loading screen (the only things modified before the data export) are
+  // copied.
+  // Projects with events or objects referencing files directly (instead of
+  // resources) are always copied, as these references are renamed.
+  bool exportLayoutByLayout =
+      exportOptions["exportLayoutByLayout"] &&
+      !gd::ProjectResourcesCopier::HasFilesOutsideOfResources(project);
+  std::unique_ptr<gd::Project> projectCopy;
+  gd::ResourcesManager resourcesManagerCopy;
+  gd::LoadingScreen loadingScreenCopy;
+  if (exportLayoutByLayout) {
+    resourcesManagerCopy = project.GetResourcesManager();
+    loadingScreenCopy = project.GetLoadingScreen();
+  } else {
+    projectCopy = project.CloneWithCopyOnWrite();
+  }
+  gd::Project &exportedProject = projectCopy ? *projectCopy : project;
+  gd::ResourcesManager &exportedResources =
+      projectCopy ? projectCopy->GetResourcesManager() : resourcesManagerCopy;
+  gd::LoadingScreen &loadingScreen =
+      projectCopy ? projectCopy->GetLoadingScreen() : loadingScreenCopy;
 
   auto usedExtensions = gd::UsedExtensionsFinder::ScanProject(project);
 
-  auto exportProject = [this, &exportedProject, &exportOptions, &helper](
-                           gd::String exportDir) {
+  auto exportProject = [this,
+                        &exportedProject,
+                        &projectCopy,
+                        &exportedResources,
+                        &loadingScreen,
+                        &exportOptions,
+                        &helper](gd::String exportDir) {
     bool exportForCordova = exportOptions["exportForCordova"];
     bool exportForFacebookInstantGames =
         exportOptions["exportForFacebookInstantGames"];
+    bool exportEventsCodeReport = exportOptions["exportEventsCodeReport"];
+    bool incrementalResourcesCopy =
+        exportOptions["incrementalResourcesCopy"];
+    bool exportTextureAtlases = exportOptions["exportTextureAtlases"];
 
     // Always disable the splash for Facebook Instant Games
     if (exportForFacebookInstantGames)
-      exportedProject.GetLoadingScreen().ShowGDevelopSplash(false);
+      loadingScreen.ShowGDevelopSplash(false);
 
     // Prepare the export directory
     fs.MkDir(exportDir);
@@ -70,21 +108,50 @@ bool Exporter::ExportWholePixiProject(
 
     // Export the resources (before generating events as some resources
     // filenames may be updated)
-    helper.ExportResources(fs, exportedProject, exportDir);
+    if (projectCopy)
+      helper.ExportResources(
+          fs, exportedProject, exportDir, incrementalResourcesCopy);
+    else
+      helper.ExportResources(fs,
+                             exportedProject,
+                             exportedResources,
+                             exportDir,
+                             incrementalResourcesCopy);
 
     // Compatibility with GD <= 5.0-beta56
     // Stay compatible with text objects declaring their font as just a filename
     // without a font resource - by manually adding these resources.
     helper.AddDeprecatedFontFilesToFontResources(
-        fs, exportedProject.GetResourcesManager(), exportDir);
+        fs, exportedResources, exportDir);
     // end of compatibility code
 
+    // Find the resources used by each scene (before packing images, which
+    // removes resources, and before stripping the events), so that the game
+    // can load them scene by scene.
+    std::map<gd::String, std::set<gd::String>> scenesResources;
+    for (std::size_t i = 0; i < exportedProject.GetLayoutsCount(); ++i) {
+      gd::Layout &layout = exportedProject.GetLayout(i);
+      scenesResources[layout.GetName()] =
+          gd::SceneResourcesFinder::FindSceneResources(exportedProject,
+                                                       layout);
+    }
+
+    // Pack the small images of sprite objects into texture atlases (after
+    // exporting resources, as images are read from the export directory).
+    gd::TextureAtlasPacker textureAtlasPacker(fs);
+    if (exportTextureAtlases) {
+      textureAtlasPacker.PackImages(
+          exportedProject, exportedResources, exportDir);
+      for (auto &sceneResources : scenesResources)
+        textureAtlasPacker.UpdateResourceNames(sceneResources.second);
+    }
+
     // Export engine libraries
     helper.AddLibsInclude(
         /*pixiRenderers=*/true,
         /*includeWebsocketDebuggerClient=*/false,
         /*includeWindowMessageDebuggerClient=*/false,
-        exportedProject.GetLoadingScreen().GetGDevelopLogoStyle(),
+        loadingScreen.GetGDevelopLogoStyle(),
         includesFiles);
 
     // Export files for object and behaviors
@@ -95,13 +162,26 @@ bool Exporter::ExportWholePixiProject(
     helper.ExportEffectIncludes(exportedProject, includesFiles);
 
     // Export events
+    gd::SerializerElement eventsCodeReport;
     if (!helper.ExportEventsCode(
-            exportedProject, codeOutputDir, includesFiles, false)) {
+            exportedProject,
+            codeOutputDir,
+            includesFiles,
+            false,
+            exportEventsCodeReport ? &eventsCodeReport : nullptr)) {
       gd::LogError(_("Error during exporting! Unable to export events:\n") +
                    lastError);
       return false;
     }
 
+    // The report is not part of the game: it's written next to the exported
+    // files to find the events generating the most code.
+    if (exportEventsCodeReport &&
+        !fs.WriteToFile(exportDir + "/events-code-report.json",
+                        gd::Serializer::ToJSON(eventsCodeReport))) {
+      gd::LogWarning(_("Unable to write the events code report."));
+    }
+
     // Export source files
     if (!helper.ExportExternalSourceFiles(
             exportedProject, codeOutputDir, includesFiles)) {
@@ -111,16 +191,37 @@ bool Exporter::ExportWholePixiProject(
       return false;
     }
 
-    // Strip the project (*after* generating events as the events may use
-    // stripped things like objects groups...)...
-    gd::ProjectStripper::StripProjectForExport(exportedProject);
-
-    //...and export it
     gd::SerializerElement noRuntimeGameOptions;
-    helper.ExportProjectData(
-        fs, exportedProject, codeOutputDir + "/data.js", noRuntimeGameOptions);
+    if (projectCopy) {
+      // Strip the project (*after* generating events as the events may use
+      // stripped things like objects groups...)...
+      gd::ProjectStripper::StripProjectForExport(exportedProject);
+
+      //...and export it
+      helper.ExportProjectData(fs,
+                               exportedProject,
+                               codeOutputDir + "/data.js",
+                               noRuntimeGameOptions,
+                               &scenesResources);
+    } else {
+      helper.ExportProjectDataLayoutByLayout(
+          fs,
+          exportedProject,
+          exportedResources,
+          loadingScreen,
+          exportedProject.GetFirstLayout(),
+          codeOutputDir + "/data.js",
+          noRuntimeGameOptions,
+          &scenesResources);
+    }
     includesFiles.push_back(codeOutputDir + "/data.js");
 
+    if (!textureAtlasPacker.GetPages().empty()) {
+      helper.ExportTextureAtlases(
+          fs, textureAtlasPacker, codeOutputDir + "/atlases.js");
+      includesFiles.push_back(codeOutputDir + "/atlases.js");
+    }
+
     helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
 
     gd::String source = gdjsRoot + "/Runtime/index.html";
@@ -148,14 +249,16 @@ bool Exporter::ExportWholePixiProject(
 
     if (!exportProject(exportDir + "/www")) return false;
 
-    if (!helper.ExportCordovaFiles(exportedProject, exportDir, usedExtensions))
+    if (!helper.ExportCordovaFiles(
+            exportedProject, exportedResources, exportDir, usedExtensions))
       return false;
   } else if (exportOptions["exportForElectron"]) {
     fs.MkDir(exportDir);
 
     if (!exportProject(exportDir + "/app")) return false;
 
-    if (!helper.ExportElectronFiles(exportedProject, exportDir, usedExtensions))
+    if (!helper.ExportElectronFiles(
+            exportedProject, exportedResources, exportDir, usedExtensions))
       return false;
   } else if (exportOptions["exportForFacebookInstantGames"]) {
     if (!exportProject(exportDir)) return false;
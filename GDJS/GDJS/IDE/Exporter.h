@@ -44,6 +44,10 @@ class Exporter {
    * \brief Export the specified project, using Pixi.js.
    *
    * Called by ShowProjectExportDialog if the user clicked on Ok.
+   *
+   * If the option "exportEventsCodeReport" is set, a report of the code
+   * generated for each event is written in "events-code-report.json" in the
+   * export directory.
    */
   bool ExportWholePixiProject(gd::Project& project,
                               gd::String exportDir,
@@ -11,31 +11,42 @@
 #include <algorithm>
 #include <fstream>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <streambuf>
 #include <string>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeReport.h"
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/Events/DeadEventsEliminator.h"
 #include "GDCore/IDE/ExportedDependencyResolver.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+#include "GDCore/IDE/Project/SceneResourcesFinder.h"
+#include "GDCore/IDE/Project/TextureAtlasPacker.h"
 #include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/IDE/SceneNameMangler.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Project/Layout.h"
+#include "GDCore/Project/LoadingScreen.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Project/PropertyDescriptor.h"
+#include "GDCore/Project/ResourcesManager.h"
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
@@ -56,6 +67,16 @@ double LogTimeSpent(const gd::String &name, double previousTime) {
   std::cout << std::endl;
   return GetTimeNow();
 }
+void AddSceneResources(
+    const std::map<gd::String, std::set<gd::String>> &scenesResources,
+    gd::SerializerElement &layoutElement) {
+  auto sceneResources =
+      scenesResources.find(layoutElement.GetStringAttribute("name"));
+  if (sceneResources == scenesResources.end()) return;
+
+  gd::SceneResourcesFinder::SerializeTo(
+      sceneResources->second, layoutElement.AddChild("usedResources"));
+}
 }  // namespace
 
 namespace gdjs {
@@ -74,21 +95,57 @@ bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   double previousTime = GetTimeNow();
   fs.MkDir(options.exportPath);
-  fs.ClearDir(options.exportPath);
+  if (options.incrementalResourcesCopy)
+    gd::ProjectResourcesCopier::ClearDirExceptCopiedResources(
+        fs, options.exportPath);
+  else
+    fs.ClearDir(options.exportPath);
   std::vector<gd::String> includesFiles;
 
-  gd::Project exportedProject = options.project;
+  // The project is modified by the export, so it's copied (sharing what is
+  // not modified, like the instances of layouts) - unless it's
+  // exported layout by layout: in this case, only the resources and the
+  // loading screen (the only things modified before the data export) are
+  // copied.
+  // Projects with events or objects referencing files directly (instead of
+  // resources) are always copied, as these references are renamed.
+  std::unique_ptr<gd::Project> projectCopy;
+  gd::ResourcesManager resourcesManagerCopy;
+  gd::LoadingScreen loadingScreenCopy;
+  if (options.layoutByLayoutExport &&
+      !gd::ProjectResourcesCopier::HasFilesOutsideOfResources(
+          options.project)) {
+    resourcesManagerCopy = options.project.GetResourcesManager();
+    loadingScreenCopy = options.project.GetLoadingScreen();
+  } else {
+    projectCopy = options.project.CloneWithCopyOnWrite();
+  }
+  gd::Project &exportedProject = projectCopy ? *projectCopy : options.project;
+  gd::ResourcesManager &exportedResources =
+      projectCopy ? projectCopy->GetResourcesManager() : resourcesManagerCopy;
+  gd::LoadingScreen &loadingScreen =
+      projectCopy ? projectCopy->GetLoadingScreen() : loadingScreenCopy;
 
   if (!options.fullLoadingScreen) {
     // Most of the time, we skip the logo and minimum duration so that
     // the preview start as soon as possible.
-    exportedProject.GetLoadingScreen().ShowGDevelopSplash(false);
-    exportedProject.GetLoadingScreen().SetMinDuration(0);
+    loadingScreen.ShowGDevelopSplash(false);
+    loadingScreen.SetMinDuration(0);
   }
 
   // Export resources (*before* generating events as some resources filenames
   // may be updated)
-  ExportResources(fs, exportedProject, options.exportPath);
+  if (projectCopy)
+    ExportResources(fs,
+                    exportedProject,
+                    options.exportPath,
+                    options.incrementalResourcesCopy);
+  else
+    ExportResources(fs,
+                    exportedProject,
+                    exportedResources,
+                    options.exportPath,
+                    options.incrementalResourcesCopy);
 
   previousTime = LogTimeSpent("Resource export", previousTime);
 
@@ -96,7 +153,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   // Stay compatible with text objects declaring their font as just a filename
   // without a font resource - by manually adding these resources.
   AddDeprecatedFontFilesToFontResources(
-      fs, exportedProject.GetResourcesManager(), options.exportPath);
+      fs, exportedResources, options.exportPath);
   // end of compatibility code
 
   // Export engine libraries
@@ -105,7 +162,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                  !options.websocketDebuggerServerAddress.empty(),
                  /*includeWindowMessageDebuggerClient=*/
                  options.useWindowMessageDebuggerClient,
-                 exportedProject.GetLoadingScreen().GetGDevelopLogoStyle(),
+                 loadingScreen.GetGDevelopLogoStyle(),
                  includesFiles);
 
   // Export files for object and behaviors
@@ -134,13 +191,6 @@ bool ExporterHelper::ExportProjectForPixiPreview(
     previousTime = LogTimeSpent("Events code export", previousTime);
   }
 
-  // Strip the project (*after* generating events as the events may use stripped
-  // things (objects groups...))
-  gd::ProjectStripper::StripProjectForExport(exportedProject);
-  exportedProject.SetFirstLayout(options.layoutName);
-
-  previousTime = LogTimeSpent("Data stripping", previousTime);
-
   // Create the setup options passed to the gdjs.RuntimeGame
   gd::SerializerElement runtimeGameOptions;
   runtimeGameOptions.AddChild("isPreview").SetBoolValue(true);
@@ -170,8 +220,25 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   }
 
   // Export the project
-  ExportProjectData(
-      fs, exportedProject, codeOutputDir + "/data.js", runtimeGameOptions);
+  if (projectCopy) {
+    // Strip the project (*after* generating events as the events may use
+    // stripped things (objects groups...))
+    gd::ProjectStripper::StripProjectForExport(exportedProject);
+    exportedProject.SetFirstLayout(options.layoutName);
+
+    previousTime = LogTimeSpent("Data stripping", previousTime);
+
+    ExportProjectData(
+        fs, exportedProject, codeOutputDir + "/data.js", runtimeGameOptions);
+  } else {
+    ExportProjectDataLayoutByLayout(fs,
+                                    exportedProject,
+                                    exportedResources,
+                                    loadingScreen,
+                                    options.layoutName,
+                                    codeOutputDir + "/data.js",
+                                    runtimeGameOptions);
+  }
   includesFiles.push_back(codeOutputDir + "/data.js");
 
   previousTime = LogTimeSpent("Project data export", previousTime);
@@ -196,12 +263,18 @@ gd::String ExporterHelper::ExportProjectData(
     gd::AbstractFileSystem &fs,
     const gd::Project &project,
     gd::String filename,
-    const gd::SerializerElement &runtimeGameOptions) {
+    const gd::SerializerElement &runtimeGameOptions,
+    const std::map<gd::String, std::set<gd::String>> *scenesResources) {
   fs.MkDir(fs.DirNameFrom(filename));
 
   // Save the project to JSON
   gd::SerializerElement rootElement;
   project.SerializeTo(rootElement);
+  if (scenesResources) {
+    gd::SerializerElement &layoutsElement = rootElement.GetChild("layouts");
+    for (std::size_t i = 0; i < layoutsElement.GetChildrenCount(); ++i)
+      AddSceneResources(*scenesResources, layoutsElement.GetChild(i));
+  }
   gd::String output =
       "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
       "gdjs.runtimeGameOptions = " +
@@ -212,6 +285,79 @@ gd::String ExporterHelper::ExportProjectData(
   return "";
 }
 
+gd::String ExporterHelper::ExportTextureAtlases(
+    gd::AbstractFileSystem &fs,
+    const gd::TextureAtlasPacker &textureAtlasPacker,
+    gd::String filename) {
+  fs.MkDir(fs.DirNameFrom(filename));
+
+  gd::SerializerElement atlasesElement;
+  textureAtlasPacker.SerializeTo(atlasesElement);
+  gd::String output = "gdjs.projectData.resources.atlases = " +
+                      gd::Serializer::ToJSON(atlasesElement) + ";\n";
+
+  if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
+
+  return "";
+}
+
+gd::String ExporterHelper::ExportProjectDataLayoutByLayout(
+    gd::AbstractFileSystem &fs,
+    const gd::Project &project,
+    const gd::ResourcesManager &resourcesManager,
+    const gd::LoadingScreen &loadingScreen,
+    const gd::String &firstLayout,
+    gd::String filename,
+    const gd::SerializerElement &runtimeGameOptions,
+    const std::map<gd::String, std::set<gd::String>> *scenesResources) {
+  fs.MkDir(fs.DirNameFrom(filename));
+
+  // Save everything but the layouts to JSON, replacing what is changed for
+  // the export.
+  gd::SerializerElement rootElement;
+  project.SerializeWithoutLayoutsTo(rootElement);
+  gd::ProjectStripper::StripSerializedProjectForExport(rootElement);
+  rootElement.SetAttribute("firstLayout", firstLayout);
+
+  gd::SerializerElement &resourcesElement = rootElement.GetChild("resources");
+  resourcesElement = gd::SerializerElement();
+  resourcesManager.SerializeTo(resourcesElement);
+
+  gd::SerializerElement &loadingScreenElement =
+      rootElement.GetChild("properties").GetChild("loadingScreen");
+  loadingScreenElement = gd::SerializerElement();
+  loadingScreen.SerializeTo(loadingScreenElement);
+
+  // The layouts are added at the end of the project object.
+  rootElement.RemoveChild("layouts");
+  gd::String output = gd::Serializer::ToJSON(rootElement);
+  output.pop_back();
+  if (!fs.WriteToFile(filename,
+                      "gdjs.projectData = " + output + ",\"layouts\":["))
+    return "Unable to write " + filename;
+
+  // Then each layout is stripped, saved to JSON and written separately, so
+  // that only one layout is serialized in memory at a time.
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    std::unique_ptr<gd::Layout> layout(
+        project.GetLayout(i).CloneWithCopyOnWrite());
+    gd::ProjectStripper::StripLayoutForExport(*layout);
+
+    gd::SerializerElement layoutElement;
+    layout->SerializeTo(layoutElement);
+    if (scenesResources) AddSceneResources(*scenesResources, layoutElement);
+    output = (i != 0 ? "," : "") + gd::Serializer::ToJSON(layoutElement);
+    if (!fs.AppendToFile(filename, output))
+      return "Unable to write " + filename;
+  }
+
+  output = "]};\ngdjs.runtimeGameOptions = " +
+           gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+  if (!fs.AppendToFile(filename, output)) return "Unable to write " + filename;
+
+  return "";
+}
+
 bool ExporterHelper::ExportPixiIndexFile(
     const gd::Project &project,
     gd::String source,
@@ -238,16 +384,18 @@ bool ExporterHelper::ExportPixiIndexFile(
   return true;
 }
 
-bool ExporterHelper::ExportCordovaFiles(const gd::Project &project,
-                                        gd::String exportDir,
-                                        std::set<gd::String> usedExtensions) {
+bool ExporterHelper::ExportCordovaFiles(
+    const gd::Project &project,
+    const gd::ResourcesManager &resourcesManager,
+    gd::String exportDir,
+    std::set<gd::String> usedExtensions) {
   auto &platformSpecificAssets = project.GetPlatformSpecificAssets();
-  auto &resourceManager = project.GetResourcesManager();
-  auto getIconFilename = [&resourceManager, &platformSpecificAssets](
+  auto getIconFilename = [&resourcesManager, &platformSpecificAssets](
                              const gd::String &platform,
                              const gd::String &name) {
     const gd::String &file =
-        resourceManager.GetResource(platformSpecificAssets.Get(platform, name))
+        resourcesManager
+            .GetResource(platformSpecificAssets.Get(platform, name))
             .GetFile();
     return file.empty() ? "" : "www/" + file;
   };
@@ -391,9 +539,11 @@ bool ExporterHelper::ExportFacebookInstantGamesFiles(const gd::Project &project,
   return true;
 }
 
-bool ExporterHelper::ExportElectronFiles(const gd::Project &project,
-                                         gd::String exportDir,
-                                         std::set<gd::String> usedExtensions) {
+bool ExporterHelper::ExportElectronFiles(
+    const gd::Project &project,
+    const gd::ResourcesManager &resourcesManager,
+    gd::String exportDir,
+    std::set<gd::String> usedExtensions) {
   gd::String jsonName =
       gd::Serializer::ToJSON(gd::SerializerElement(project.GetName()));
   gd::String jsonPackageName =
@@ -471,10 +621,9 @@ bool ExporterHelper::ExportElectronFiles(const gd::Project &project,
   }
 
   auto &platformSpecificAssets = project.GetPlatformSpecificAssets();
-  auto &resourceManager = project.GetResourcesManager();
 
   gd::String iconFilename =
-      resourceManager
+      resourcesManager
           .GetResource(platformSpecificAssets.Get("desktop", "icon-512"))
           .GetFile();
   auto projectDirectory = gd::AbstractFileSystem::NormalizeSeparator(
@@ -636,18 +785,45 @@ bool ExporterHelper::ExportEffectIncludes(
   return true;
 }
 
-bool ExporterHelper::ExportEventsCode(gd::Project &project,
-                                      gd::String outputDir,
-                                      std::vector<gd::String> &includesFiles,
-                                      bool exportForPreview) {
+bool ExporterHelper::ExportEventsCode(
+    gd::Project &project,
+    gd::String outputDir,
+    std::vector<gd::String> &includesFiles,
+    bool exportForPreview,
+    gd::SerializerElement *eventsCodeReport) {
   fs.MkDir(outputDir);
 
+  gd::SerializerElement *layoutsReports = nullptr;
+  if (eventsCodeReport) {
+    layoutsReports = &eventsCodeReport->AddChild("layouts");
+    layoutsReports->ConsiderAsArrayOf("layout");
+  }
+
+  // Events that can never run are removed from the exports for runtime. What
+  // the events of the project can create or modify is collected once, for all
+  // the layouts.
+  std::unique_ptr<gd::DeadEventsProjectFacts> deadEventsProjectFacts;
+  if (!exportForPreview)
+    deadEventsProjectFacts =
+        gd::make_unique<gd::DeadEventsProjectFacts>(JsPlatform::Get(), project);
+
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     std::set<gd::String> eventsIncludes;
     gd::Layout &layout = project.GetLayout(i);
+    gd::EventsCodeReport codeReport;
     LayoutCodeGenerator layoutCodeGenerator(project);
     gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, !exportForPreview);
+        layout,
+        eventsIncludes,
+        !exportForPreview,
+        eventsCodeReport ? &codeReport : nullptr,
+        deadEventsProjectFacts.get());
+
+    if (layoutsReports) {
+      gd::SerializerElement &layoutReport = layoutsReports->AddChild("layout");
+      layoutReport.SetAttribute("name", layout.GetName());
+      codeReport.SerializeTo(layoutReport);
+    }
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
 
@@ -662,9 +838,115 @@ bool ExporterHelper::ExportEventsCode(gd::Project &project,
     }
   }
 
+  if (eventsCodeReport)
+    ExportEventsCodeReportForNonLayoutEvents(project,
+                                             exportForPreview,
+                                             *eventsCodeReport,
+                                             deadEventsProjectFacts.get());
+
   return true;
 }
 
+void ExporterHelper::ExportEventsCodeReportForNonLayoutEvents(
+    gd::Project &project,
+    bool exportForPreview,
+    gd::SerializerElement &eventsCodeReport,
+    const gd::DeadEventsProjectFacts *deadEventsProjectFacts) {
+  // The code of external events and events functions is not written, as it is
+  // generated as part of the scenes or by the IDE: it's only generated to
+  // fill the report.
+  std::set<gd::String> unusedIncludes;
+
+  gd::SerializerElement &externalEventsReports =
+      eventsCodeReport.AddChild("externalEvents");
+  externalEventsReports.ConsiderAsArrayOf("externalEvents");
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    const gd::ExternalEvents &externalEvents = project.GetExternalEvents(i);
+    // Objects of external events are only known from their associated layout.
+    if (!project.HasLayoutNamed(externalEvents.GetAssociatedLayout())) continue;
+
+    gd::EventsCodeReport codeReport;
+    EventsCodeGenerator::GenerateExternalEventsCode(
+        project,
+        externalEvents,
+        project.GetLayout(externalEvents.GetAssociatedLayout()),
+        "gdjs.externalEventsCodeReport",
+        unusedIncludes,
+        !exportForPreview,
+        &codeReport,
+        deadEventsProjectFacts);
+
+    gd::SerializerElement &externalEventsReport =
+        externalEventsReports.AddChild("externalEvents");
+    externalEventsReport.SetAttribute("name", externalEvents.GetName());
+    codeReport.SerializeTo(externalEventsReport);
+  }
+
+  gd::SerializerElement &eventsFunctionsReports =
+      eventsCodeReport.AddChild("eventsFunctions");
+  eventsFunctionsReports.ConsiderAsArrayOf("eventsFunction");
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    const gd::EventsFunctionsExtension &extension =
+        project.GetEventsFunctionsExtension(e);
+
+    for (std::size_t i = 0; i < extension.GetEventsFunctionsCount(); ++i) {
+      const gd::EventsFunction &eventsFunction =
+          extension.GetEventsFunction(i);
+
+      gd::EventsCodeReport codeReport;
+      EventsCodeGenerator::GenerateEventsFunctionCode(
+          project,
+          eventsFunction,
+          "gdjs.eventsFunctionCodeReport",
+          unusedIncludes,
+          !exportForPreview,
+          &codeReport);
+
+      gd::SerializerElement &eventsFunctionReport =
+          eventsFunctionsReports.AddChild("eventsFunction");
+      eventsFunctionReport.SetAttribute("extension", extension.GetName());
+      eventsFunctionReport.SetAttribute("name", eventsFunction.GetName());
+      codeReport.SerializeTo(eventsFunctionReport);
+    }
+
+    for (std::size_t b = 0; b < extension.GetEventsBasedBehaviors().size();
+         ++b) {
+      const gd::EventsBasedBehavior &eventsBasedBehavior =
+          extension.GetEventsBasedBehaviors().Get(b);
+      const gd::EventsFunctionsContainer &eventsFunctions =
+          eventsBasedBehavior.GetEventsFunctions();
+
+      for (std::size_t i = 0; i < eventsFunctions.GetEventsFunctionsCount();
+           ++i) {
+        const gd::EventsFunction &eventsFunction =
+            eventsFunctions.GetEventsFunction(i);
+
+        gd::EventsCodeReport codeReport;
+        EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
+            project,
+            eventsBasedBehavior,
+            eventsFunction,
+            "gdjs.behaviorEventsFunctionCodeReport",
+            "gdjs.behaviorEventsFunctionCodeReport.func",
+            "this._onceTriggers",
+            "",
+            unusedIncludes,
+            !exportForPreview,
+            &codeReport);
+
+        gd::SerializerElement &eventsFunctionReport =
+            eventsFunctionsReports.AddChild("eventsFunction");
+        eventsFunctionReport.SetAttribute("extension", extension.GetName());
+        eventsFunctionReport.SetAttribute("behavior",
+                                          eventsBasedBehavior.GetName());
+        eventsFunctionReport.SetAttribute("name", eventsFunction.GetName());
+        codeReport.SerializeTo(eventsFunctionReport);
+      }
+    }
+  }
+}
+
 bool ExporterHelper::ExportExternalSourceFiles(
     gd::Project &project,
     gd::String outputDir,
@@ -731,6 +1013,9 @@ bool ExporterHelper::ExportIncludesAndLibs(
     const std::vector<gd::String> &includesFiles,
     gd::String exportDir,
     bool exportSourceMaps) {
+  // Files are copied in a single batch, so that file systems can copy them
+  // concurrently (destination directories are created by CopyFiles).
+  std::vector<gd::AbstractFileSystem::FileCopy> copies;
   for (auto &include : includesFiles) {
     if (!fs.IsAbsolute(include)) {
       // By convention, an include file that is relative is relative to
@@ -738,15 +1023,14 @@ bool ExporterHelper::ExportIncludesAndLibs(
       // path when exported.
       gd::String source = gdjsRoot + "/Runtime/" + include;
       if (fs.FileExists(source)) {
-        gd::String path = fs.DirNameFrom(exportDir + "/" + include);
-        if (!fs.DirExists(path)) fs.MkDir(path);
-
-        fs.CopyFile(source, exportDir + "/" + include);
+        copies.push_back(gd::AbstractFileSystem::FileCopy(
+            source, exportDir + "/" + include));
 
         gd::String sourceMap = source + ".map";
         // Copy source map if present
         if (exportSourceMaps && fs.FileExists(sourceMap)) {
-          fs.CopyFile(sourceMap, exportDir + "/" + include + ".map");
+          copies.push_back(gd::AbstractFileSystem::FileCopy(
+              sourceMap, exportDir + "/" + include + ".map"));
         }
       } else {
         std::cout << "Could not find GDJS include file " << include
@@ -756,13 +1040,19 @@ bool ExporterHelper::ExportIncludesAndLibs(
       // Note: all the code generated from events are generated in another
       // folder and fall in this case:
       if (fs.FileExists(include)) {
-        fs.CopyFile(include, exportDir + "/" + fs.FileNameFrom(include));
+        copies.push_back(gd::AbstractFileSystem::FileCopy(
+            include, exportDir + "/" + fs.FileNameFrom(include)));
       } else {
         std::cout << "Could not find include file " << include << std::endl;
       }
     }
   }
 
+  for (auto &error : fs.CopyFiles(copies)) {
+    std::cout << "Could not copy include file " << error.file << " to "
+              << error.destination << ": " << error.message << std::endl;
+  }
+
   return true;
 }
 
@@ -807,9 +1097,19 @@ void ExporterHelper::ExportObjectAndBehaviorsIncludes(
 
 void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
                                      gd::Project &project,
-                                     gd::String exportDir) {
+                                     gd::String exportDir,
+                                     bool incrementalCopy) {
+  gd::ProjectResourcesCopier::CopyAllResourcesTo(
+      project, fs, exportDir, true, false, false, incrementalCopy);
+}
+
+void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
+                                     const gd::Project &project,
+                                     gd::ResourcesManager &resourcesManager,
+                                     gd::String exportDir,
+                                     bool incrementalCopy) {
   gd::ProjectResourcesCopier::CopyAllResourcesTo(
-      project, fs, exportDir, true, false, false);
+      project, resourcesManager, fs, exportDir, false, false, incrementalCopy);
 }
 
 void ExporterHelper::AddDeprecatedFontFilesToFontResources(
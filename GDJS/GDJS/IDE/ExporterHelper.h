@@ -18,6 +18,9 @@ class ExternalLayout;
 class SerializerElement;
 class AbstractFileSystem;
 class ResourcesManager;
+class LoadingScreen;
+class TextureAtlasPacker;
+class DeadEventsProjectFacts;
 }  // namespace gd
 class wxProgressDialog;
 
@@ -37,6 +40,8 @@ struct PreviewExportOptions {
         useWindowMessageDebuggerClient(false),
         projectDataOnlyExport(false),
         fullLoadingScreen(false),
+        layoutByLayoutExport(false),
+        incrementalResourcesCopy(false),
         nonRuntimeScriptsCacheBurst(0){};
 
   /**
@@ -105,6 +110,31 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the project data should be exported layout by layout
+   * (false by default), without copying the project. This bounds the memory
+   * used by the export of very large projects to the size of the largest
+   * layout.
+   *
+   * \note Projects with events or objects referencing files directly (see
+   * gd::ProjectResourcesCopier::HasFilesOutsideOfResources) are still copied.
+   */
+  PreviewExportOptions &SetLayoutByLayoutExport(bool enable) {
+    layoutByLayoutExport = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the resources should be copied incrementally (false by
+   * default): only the resources copied by the previous preview are kept in
+   * the export directory, and the ones unchanged since then are not copied
+   * again (see gd::ProjectResourcesCopier).
+   */
+  PreviewExportOptions &SetIncrementalResourcesCopy(bool enable) {
+    incrementalResourcesCopy = enable;
+    return *this;
+  }
+
   /**
    * \brief If set to a non zero value, the exported script URLs will have an
    * extra search parameter added (with the given value) to ensure browser cache
@@ -125,6 +155,8 @@ struct PreviewExportOptions {
   std::map<gd::String, int> includeFileHashes;
   bool projectDataOnlyExport;
   bool fullLoadingScreen;
+  bool layoutByLayoutExport;
+  bool incrementalResourcesCopy;
   unsigned int nonRuntimeScriptsCacheBurst;
 };
 
@@ -151,14 +183,69 @@ class ExporterHelper {
    * \param project The project to be exported.
    * \param filename The filename where export the project
    * \param runtimeGameOptions The content of the extra configuration to store
-   * in gdjs.runtimeGameOptions \return Empty string if everthing is ok,
-   * description of the error otherwise.
+   * in gdjs.runtimeGameOptions
+   * \param scenesResources If not null, the names of the resources used by
+   * each scene (see gd::SceneResourcesFinder), exported in each layout as
+   * "usedResources".
+   * \return Empty string if everthing is ok, description of the error
+   * otherwise.
    */
   static gd::String ExportProjectData(
       gd::AbstractFileSystem &fs,
       const gd::Project &project,
       gd::String filename,
-      const gd::SerializerElement &runtimeGameOptions);
+      const gd::SerializerElement &runtimeGameOptions,
+      const std::map<gd::String, std::set<gd::String>> *scenesResources =
+          nullptr);
+
+  /**
+   * \brief Export a project to JSON, layout by layout, stripping it for
+   * export at the same time (see gd::ProjectStripper).
+   *
+   * The project is neither copied nor entirely serialized in memory: each
+   * layout is serialized and appended to the file one after the other.
+   *
+   * \param fs The abstract file system to use to write the file
+   * \param project The project to be exported. It's not modified.
+   * \param resourcesManager The resources to export instead of the ones of the
+   * project (usually, a copy with the filenames updated by ExportResources).
+   * \param loadingScreen The loading screen to export instead of the one of
+   * the project.
+   * \param firstLayout The name of the layout to be launched first.
+   * \param filename The filename where export the project
+   * \param runtimeGameOptions The content of the extra configuration to store
+   * in gdjs.runtimeGameOptions
+   * \param scenesResources If not null, the names of the resources used by
+   * each scene, exported in each layout as "usedResources".
+   * \return Empty string if everything is ok, description of the error
+   * otherwise.
+   */
+  static gd::String ExportProjectDataLayoutByLayout(
+      gd::AbstractFileSystem &fs,
+      const gd::Project &project,
+      const gd::ResourcesManager &resourcesManager,
+      const gd::LoadingScreen &loadingScreen,
+      const gd::String &firstLayout,
+      gd::String filename,
+      const gd::SerializerElement &runtimeGameOptions,
+      const std::map<gd::String, std::set<gd::String>> *scenesResources =
+          nullptr);
+
+  /**
+   * \brief Export the texture atlases created by a gd::TextureAtlasPacker, so
+   * that the game finds the images packed in them.
+   *
+   * \param fs The abstract file system to use to write the file
+   * \param textureAtlasPacker The packer, after images were packed.
+   * \param filename The filename where export the atlases, to be included
+   * after the project data.
+   * \return Empty string if everything is ok, description of the error
+   * otherwise.
+   */
+  static gd::String ExportTextureAtlases(
+      gd::AbstractFileSystem &fs,
+      const gd::TextureAtlasPacker &textureAtlasPacker,
+      gd::String filename);
 
   /**
    * \brief Copy all the resources of the project to to the export directory,
@@ -167,12 +254,32 @@ class ExporterHelper {
    * \param fs The abstract file system to use
    * \param project The project with resources to be exported.
    * \param exportDir The directory where the preview must be created.
-   * \param progressDlg Optional wxProgressDialog which will be updated with the
-   * progress.
+   * \param incrementalCopy If true, resources unchanged since the previous
+   * export to the same directory are not copied again.
    */
   static void ExportResources(gd::AbstractFileSystem &fs,
                               gd::Project &project,
-                              gd::String exportDir);
+                              gd::String exportDir,
+                              bool incrementalCopy = false);
+
+  /**
+   * \brief Copy all the resources of the project to to the export directory,
+   * updating the filenames of the given resources manager instead of the ones
+   * of the project.
+   *
+   * \param fs The abstract file system to use
+   * \param project The project with resources to be exported.
+   * \param resourcesManager A copy of the resources of the project, to be
+   * updated with the exported filenames.
+   * \param exportDir The directory where the preview must be created.
+   * \param incrementalCopy If true, resources unchanged since the previous
+   * export to the same directory are not copied again.
+   */
+  static void ExportResources(gd::AbstractFileSystem &fs,
+                              const gd::Project &project,
+                              gd::ResourcesManager &resourcesManager,
+                              gd::String exportDir,
+                              bool incrementalCopy = false);
 
   /**
    * \brief Add libraries files to the list of includes.
@@ -211,11 +318,31 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   * \param eventsCodeReport If not null, will be filled with a report of the
+   * generated code for each event (size, nesting depth, objects lists copies
+   * and instances loops) of the scenes, external events and events functions.
+   * Events are identified by their position in the flattened events list (see
+   * gd::EventsPositionFinder).
    */
   bool ExportEventsCode(gd::Project &project,
                         gd::String outputDir,
                         std::vector<gd::String> &includesFiles,
-                        bool exportForPreview);
+                        bool exportForPreview,
+                        gd::SerializerElement *eventsCodeReport = nullptr);
+
+  /**
+   * \brief Add to the report of the generated code the external events and
+   * the events functions (which are not generated by ExportEventsCode).
+   *
+   * \param deadEventsProjectFacts If not null, the facts about the project
+   * used to remove the events that can never run, collected once for the
+   * export.
+   */
+  void ExportEventsCodeReportForNonLayoutEvents(
+      gd::Project &project,
+      bool exportForPreview,
+      gd::SerializerElement &eventsCodeReport,
+      const gd::DeadEventsProjectFacts *deadEventsProjectFacts = nullptr);
 
   /**
    * \brief Add the project effects include files.
@@ -296,9 +423,12 @@ class ExporterHelper {
    * directory.
    *
    * \param project The project to be used to generate the configuration file.
+   * \param resourcesManager The resources of the project, with their exported
+   * filenames.
    * \param exportDir The directory where the config.xml must be created.
    */
   bool ExportCordovaFiles(const gd::Project &project,
+                          const gd::ResourcesManager &resourcesManager,
                           gd::String exportDir,
                           std::set<gd::String> usedExtensions);
 
@@ -307,9 +437,12 @@ class ExporterHelper {
    * directory.
    *
    * \param project The project to be used to generate the files.
+   * \param resourcesManager The resources of the project, with their exported
+   * filenames.
    * \param exportDir The directory where the files must be created.
    */
   bool ExportElectronFiles(const gd::Project &project,
+                           const gd::ResourcesManager &resourcesManager,
                            gd::String exportDir,
                            std::set<gd::String> usedExtensions);
 
@@ -57,11 +57,30 @@ namespace gdjs {
      */
     _loadedTextures: Hashtable<PIXI.Texture<PIXI.Resource>>;
 
+    /**
+     * Map associating the name of an image packed in a texture atlas to the
+     * atlas and its position in it.
+     */
+    _atlasRegions: Hashtable<{
+      atlas: ImageAtlasData;
+      region: ImageAtlasRegionData;
+    }>;
+
     /**
      * @param resources The resources data of the game.
+     * @param atlases The texture atlases of the game, if images were packed
+     * when the game was exported.
      */
-    constructor(resources: ResourceData[]) {
+    constructor(resources: ResourceData[], atlases?: ImageAtlasData[]) {
       this._resources = resources;
+      this._atlasRegions = new Hashtable();
+      if (atlases) {
+        for (const atlas of atlases) {
+          for (const region of atlas.regions) {
+            this._atlasRegions.put(region.name, { atlas, region });
+          }
+        }
+      }
       this._invalidTexture = PIXI.Texture.from(
         'data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAAgAAAAICAYAAADED76LAAAAFElEQVQoU2P8z/D/PwMewDgyFAAApMMX8Zi0uXAAAAAASUVORK5CYIIA'
       );
@@ -100,6 +119,20 @@ namespace gdjs {
         return this._invalidTexture;
       }
 
+      // The image was packed in an atlas: use its part of the atlas texture.
+      if (this._atlasRegions.containsKey(resourceName)) {
+        const { atlas, region } = this._atlasRegions.get(resourceName);
+        const atlasTexture = this.getPIXITexture(atlas.image);
+        if (atlasTexture === this._invalidTexture) return atlasTexture;
+
+        const texture = new PIXI.Texture(
+          atlasTexture.baseTexture,
+          new PIXI.Rectangle(region.x, region.y, region.width, region.height)
+        );
+        this._loadedTextures.put(resourceName, texture);
+        return texture;
+      }
+
       // Texture is not loaded, load it now from the resources list.
       const resource = findResourceWithNameAndKind(
         this._resources,
@@ -87,7 +87,8 @@ namespace gdjs {
       this._variables = new gdjs.VariablesContainer(data.variables);
       this._data = data;
       this._imageManager = new gdjs.ImageManager(
-        this._data.resources.resources
+        this._data.resources.resources,
+        this._data.resources.atlases
       );
       this._soundManager = new gdjs.SoundManager(
         this._data.resources.resources
@@ -82,6 +82,15 @@ declare interface LayoutData {
   objects: ObjectData[];
   layers: LayerData[];
   behaviorsSharedData: BehaviorSharedData[];
+  /**
+   * The resources used by the scene, including the ones of global objects.
+   * Only set for exported games, to load the resources scene by scene.
+   */
+  usedResources?: ResourceReference[];
+}
+
+declare interface ResourceReference {
+  name: string;
 }
 
 declare interface BehaviorSharedData {
@@ -207,6 +216,27 @@ declare interface LoadingScreenData {
 
 declare interface ResourcesData {
   resources: ResourceData[];
+  /** The texture atlases, if images were packed when the game was exported. */
+  atlases?: ImageAtlasData[];
+}
+
+/** A texture atlas: an image made of several images. */
+declare interface ImageAtlasData {
+  /** The name of the image resource of the atlas. */
+  image: string;
+  width: number;
+  height: number;
+  regions: ImageAtlasRegionData[];
+}
+
+/** The position of a packed image in a texture atlas. */
+declare interface ImageAtlasRegionData {
+  /** The name of the packed image resource. */
+  name: string;
+  x: number;
+  y: number;
+  width: number;
+  height: number;
 }
 
 declare interface ResourceData {
@@ -23,6 +23,7 @@
 #include <GDCore/IDE/Dialogs/LayoutEditorCanvas/EditorSettings.h>
 #include <GDCore/IDE/Events/ArbitraryEventsWorker.h>
 #include <GDCore/IDE/Events/EventsContextAnalyzer.h>
+#include <GDCore/IDE/Events/EventsExpressionsValidator.h>
 #include <GDCore/IDE/Events/EventsListUnfolder.h>
 #include <GDCore/IDE/Events/EventsParametersLister.h>
 #include <GDCore/IDE/Events/EventsPositionFinder.h>
@@ -30,7 +31,9 @@
 #include <GDCore/IDE/Events/EventsRemover.h>
 #include <GDCore/IDE/Events/EventsTypesLister.h>
 #include <GDCore/IDE/Events/ExpressionCompletionFinder.h>
+#include <GDCore/IDE/Events/ExpressionCompletionIndex.h>
 #include <GDCore/IDE/Events/ExpressionValidator.h>
+#include <GDCore/IDE/Events/FlattenedEventsTree.h>
 #include <GDCore/IDE/Events/InstructionSentenceFormatter.h>
 #include <GDCore/IDE/Events/InstructionsTypeRenamer.h>
 #include <GDCore/IDE/Events/TextFormatting.h>
@@ -46,6 +49,7 @@
 #include <GDCore/IDE/WholeProjectRefactorer.h>
 #include <GDCore/IDE/UnfilledRequiredBehaviorPropertyProblem.h>
 #include <GDCore/Project/Behavior.h>
+#include <GDCore/Project/CustomBehavior.h>
 #include <GDCore/Project/Effect.h>
 #include <GDCore/Project/EventsBasedBehavior.h>
 #include <GDCore/Project/EventsFunction.h>
@@ -57,6 +61,7 @@
 #include <GDCore/Project/Layout.h>
 #include <GDCore/Project/NamedPropertyDescriptor.h>
 #include <GDCore/Project/Object.h>
+#include <GDCore/Project/PackedInitialInstances.h>
 #include <GDCore/Project/Project.h>
 #include <GDCore/Project/PropertyDescriptor.h>
 #include <GDCore/Project/Variable.h>
@@ -268,6 +273,30 @@ class AbstractFileSystemJS : public AbstractFileSystem {
         directory.c_str());
   }
 
+  virtual bool ClearDirExcept(const gd::String &directory,
+                              const std::vector<gd::String> &filesToKeep) {
+    // clearDirExcept is optional: fallback to clearing the whole directory
+    // (the kept files are then copied again).
+    gd::String files;
+    for (auto &file : filesToKeep) files += file + "\n";
+
+    int result = EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('clearDirExcept')) return -1;
+          var files = UTF8ToString($2).split('\n');
+          files.pop();
+          return self.clearDirExcept(UTF8ToString($1), files) ? 1 : 0;
+        },
+        (int)this,
+        directory.c_str(),
+        files.c_str());
+    if (result == -1)
+      return AbstractFileSystem::ClearDirExcept(directory, filesToKeep);
+
+    return result == 1;
+  }
+
   virtual bool WriteToFile(const gd::String &file, const gd::String &content) {
     return (bool)EM_ASM_INT(
         {
@@ -281,6 +310,126 @@ class AbstractFileSystemJS : public AbstractFileSystem {
         content.c_str());
   }
 
+  virtual bool AppendToFile(const gd::String &file, const gd::String &content) {
+    // appendToFile is optional: fallback to rewriting the whole file if the JS
+    // implementation does not provide it.
+    int result = EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('appendToFile')) return -1;
+          return self.appendToFile(UTF8ToString($1), UTF8ToString($2)) ? 1 : 0;
+        },
+        (int)this,
+        file.c_str(),
+        content.c_str());
+    if (result == -1) return AbstractFileSystem::AppendToFile(file, content);
+
+    return result == 1;
+  }
+
+  virtual bool GetFileStats(const gd::String &file,
+                            double &size,
+                            double &modificationTime) {
+    // getFileStats is optional: files are then always copied.
+    return EM_ASM_INT(
+               {
+                 var self =
+                     Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+                 if (!self.hasOwnProperty('getFileStats')) return 0;
+                 var stats = self.getFileStats(UTF8ToString($1));
+                 if (!stats) return 0;
+                 HEAPF64[$2 >> 3] = stats.size;
+                 HEAPF64[$3 >> 3] = stats.modificationTime;
+                 return 1;
+               },
+               (int)this,
+               file.c_str(),
+               &size,
+               &modificationTime) == 1;
+  }
+
+  virtual gd::String GetFileHash(const gd::String &file) {
+    // getFileHash is optional: files with the same content are then not
+    // detected.
+    return (const char *)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('getFileHash')) return ensureString('');
+          return ensureString(self.getFileHash(UTF8ToString($1)));
+        },
+        (int)this,
+        file.c_str());
+  }
+
+  virtual bool GetImageSize(const gd::String &file,
+                            unsigned int &width,
+                            unsigned int &height) {
+    // getImageSize is optional: images are then not packed in atlases.
+    return EM_ASM_INT(
+               {
+                 var self =
+                     Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+                 if (!self.hasOwnProperty('getImageSize')) return 0;
+                 var size = self.getImageSize(UTF8ToString($1));
+                 if (!size) return 0;
+                 HEAPU32[$2 >> 2] = size.width;
+                 HEAPU32[$3 >> 2] = size.height;
+                 return 1;
+               },
+               (int)this,
+               file.c_str(),
+               &width,
+               &height) == 1;
+  }
+
+  virtual bool WriteAtlasImage(const gd::String &file,
+                               unsigned int width,
+                               unsigned int height,
+                               const std::vector<ImagePlacement> &images) {
+    // The images are passed as JSON, as there is no binding for them.
+    gd::SerializerElement imagesElement;
+    imagesElement.ConsiderAsArrayOf("image");
+    for (auto &image : images) {
+      gd::SerializerElement &imageElement = imagesElement.AddChild("image");
+      imageElement.SetAttribute("file", image.file);
+      imageElement.SetAttribute("x", (int)image.x);
+      imageElement.SetAttribute("y", (int)image.y);
+    }
+    gd::String imagesJson = gd::Serializer::ToJSON(imagesElement);
+
+    // writeAtlasImage is optional: images are then not packed in atlases.
+    return EM_ASM_INT(
+               {
+                 var self =
+                     Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+                 if (!self.hasOwnProperty('writeAtlasImage')) return 0;
+                 return self.writeAtlasImage(UTF8ToString($1),
+                                             $2,
+                                             $3,
+                                             JSON.parse(UTF8ToString($4)))
+                            ? 1
+                            : 0;
+               },
+               (int)this,
+               file.c_str(),
+               width,
+               height,
+               imagesJson.c_str()) == 1;
+  }
+
+  virtual bool RemoveFile(const gd::String &file) {
+    // removeFile is optional: images packed in atlases are then kept.
+    return EM_ASM_INT(
+               {
+                 var self =
+                     Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+                 if (!self.hasOwnProperty('removeFile')) return 0;
+                 return self.removeFile(UTF8ToString($1)) ? 1 : 0;
+               },
+               (int)this,
+               file.c_str()) == 1;
+  }
+
   virtual gd::String ReadFile(const gd::String &file) {
     return (const char *)EM_ASM_INT(
         {
@@ -362,6 +511,46 @@ std::vector<gd::String> toNewVectorString(const std::set<gd::String> &set) {
   return output;
 }
 
+// Expose the address of packed data, so that it can be read from JavaScript
+// with typed arrays on the memory of the module, without a call for each value
+// (see postjs.js).
+gd::PackedStrings toPackedStrings(const std::vector<gd::String> &vec) {
+  return gd::PackedStrings(vec);
+}
+
+std::size_t GetPackedStringsDataAddress(const gd::PackedStrings &strings) {
+  return reinterpret_cast<std::size_t>(strings.GetData().data());
+}
+
+std::size_t GetPackedStringsOffsetsAddress(const gd::PackedStrings &strings) {
+  return reinterpret_cast<std::size_t>(strings.GetOffsets().data());
+}
+
+std::size_t GetPackedInstancesPositionsAddress(
+    const gd::PackedInitialInstances &instances) {
+  return reinterpret_cast<std::size_t>(instances.GetPositions().data());
+}
+
+std::size_t GetPackedInstancesAnglesAddress(
+    const gd::PackedInitialInstances &instances) {
+  return reinterpret_cast<std::size_t>(instances.GetAngles().data());
+}
+
+std::size_t GetPackedInstancesZOrdersAddress(
+    const gd::PackedInitialInstances &instances) {
+  return reinterpret_cast<std::size_t>(instances.GetZOrders().data());
+}
+
+std::size_t GetPackedInstancesLayersAddress(
+    const gd::PackedInitialInstances &instances) {
+  return reinterpret_cast<std::size_t>(instances.GetLayers().data());
+}
+
+std::size_t GetPackedInstancesObjectsAddress(
+    const gd::PackedInitialInstances &instances) {
+  return reinterpret_cast<std::size_t>(instances.GetObjects().data());
+}
+
 // Declares typedef for std::vector and templatized types
 typedef std::vector<gd::String> VectorString;
 typedef std::vector<std::shared_ptr<gd::PlatformExtension>>
@@ -407,6 +596,9 @@ typedef ExpressionCompletionDescription::CompletionKind
     ExpressionCompletionDescription_CompletionKind;
 typedef std::vector<gd::ExpressionCompletionDescription>
     VectorExpressionCompletionDescription;
+typedef std::vector<gd::ExpressionCompletion> VectorExpressionCompletion;
+typedef std::vector<gd::EventsExpressionDiagnostic>
+    VectorEventsExpressionDiagnostic;
 typedef std::map<gd::String, std::map<gd::String, gd::PropertyDescriptor>>
     MapExtensionProperties;
 typedef gd::Variable::Type Variable_Type;
@@ -151,14 +151,64 @@ var adaptNamingConventions = function (gd) {
 
   //Convenience methods:
   gd.VectorString.prototype.toJSArray = function () {
-    var arr = [];
-    var size = this.size();
-    for (var i = 0; i < size; ++i) {
-      arr.push(this.at(i));
+    // Strings are packed in a single buffer, to avoid a call for each string.
+    return this.toPackedStrings().toJSArray();
+  };
+
+  // Read packed data directly from the memory of the module. Typed arrays are
+  // created at each call because they are invalidated if the memory grows:
+  // they must be copied if they are kept after calling another method.
+  gd.PackedStrings.prototype.toJSArray = function () {
+    var count = this.getCount();
+    var offsets = new Uint32Array(
+      HEAPU8.buffer,
+      this.getPackedStringsOffsetsAddress(),
+      count
+    );
+    var dataAddress = this.getPackedStringsDataAddress();
+    var arr = new Array(count);
+    for (var i = 0; i < count; ++i) {
+      arr[i] = UTF8ToString(dataAddress + offsets[i]);
     }
     return arr;
   };
 
+  gd.PackedInitialInstances.prototype.getPositionsArray = function () {
+    return new Float64Array(
+      HEAPU8.buffer,
+      this.getPackedInstancesPositionsAddress(),
+      this.getInstancesCount() * 2
+    );
+  };
+  gd.PackedInitialInstances.prototype.getAnglesArray = function () {
+    return new Float64Array(
+      HEAPU8.buffer,
+      this.getPackedInstancesAnglesAddress(),
+      this.getInstancesCount()
+    );
+  };
+  gd.PackedInitialInstances.prototype.getZOrdersArray = function () {
+    return new Int32Array(
+      HEAPU8.buffer,
+      this.getPackedInstancesZOrdersAddress(),
+      this.getInstancesCount()
+    );
+  };
+  gd.PackedInitialInstances.prototype.getLayersArray = function () {
+    return new Uint32Array(
+      HEAPU8.buffer,
+      this.getPackedInstancesLayersAddress(),
+      this.getInstancesCount()
+    );
+  };
+  gd.PackedInitialInstances.prototype.getObjectsArray = function () {
+    return new Uint32Array(
+      HEAPU8.buffer,
+      this.getPackedInstancesObjectsAddress(),
+      this.getInstancesCount()
+    );
+  };
+
   gd.VectorInt.prototype.toJSArray = function () {
     var arr = [];
     var size = this.size();
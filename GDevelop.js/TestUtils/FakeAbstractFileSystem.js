@@ -61,6 +61,11 @@ module.exports = {
       return true;
     });
 
+    fs.appendToFile = jest.fn();
+    fs.appendToFile.mockImplementation(function (filePath, content) {
+      return true;
+    });
+
     return fs;
   },
 };
@@ -53,6 +53,15 @@ class VariablesContainer {
 class RuntimeObject {
   constructor() {
     this._variables = new VariablesContainer();
+    this._x = 0;
+  }
+
+  getX() {
+    return this._x;
+  }
+
+  setX(x) {
+    this._x = x;
   }
 
   getVariables() {
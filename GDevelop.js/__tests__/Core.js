@@ -554,6 +554,70 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.PackedInitialInstances', function () {
+    it('gives the properties of all instances in typed arrays', function () {
+      const container = new gd.InitialInstancesContainer();
+      const instance1 = container.insertNewInitialInstance();
+      instance1.setObjectName('Player');
+      instance1.setX(10);
+      instance1.setY(20.5);
+      instance1.setZOrder(3);
+      const instance2 = container.insertNewInitialInstance();
+      instance2.setObjectName('Enemy');
+      instance2.setLayer('Foreground');
+      instance2.setX(-5);
+      instance2.setAngle(45);
+
+      const packedInstances = new gd.PackedInitialInstances();
+      packedInstances.pack(container);
+      expect(packedInstances.getInstancesCount()).toBe(2);
+      expect(Array.from(packedInstances.getPositionsArray())).toEqual([
+        10,
+        20.5,
+        -5,
+        0,
+      ]);
+      expect(Array.from(packedInstances.getAnglesArray())).toEqual([0, 45]);
+      expect(Array.from(packedInstances.getZOrdersArray())).toEqual([3, 0]);
+      expect(Array.from(packedInstances.getLayersArray())).toEqual([0, 1]);
+      expect(packedInstances.getLayerNames().toJSArray()).toEqual([
+        '',
+        'Foreground',
+      ]);
+      expect(Array.from(packedInstances.getObjectsArray())).toEqual([0, 1]);
+      expect(packedInstances.getObjectNames().toJSArray()).toEqual([
+        'Player',
+        'Enemy',
+      ]);
+
+      packedInstances.delete();
+      container.delete();
+    });
+  });
+
+  describe('gd.PackedStrings', function () {
+    it('can be read at once', function () {
+      const strings = new gd.PackedStrings();
+      strings.add('Hello');
+      strings.add('');
+      strings.add('Ελληνικά');
+      expect(strings.getCount()).toBe(3);
+      expect(strings.get(2)).toBe('Ελληνικά');
+      expect(strings.toJSArray()).toEqual(['Hello', '', 'Ελληνικά']);
+      strings.delete();
+    });
+
+    it('is used to convert a gd.VectorString to an array', function () {
+      const vector = new gd.VectorString();
+      vector.push_back('First');
+      vector.push_back('Ελληνικά');
+      expect(vector.toJSArray()).toEqual(['First', 'Ελληνικά']);
+      vector.clear();
+      expect(vector.toJSArray()).toEqual([]);
+      vector.delete();
+    });
+  });
+
   describe('gd.InitialInstance', function () {
     let project = null;
     let layout = null;
@@ -1560,6 +1624,47 @@ describe('libGD.js', function () {
     });
   });
 
+  describe('gd.CustomBehavior', function () {
+    it('has the properties of an events based behavior', function () {
+      const eventsBasedBehavior = new gd.EventsBasedBehavior();
+      eventsBasedBehavior
+        .getPropertyDescriptors()
+        .insertNew('Speed', 0)
+        .setType('Number')
+        .setValue('200');
+      eventsBasedBehavior
+        .getPropertyDescriptors()
+        .insertNew('Enabled', 1)
+        .setType('Boolean')
+        .setValue('true');
+
+      const behavior = new gd.CustomBehavior(eventsBasedBehavior);
+      eventsBasedBehavior.delete();
+
+      const behaviorContent = new gd.BehaviorContent(
+        'Movement',
+        'MyExtension::Movement'
+      );
+      behavior.initializeContent(behaviorContent.getContent());
+      let properties = behaviorContent.getProperties(behavior);
+      expect(properties.keys().toJSArray()).toEqual(['Enabled', 'Speed']);
+      expect(properties.get('Speed').getValue()).toBe('200');
+      expect(properties.get('Enabled').getValue()).toBe('true');
+
+      expect(behaviorContent.updateProperty(behavior, 'Speed', '42')).toBe(
+        true
+      );
+      expect(behaviorContent.updateProperty(behavior, 'Unknown', '1')).toBe(
+        false
+      );
+      properties = behaviorContent.getProperties(behavior);
+      expect(properties.get('Speed').getValue()).toBe('42');
+
+      behaviorContent.delete();
+      behavior.delete();
+    });
+  });
+
   describe('gd.Object', function () {
     let project = null;
     let layout = null;
@@ -2496,6 +2601,44 @@ describe('libGD.js', function () {
         events.delete();
       });
     });
+
+    describe('gd.FlattenedEventsTree', function () {
+      it('can find events by their position and fold them', function () {
+        // evt0
+        // └── evt00
+        //     └── evt000
+        // evt1
+        const events = new gd.EventsList();
+        const evt0 = events.insertEvent(new gd.StandardEvent(), 0);
+        const evt1 = events.insertEvent(new gd.StandardEvent(), 1);
+        const evt00 = evt0
+          .getSubEvents()
+          .insertEvent(new gd.StandardEvent(), 0);
+        const evt000 = evt00
+          .getSubEvents()
+          .insertEvent(new gd.StandardEvent(), 0);
+
+        const tree = new gd.FlattenedEventsTree(events);
+        expect(tree.getEventsCount()).toBe(4);
+        expect(tree.getPositionOf(evt1)).toBe(3);
+        expect(tree.getDepthAt(2)).toBe(2);
+        expect(tree.getSubtreeSizeAt(0)).toBe(3);
+        expect(tree.getEventAt(2).ptr).toBe(evt000.ptr);
+
+        tree.setFolded(evt00, true);
+        expect(evt00.isFolded()).toBe(true);
+        expect(tree.getVisibleEventsCount()).toBe(3);
+        expect(tree.getPositionOfVisibleEvent(2)).toBe(3);
+        expect(tree.getVisibleIndexAt(2)).toBe(-1);
+
+        tree.removeEvent(events, 0);
+        expect(tree.getEventsCount()).toBe(1);
+        expect(tree.getPositionOf(evt1)).toBe(0);
+
+        tree.delete();
+        events.delete();
+      });
+    });
   });
 
   describe('gd.GroupEvent', function () {
@@ -3385,6 +3528,50 @@ describe('libGD.js', function () {
     it('can parse arguments being expressions', function () {
       testExpression('number', 'MouseX(VariableString(myVariable), 0) + 1');
     });
+
+    it('can update the tree of an edited expression', function () {
+      const parser = new gd.ExpressionParser2(
+        gd.JsPlatform.get(),
+        project,
+        layout
+      );
+      const getErrorsCount = (expressionNode) => {
+        const expressionValidator = new gd.ExpressionValidator();
+        expressionNode.visit(expressionValidator);
+        const errorsCount = expressionValidator.getErrors().size();
+        expressionValidator.delete();
+        return errorsCount;
+      };
+
+      const node = parser.parseExpression('number', 'abs(12) + 1');
+      expect(getErrorsCount(node.get())).toBe(0);
+
+      // Replace "12" by "345": only the parameter is parsed again.
+      const updatedNode = parser.parseExpressionIncrementally(
+        'number',
+        node,
+        'abs(12) + 1',
+        4,
+        2,
+        '345'
+      );
+      expect(getErrorsCount(updatedNode)).toBe(0);
+      expect(getErrorsCount(node.get())).toBe(0);
+
+      // Replace "345" by a string, which is not valid in a number parameter.
+      const erroneousNode = parser.parseExpressionIncrementally(
+        'number',
+        node,
+        'abs(345) + 1',
+        4,
+        3,
+        '"Hello"'
+      );
+      expect(getErrorsCount(erroneousNode)).toBe(1);
+      expect(getErrorsCount(node.get())).toBe(1);
+
+      parser.delete();
+    });
   });
 
   describe('gd.ExpressionCompletionFinder', function () {
@@ -3542,6 +3729,136 @@ describe('libGD.js', function () {
     // More tests are done in C++ for ExpressionCompletionFinder.
   });
 
+  describe('gd.ExpressionCompletionIndex', function () {
+    let project = null;
+    let layout = null;
+    let completionIndex = null;
+    beforeAll(() => {
+      project = new gd.ProjectHelper.createNewGDJSProject();
+      layout = project.insertNewLayout('Scene', 0);
+      layout.insertNewObject(project, 'Sprite', 'MySpriteObject', 0);
+      layout.getVariables().insertNew('MySceneVariable', 0);
+
+      completionIndex = new gd.ExpressionCompletionIndex();
+      completionIndex.indexPlatform(gd.JsPlatform.get());
+      completionIndex.indexObjects(project, layout);
+      completionIndex.indexVariables(
+        project.getVariables(),
+        layout.getVariables()
+      );
+    });
+    afterAll(() => {
+      completionIndex.delete();
+    });
+
+    function getCompletions(type, expression, maxCount) {
+      const parser = new gd.ExpressionParser2(
+        gd.JsPlatform.get(),
+        project,
+        layout
+      );
+      const expressionNode = parser.parseExpression(type, expression).get();
+      const completionDescriptions =
+        gd.ExpressionCompletionFinder.getCompletionDescriptionsFor(
+          expressionNode,
+          expression.length - 1
+        );
+
+      const completions = [];
+      for (let i = 0; i < completionDescriptions.size(); i++) {
+        const vectorCompletions = completionIndex.getCompletions(
+          completionDescriptions.at(i),
+          maxCount
+        );
+        for (let j = 0; j < vectorCompletions.size(); j++) {
+          const completion = vectorCompletions.at(j);
+          completions.push({
+            kind: completion.getCompletionKind(),
+            completion: completion.getCompletion(),
+            expressionMetadata: completion.hasExpressionMetadata()
+              ? completion.getExpressionMetadata()
+              : null,
+          });
+        }
+        vectorCompletions.delete();
+      }
+      parser.delete();
+      return completions;
+    }
+
+    it('gives completions for objects and variables', function () {
+      const completions = getCompletions('number', 'MySp', 10);
+      expect(completions[0]).toEqual({
+        kind: gd.ExpressionCompletionDescription.Object,
+        completion: 'MySpriteObject',
+        expressionMetadata: null,
+      });
+
+      expect(
+        getCompletions('number', 'Variable(MySc', 10).map(
+          ({ completion }) => completion
+        )
+      ).toEqual(['MySceneVariable']);
+    });
+
+    it('gives ranked completions for object expressions', function () {
+      const completions = getCompletions('number', 'MySpriteObject.Ang', 3);
+      expect(completions.length).toBeLessThanOrEqual(3);
+      expect(completions[0].kind).toBe(
+        gd.ExpressionCompletionDescription.Expression
+      );
+      expect(completions[0].completion).toBe('Angle');
+      expect(completions[0].expressionMetadata.getFullName()).not.toBe('');
+    });
+
+    // More tests are done in C++ for ExpressionCompletionIndex.
+  });
+
+  describe('gd.EventsExpressionsValidator', function () {
+    it('validates all the expressions of events', function () {
+      const project = new gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      const events = layout.getEvents();
+      const event = events.insertNewEvent(
+        project,
+        'BuiltinCommonInstructions::Standard',
+        0
+      );
+      const subEvent = event
+        .getSubEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+      const action = new gd.Instruction();
+      action.setType('ModVarScene');
+      action.setParametersCount(3);
+      action.setParameter(0, 'MyVariable');
+      action.setParameter(1, '=');
+      action.setParameter(2, '1 +');
+      gd.asStandardEvent(subEvent).getActions().insert(action, 0);
+      action.setParameter(2, '1 + 2');
+      gd.asStandardEvent(subEvent).getActions().insert(action, 0);
+      action.delete();
+
+      const validator = new gd.EventsExpressionsValidator(gd.JsPlatform.get());
+      validator.launch(events, project, layout);
+      const diagnostics = validator.getDiagnostics();
+      expect(diagnostics.size()).toBe(1);
+
+      const diagnostic = diagnostics.at(0);
+      const eventPath = diagnostic.getEventPath();
+      expect(eventPath.size()).toBe(2);
+      expect(eventPath.at(0)).toBe(0);
+      expect(eventPath.at(1)).toBe(0);
+      expect(diagnostic.getInstruction().getParameter(2)).toBe('1 +');
+      expect(diagnostic.isCondition()).toBe(false);
+      expect(diagnostic.getParameterIndex()).toBe(2);
+      expect(diagnostic.getMessage()).not.toBe('');
+      validator.delete();
+      project.delete();
+    });
+
+    // More tests are done in C++ for EventsExpressionsValidator.
+  });
+
   describe('gd.Vector2f', function () {
     describe('gd.VectorVector2f', function () {
       it('can be used to manipulate a vector of gd.Vector2f', function () {
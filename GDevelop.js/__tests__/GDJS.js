@@ -156,6 +156,77 @@ describe('libGD.js - GDJS related tests', function () {
 }`
       );
     });
+    it('exports the same project data when exporting layout by layout', () => {
+      // Create a project with some layouts, objects and events.
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      project.setName('My great project');
+      for (let i = 0; i < 3; i++) {
+        const layout = project.insertNewLayout('Scene ' + i, i);
+        layout.insertNewObject(project, 'Sprite', 'MySprite', 0);
+        layout
+          .getInitialInstances()
+          .insertNewInitialInstance()
+          .setObjectName('MySprite');
+        layout
+          .getEvents()
+          .insertNewEvent(project, 'BuiltinCommonInstructions::Standard', 0);
+        layout.getObjectGroups().insertNew('MyGroup', 0);
+      }
+      project.setFirstLayout('Scene 1');
+
+      const exportProjectData = (exportLayoutByLayout) => {
+        const fs = makeFakeAbstractFileSystem(gd, {
+          '/fake-gdjs-root/Runtime/index.html': fakeIndexHtmlContent,
+        });
+
+        const exporter = new gd.Exporter(fs, '/fake-gdjs-root');
+        const exportOptions = new gd.MapStringBoolean();
+        exportOptions.set('exportLayoutByLayout', exportLayoutByLayout);
+        expect(
+          exporter.exportWholePixiProject(
+            project,
+            '/fake-export-dir',
+            exportOptions
+          )
+        ).toBe(true);
+        exportOptions.delete();
+        exporter.delete();
+
+        // Concatenate all the chunks written to data.js.
+        const isDataFile = ([filePath]) => filePath.endsWith('/data.js');
+        const content = [
+          ...fs.writeToFile.mock.calls.filter(isDataFile),
+          ...fs.appendToFile.mock.calls.filter(isDataFile),
+        ]
+          .map(([filePath, content]) => content)
+          .join('');
+
+        const prefix = 'gdjs.projectData = ';
+        expect(content.startsWith(prefix)).toBe(true);
+        return JSON.parse(
+          content.substring(
+            prefix.length,
+            content.indexOf(';\ngdjs.runtimeGameOptions = ')
+          )
+        );
+      };
+
+      const projectData = exportProjectData(false);
+      const projectDataExportedLayoutByLayout = exportProjectData(true);
+      expect(projectDataExportedLayoutByLayout).toEqual(projectData);
+      expect(projectDataExportedLayoutByLayout.layouts).toHaveLength(3);
+      expect(projectDataExportedLayoutByLayout.layouts[0].events).toEqual([]);
+      expect(projectDataExportedLayoutByLayout.layouts[0].objectsGroups).toEqual(
+        []
+      );
+      expect(
+        projectDataExportedLayoutByLayout.layouts[0].usedResources
+      ).toEqual([]);
+
+      // The project itself must not have been modified.
+      expect(project.getLayout('Scene 0').getEvents().getEventsCount()).toBe(1);
+      expect(project.getLayout('Scene 0').getObjectGroups().count()).toBe(1);
+    });
   });
 
   describe('LayoutCodeGenerator', () => {
@@ -187,6 +258,72 @@ describe('libGD.js - GDJS related tests', function () {
 
       condition.delete();
     });
+    it('generates a single function for events lists with the same code', function () {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+
+      // Events with sub events adding 1 to a variable, with or without
+      // a trigger once condition (which makes the code of each list unique).
+      const makeEventWithSubEvent = (conditions) => ({
+        type: 'BuiltinCommonInstructions::Standard',
+        conditions: [],
+        actions: [],
+        events: [
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions,
+            actions: [
+              {
+                type: { inverted: false, value: 'ModVarScene' },
+                parameters: ['MyVariable', '+', '1'],
+                subInstructions: [],
+              },
+            ],
+            events: [],
+          },
+        ],
+      });
+      const onceCondition = {
+        type: { inverted: false, value: 'BuiltinCommonInstructions::Once' },
+        parameters: [],
+        subInstructions: [],
+      };
+      layout
+        .getEvents()
+        .unserializeFrom(
+          project,
+          gd.Serializer.fromJSObject([
+            makeEventWithSubEvent([]),
+            makeEventWithSubEvent([]),
+            makeEventWithSubEvent([onceCondition]),
+            makeEventWithSubEvent([onceCondition]),
+          ])
+        );
+
+      const layoutCodeGenerator = new gd.LayoutCodeGenerator(project);
+      const includeFiles = new gd.SetString();
+      const code = layoutCodeGenerator.generateLayoutCompleteCode(
+        layout,
+        includeFiles,
+        true
+      );
+      layoutCodeGenerator.delete();
+      includeFiles.delete();
+
+      // The identical lists share a function, called twice. The lists with
+      // a trigger once are not merged. The last function is the whole list.
+      const functionNames = (
+        code.match(/gdjs\.SceneCode\.eventsList\d+(?= = function)/g) || []
+      ).sort();
+      const callsCounts = functionNames.map(
+        (functionName) =>
+          code.split(functionName + '(runtimeScene);').length - 1
+      );
+      expect(callsCounts).toEqual([2, 1, 1, 1]);
+      expect(code.match(/triggerOnce\(/g)).toHaveLength(2);
+
+      project.delete();
+    });
     it('does not generate code for improperly set up actions/conditions', function () {
       const project = gd.ProjectHelper.createNewGDJSProject();
       const layout = project.insertNewLayout('Scene', 0);
@@ -331,6 +331,259 @@ describe('libGD.js - GDJS Code Generation integration tests', function () {
     project.delete();
   });
 
+  it('generates a working function with nested For each events', function () {
+    const addOneToObjectVariable = (objectName, variableName) => ({
+      type: { inverted: false, value: 'ModVarObjet' },
+      parameters: [objectName, variableName, '+', '1'],
+      subInstructions: [],
+    });
+    const eventsSerializerElement = gd.Serializer.fromJSObject([
+      {
+        type: 'BuiltinCommonInstructions::ForEach',
+        object: 'MyObjectA',
+        conditions: [],
+        actions: [addOneToObjectVariable('MyObjectA', 'TestVariable')],
+        events: [
+          {
+            type: 'BuiltinCommonInstructions::ForEach',
+            object: 'MyObjectB',
+            conditions: [],
+            actions: [
+              addOneToObjectVariable('MyObjectB', 'TestVariable'),
+              addOneToObjectVariable('MyObjectA', 'NestedLoopCount'),
+            ],
+            events: [],
+          },
+        ],
+      },
+      {
+        type: 'BuiltinCommonInstructions::Standard',
+        conditions: [],
+        actions: [
+          addOneToObjectVariable('MyObjectA', 'AfterLoop'),
+          addOneToObjectVariable('MyObjectB', 'AfterLoop'),
+        ],
+        events: [],
+      },
+    ]);
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const eventsFunction = new gd.EventsFunction();
+    eventsFunction
+      .getEvents()
+      .unserializeFrom(project, eventsSerializerElement);
+
+    const objectParameter = new gd.ParameterMetadata();
+    objectParameter.setType('object');
+    objectParameter.setName('MyObjectA');
+    eventsFunction.getParameters().push_back(objectParameter);
+    objectParameter.setName('MyObjectB');
+    eventsFunction.getParameters().push_back(objectParameter);
+    objectParameter.delete();
+
+    const runCompiledEvents = generateCompiledEventsForEventsFunction(
+      gd,
+      project,
+      eventsFunction
+    );
+
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    const myObjectAs = [
+      runtimeScene.createObject('MyObjectA'),
+      runtimeScene.createObject('MyObjectA'),
+    ];
+    const myObjectBs = [
+      runtimeScene.createObject('MyObjectB'),
+      runtimeScene.createObject('MyObjectB'),
+      runtimeScene.createObject('MyObjectB'),
+    ];
+    runCompiledEvents(gdjs, runtimeScene, [
+      gdjs.Hashtable.newFrom({ MyObjectA: myObjectAs }),
+      gdjs.Hashtable.newFrom({ MyObjectB: myObjectBs }),
+    ]);
+
+    const getVariable = (object, variableName) =>
+      object.getVariables().get(variableName).getAsNumber();
+    myObjectAs.forEach((myObjectA) => {
+      // Each MyObjectA is picked once by the loop...
+      expect(getVariable(myObjectA, 'TestVariable')).toBe(1);
+      // ...and stays picked while the nested loop iterates on MyObjectB...
+      expect(getVariable(myObjectA, 'NestedLoopCount')).toBe(3);
+      // ...and all the objects are picked again after the loop.
+      expect(getVariable(myObjectA, 'AfterLoop')).toBe(1);
+    });
+    myObjectBs.forEach((myObjectB) => {
+      // The nested loop is run for each MyObjectA.
+      expect(getVariable(myObjectB, 'TestVariable')).toBe(2);
+      expect(getVariable(myObjectB, 'AfterLoop')).toBe(1);
+    });
+
+    eventsFunction.delete();
+    project.delete();
+  });
+
+  it('generates a working function with For each events on a group', function () {
+    const setObjectVariable = (objectName, variableName, operator, value) => ({
+      type: { inverted: false, value: 'ModVarObjet' },
+      parameters: [objectName, variableName, operator, value],
+      subInstructions: [],
+    });
+    const eventsSerializerElement = gd.Serializer.fromJSObject([
+      {
+        // MyObjectC is only read, so its list is declared once before the loop.
+        type: 'BuiltinCommonInstructions::ForEach',
+        object: 'MyGroup',
+        conditions: [],
+        actions: [
+          setObjectVariable('MyGroup', 'TestVariable', '+', '1'),
+          setObjectVariable('MyGroup', 'SeenX', '=', 'MyObjectC.X()'),
+        ],
+        events: [],
+      },
+      {
+        type: 'BuiltinCommonInstructions::ForEach',
+        object: 'MyGroup',
+        conditions: [],
+        actions: [],
+        events: [
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [
+              setObjectVariable('MyGroup', 'InSubEvent', '+', '1'),
+              setObjectVariable('MyObjectC', 'TestVariable', '+', '1'),
+            ],
+            events: [],
+          },
+        ],
+      },
+    ]);
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const eventsFunction = new gd.EventsFunction();
+    eventsFunction
+      .getEvents()
+      .unserializeFrom(project, eventsSerializerElement);
+
+    const objectParameter = new gd.ParameterMetadata();
+    objectParameter.setType('object');
+    ['MyObjectA', 'MyObjectB', 'MyObjectC'].forEach((objectName) => {
+      objectParameter.setName(objectName);
+      eventsFunction.getParameters().push_back(objectParameter);
+    });
+    objectParameter.delete();
+
+    const group = eventsFunction.getObjectGroups().insert('MyGroup', 0);
+    group.setName('MyGroup');
+    group.addObject('MyObjectA');
+    group.addObject('MyObjectB');
+
+    const runCompiledEvents = generateCompiledEventsForEventsFunction(
+      gd,
+      project,
+      eventsFunction
+    );
+
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    const myGroupObjects = [
+      runtimeScene.createObject('MyObjectA'),
+      runtimeScene.createObject('MyObjectA'),
+      runtimeScene.createObject('MyObjectB'),
+    ];
+    const myObjectC = runtimeScene.createObject('MyObjectC');
+    myObjectC.setX(5);
+    runCompiledEvents(gdjs, runtimeScene, [
+      gdjs.Hashtable.newFrom({ MyObjectA: myGroupObjects.slice(0, 2) }),
+      gdjs.Hashtable.newFrom({ MyObjectB: myGroupObjects.slice(2) }),
+      gdjs.Hashtable.newFrom({ MyObjectC: [myObjectC] }),
+    ]);
+
+    const getVariable = (object, variableName) =>
+      object.getVariables().get(variableName).getAsNumber();
+    myGroupObjects.forEach((object) => {
+      // Each object of the group is picked once, by each loop...
+      expect(getVariable(object, 'TestVariable')).toBe(1);
+      expect(getVariable(object, 'InSubEvent')).toBe(1);
+      // ...and the list only read by the loop is filled for every instance.
+      expect(getVariable(object, 'SeenX')).toBe(5);
+    });
+    // The sub events are run for each object of the group.
+    expect(getVariable(myObjectC, 'TestVariable')).toBe(3);
+
+    eventsFunction.delete();
+    project.delete();
+  });
+
+  it('generates a function reusing its context between calls', function () {
+    const eventsSerializerElement = gd.Serializer.fromJSObject([
+      makeAddOneToObjectTestVariableEvent('MyObjectA'),
+    ]);
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const eventsFunction = new gd.EventsFunction();
+    eventsFunction
+      .getEvents()
+      .unserializeFrom(project, eventsSerializerElement);
+
+    const objectParameter = new gd.ParameterMetadata();
+    objectParameter.setType('object');
+    objectParameter.setName('MyObjectA');
+    eventsFunction.getParameters().push_back(objectParameter);
+    objectParameter.setType('string');
+    objectParameter.setName('MyString');
+    eventsFunction.getParameters().push_back(objectParameter);
+    objectParameter.delete();
+
+    const functionNamespace = generateEventsFunctionNamespace(
+      gd,
+      project,
+      eventsFunction
+    );
+
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    const { func, eventsFunctionContextsPool } = functionNamespace(gdjs);
+    const myObjectA1 = runtimeScene.createObject('MyObjectA');
+    const myObjectA2 = runtimeScene.createObject('MyObjectA');
+
+    func(
+      runtimeScene,
+      gdjs.Hashtable.newFrom({ MyObjectA: [myObjectA1] }),
+      'Hello'
+    );
+    func(
+      runtimeScene,
+      gdjs.Hashtable.newFrom({ MyObjectA: [myObjectA2] }),
+      'Hello'
+    );
+    func(
+      runtimeScene,
+      gdjs.Hashtable.newFrom({ MyObjectA: [myObjectA2] }),
+      'Hello'
+    );
+
+    // Each call only sees the objects it was given...
+    expect(myObjectA1.getVariables().get('TestVariable').getAsNumber()).toBe(
+      1
+    );
+    expect(myObjectA2.getVariables().get('TestVariable').getAsNumber()).toBe(
+      2
+    );
+
+    // ...and a single context was created and given back after each call.
+    expect(eventsFunctionContextsPool).toHaveLength(1);
+
+    // The context in the pool keeps no reference to the objects or arguments.
+    const context = eventsFunctionContextsPool[0];
+    expect(context._runtimeScene).toBe(null);
+    expect(context._objectsMap.MyObjectA).toBe(null);
+    expect(context._objectArraysMap.MyObjectA).toHaveLength(0);
+    expect(context._objectsListsValues).toHaveLength(0);
+    expect(context._arguments.MyString).toBe(undefined);
+
+    eventsFunction.delete();
+    project.delete();
+  });
+
   it('generates working functions with groups', function () {
     // Create events that increment twice the variable of a group, and
     // only once for the 3rd parameter.
@@ -602,6 +855,132 @@ describe('libGD.js - GDJS Code Generation integration tests', function () {
     eventsFunctionCopy.delete();
     project.delete();
   });
+
+  it('generates inlined expressions giving the same results as the function calls', function () {
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+
+    // Declare the functions made with events, as the IDE would do.
+    const extension = new gd.PlatformExtension();
+    extension.setExtensionInformation('MyEventsExtension', '', '', '', '');
+    extension
+      .addExpression('Divide', '', '', '', '')
+      .addParameter('expression', 'A', '', false)
+      .addParameter('expression', 'B', '', false)
+      .getCodeExtraInformation()
+      .setFunctionName('notInlined');
+    extension
+      .addExpression('PlusOne', '', '', '', '')
+      .addParameter('expression', 'A', '', false)
+      .getCodeExtraInformation()
+      .setFunctionName('notInlined');
+    gd.JsPlatform.get().addNewExtension(extension);
+    extension.delete();
+
+    const insertNewExpressionFunction = (
+      eventsFunctionsContainer,
+      name,
+      expression,
+      parameterNames
+    ) => {
+      const eventsFunction = eventsFunctionsContainer.insertNewEventsFunction(
+        name,
+        0
+      );
+      eventsFunction.setFunctionType(gd.EventsFunction.Expression);
+      eventsFunction.getEvents().unserializeFrom(
+        project,
+        gd.Serializer.fromJSObject([
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [
+              {
+                type: { inverted: false, value: 'SetReturnNumber' },
+                parameters: [expression],
+                subInstructions: [],
+              },
+            ],
+            events: [],
+          },
+        ])
+      );
+      const parameter = new gd.ParameterMetadata();
+      parameter.setType('expression');
+      parameterNames.forEach((parameterName) => {
+        parameter.setName(parameterName);
+        eventsFunction.getParameters().push_back(parameter);
+      });
+      parameter.delete();
+      return eventsFunction;
+    };
+
+    const eventsExtension = project.insertNewEventsFunctionsExtension(
+      'MyEventsExtension',
+      0
+    );
+    const divide = insertNewExpressionFunction(
+      eventsExtension,
+      'Divide',
+      'GetArgumentAsNumber("a") / GetArgumentAsNumber("b")',
+      ['a', 'b']
+    );
+    const plusOne = insertNewExpressionFunction(
+      eventsExtension,
+      'PlusOne',
+      'GetArgumentAsNumber("a") + 1',
+      ['a']
+    );
+
+    const callersExtension = new gd.EventsFunctionsExtension();
+    const callDivide = insertNewExpressionFunction(
+      callersExtension,
+      'CallDivide',
+      'MyEventsExtension::Divide(GetArgumentAsNumber("x"), GetArgumentAsNumber("y"))',
+      ['x', 'y']
+    );
+    const callPlusOneWithNaN = insertNewExpressionFunction(
+      callersExtension,
+      'CallPlusOneWithNaN',
+      'MyEventsExtension::PlusOne(0 / 0)',
+      []
+    );
+
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    const run = (eventsFunction, args) =>
+      generateEventsFunctionNamespace(gd, project, eventsFunction)(
+        gdjs
+      ).func(runtimeScene, ...args);
+
+    // The calls are inlined...
+    const eventsFunctionsExtensionCodeGenerator =
+      new gd.EventsFunctionsExtensionCodeGenerator(project);
+    const includeFiles = new gd.SetString();
+    [callDivide, callPlusOneWithNaN].forEach((eventsFunction) => {
+      expect(
+        eventsFunctionsExtensionCodeGenerator.generateFreeEventsFunctionCompleteCode(
+          eventsFunction,
+          'functionNamespace',
+          includeFiles,
+          true
+        )
+      ).not.toContain('notInlined');
+    });
+    eventsFunctionsExtensionCodeGenerator.delete();
+    includeFiles.delete();
+
+    // ...and give the same results as calling the functions, including when
+    // the result or the arguments are not a number.
+    expect(run(divide, [0, 0])).toBe(0);
+    expect(run(callDivide, [0, 0])).toBe(0);
+    expect(run(divide, [6, 3])).toBe(2);
+    expect(run(callDivide, [6, 3])).toBe(2);
+    expect(run(plusOne, [NaN])).toBe(1);
+    expect(run(callPlusOneWithNaN, [])).toBe(1);
+
+    gd.JsPlatform.get().removeExtension('MyEventsExtension');
+    callersExtension.delete();
+    project.delete();
+  });
 });
 
 /**
@@ -649,6 +1028,33 @@ return functionNamespace.func.apply(functionNamespace.func, [runtimeScene, ...fu
   return runCompiledEventsFunction;
 }
 
+/**
+ * Generate the code from events (using GDJS platform) and create a JavaScript
+ * function returning the namespace of the generated code (so that the
+ * generated function can be called multiple times).
+ */
+function generateEventsFunctionNamespace(gd, project, eventsFunction) {
+  const eventsFunctionsExtensionCodeGenerator =
+    new gd.EventsFunctionsExtensionCodeGenerator(project);
+
+  const includeFiles = new gd.SetString();
+  const code =
+    eventsFunctionsExtensionCodeGenerator.generateFreeEventsFunctionCompleteCode(
+      eventsFunction,
+      'functionNamespace',
+      includeFiles,
+      true
+    );
+
+  eventsFunctionsExtensionCodeGenerator.delete();
+  includeFiles.delete();
+
+  return new Function(
+    'gdjs',
+    `Hashtable = gdjs.Hashtable;` + '\n' + code + ';\nreturn functionNamespace;'
+  );
+}
+
 /** Helper to create compiled events from serialized events, creating a project and the events function. */
 function generateCompiledEventsFromSerializedEvents(
   gd,
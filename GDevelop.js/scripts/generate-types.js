@@ -199,6 +199,25 @@ type ParticleEmitterObject_RendererType = 0 | 1 | 2`
       'declare class gdVectorString {\n  toJSArray(): Array<string>;',
       'types/gdvectorstring.js'
     );
+    shell.sed(
+      '-i',
+      'declare class gdPackedStrings {',
+      'declare class gdPackedStrings {\n  toJSArray(): Array<string>;',
+      'types/gdpackedstrings.js'
+    );
+    shell.sed(
+      '-i',
+      'declare class gdPackedInitialInstances {',
+      [
+        'declare class gdPackedInitialInstances {',
+        '  getPositionsArray(): Float64Array;',
+        '  getAnglesArray(): Float64Array;',
+        '  getZOrdersArray(): Int32Array;',
+        '  getLayersArray(): Uint32Array;',
+        '  getObjectsArray(): Uint32Array;',
+      ].join('\n'),
+      'types/gdpackedinitialinstances.js'
+    );
     shell.sed(
       '-i',
       'declare class gdVectorInt {',
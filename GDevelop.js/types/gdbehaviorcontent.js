@@ -6,6 +6,8 @@ declare class gdBehaviorContent {
   getName(): string;
   getTypeName(): string;
   getContent(): gdSerializerElement;
+  getProperties(behavior: gdBehavior): gdMapStringPropertyDescriptor;
+  updateProperty(behavior: gdBehavior, name: string, value: string): boolean;
   serializeTo(element: gdSerializerElement): void;
   unserializeFrom(element: gdSerializerElement): void;
   delete(): void;
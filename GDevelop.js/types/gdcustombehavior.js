@@ -0,0 +1,6 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdCustomBehavior extends gdBehavior {
+  constructor(eventsBasedBehavior: gdEventsBasedBehavior): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,8 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsExpressionsValidator {
+  constructor(platform: gdPlatform): void;
+  getDiagnostics(): gdVectorEventsExpressionDiagnostic;
+  launch(events: gdEventsList, globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,9 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdExpressionCompletion {
+  getCompletionKind(): ExpressionCompletionDescription_CompletionKind;
+  getCompletion(): string;
+  hasExpressionMetadata(): boolean;
+  getExpressionMetadata(): gdExpressionMetadata;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
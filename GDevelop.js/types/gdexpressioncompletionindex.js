@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdExpressionCompletionIndex {
+  constructor(): void;
+  indexPlatform(platform: gdPlatform): void;
+  indexObjects(globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer): void;
+  indexVariables(globalVariables: gdVariablesContainer, sceneVariables: gdVariablesContainer): void;
+  getCompletions(description: gdExpressionCompletionDescription, maxCount: number): gdVectorExpressionCompletion;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
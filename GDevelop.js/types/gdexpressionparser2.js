@@ -2,6 +2,7 @@
 declare class gdExpressionParser2 {
   constructor(platform: gdPlatform, globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer): void;
   parseExpression(type: string, expression: string): gdUniquePtrExpressionNode;
+  parseExpressionIncrementally(type: string, node: gdUniquePtrExpressionNode, previousExpression: string, editPosition: number, removedLength: number, insertedText: string): gdExpressionNode;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
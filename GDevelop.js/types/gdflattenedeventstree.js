@@ -0,0 +1,22 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdFlattenedEventsTree {
+  constructor(events: gdEventsList): void;
+  update(): void;
+  getEventsCount(): number;
+  getEventAt(position: number): gdBaseEvent;
+  getEventsListAt(position: number): gdEventsList;
+  getDepthAt(position: number): number;
+  isFoldedAt(position: number): boolean;
+  isVisibleAt(position: number): boolean;
+  getSubtreeSizeAt(position: number): number;
+  getPositionOf(event: gdBaseEvent): number;
+  getVisibleEventsCount(): number;
+  getPositionOfVisibleEvent(visibleIndex: number): number;
+  getVisibleIndexAt(position: number): number;
+  insertEvent(event: gdBaseEvent, eventsList: gdEventsList, position: number): gdBaseEvent;
+  removeEvent(eventsList: gdEventsList, position: number): void;
+  moveEventToAnotherEventsList(eventToMove: gdBaseEvent, newEventsList: gdEventsList, newPosition: number): boolean;
+  setFolded(event: gdBaseEvent, folded: boolean): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,20 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdPackedInitialInstances {
+  getPositionsArray(): Float64Array;
+  getAnglesArray(): Float64Array;
+  getZOrdersArray(): Int32Array;
+  getLayersArray(): Uint32Array;
+  getObjectsArray(): Uint32Array;
+  constructor(): void;
+  pack(instances: gdInitialInstancesContainer): void;
+  getInstancesCount(): number;
+  getLayerNames(): gdPackedStrings;
+  getObjectNames(): gdPackedStrings;
+  getPackedInstancesPositionsAddress(): number;
+  getPackedInstancesAnglesAddress(): number;
+  getPackedInstancesZOrdersAddress(): number;
+  getPackedInstancesLayersAddress(): number;
+  getPackedInstancesObjectsAddress(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
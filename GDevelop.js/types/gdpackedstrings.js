@@ -0,0 +1,13 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdPackedStrings {
+  toJSArray(): Array<string>;
+  constructor(): void;
+  add(str: string): number;
+  clear(): void;
+  getCount(): number;
+  get(index: number): string;
+  getPackedStringsDataAddress(): number;
+  getPackedStringsOffsetsAddress(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -8,6 +8,8 @@ declare class gdPreviewExportOptions {
   setIncludeFileHash(includeFile: string, hash: number): gdPreviewExportOptions;
   setProjectDataOnlyExport(enable: boolean): gdPreviewExportOptions;
   setFullLoadingScreen(enable: boolean): gdPreviewExportOptions;
+  setLayoutByLayoutExport(enable: boolean): gdPreviewExportOptions;
+  setIncrementalResourcesCopy(enable: boolean): gdPreviewExportOptions;
   setNonRuntimeScriptsCacheBurst(value: number): gdPreviewExportOptions;
   delete(): void;
   ptr: number;
@@ -8,6 +8,7 @@ declare class gdVectorString {
   at(index: number): string;
   set(index: number, str: string): void;
   clear(): void;
+  toPackedStrings(): gdPackedStrings;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
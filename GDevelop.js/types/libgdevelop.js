@@ -35,6 +35,7 @@ declare class libGDevelop {
   asImageResource(gdResource): gdImageResource;
 
   VectorString: Class<gdVectorString>;
+  PackedStrings: Class<gdPackedStrings>;
   VectorPlatformExtension: Class<gdVectorPlatformExtension>;
   VectorDependencyMetadata: Class<gdVectorDependencyMetadata>;
   VectorInt: Class<gdVectorInt>;
@@ -67,6 +68,7 @@ declare class libGDevelop {
   ExtensionProperties: Class<gdExtensionProperties>;
   Behavior: Class<gdBehavior>;
   BehaviorJsImplementation: Class<gdBehaviorJsImplementation>;
+  CustomBehavior: Class<gdCustomBehavior>;
   BehaviorContent: Class<gdBehaviorContent>;
   BehaviorsSharedData: Class<gdBehaviorsSharedData>;
   BehaviorSharedDataJsImplementation: Class<gdBehaviorSharedDataJsImplementation>;
@@ -94,6 +96,7 @@ declare class libGDevelop {
   JsonResource: Class<gdJsonResource>;
   InitialInstance: Class<gdInitialInstance>;
   InitialInstancesContainer: Class<gdInitialInstancesContainer>;
+  PackedInitialInstances: Class<gdPackedInitialInstances>;
   HighestZOrderFinder: Class<gdHighestZOrderFinder>;
   InitialInstanceFunctor: Class<gdInitialInstanceFunctor>;
   InitialInstanceJSFunctorWrapper: Class<gdInitialInstanceJSFunctorWrapper>;
@@ -155,6 +158,9 @@ declare class libGDevelop {
   ExpressionCompletionDescription: Class<gdExpressionCompletionDescription>;
   VectorExpressionCompletionDescription: Class<gdVectorExpressionCompletionDescription>;
   ExpressionCompletionFinder: Class<gdExpressionCompletionFinder>;
+  ExpressionCompletion: Class<gdExpressionCompletion>;
+  VectorExpressionCompletion: Class<gdVectorExpressionCompletion>;
+  ExpressionCompletionIndex: Class<gdExpressionCompletionIndex>;
   ExpressionNode: Class<gdExpressionNode>;
   UniquePtrExpressionNode: Class<gdUniquePtrExpressionNode>;
   ExpressionParser2: Class<gdExpressionParser2>;
@@ -171,10 +177,14 @@ declare class libGDevelop {
   ArbitraryEventsWorker: Class<gdArbitraryEventsWorker>;
   EventsParametersLister: Class<gdEventsParametersLister>;
   EventsPositionFinder: Class<gdEventsPositionFinder>;
+  FlattenedEventsTree: Class<gdFlattenedEventsTree>;
   EventsTypesLister: Class<gdEventsTypesLister>;
   InstructionsTypeRenamer: Class<gdInstructionsTypeRenamer>;
   EventsContext: Class<gdEventsContext>;
   EventsContextAnalyzer: Class<gdEventsContextAnalyzer>;
+  EventsExpressionDiagnostic: Class<gdEventsExpressionDiagnostic>;
+  VectorEventsExpressionDiagnostic: Class<gdVectorEventsExpressionDiagnostic>;
+  EventsExpressionsValidator: Class<gdEventsExpressionsValidator>;
   ArbitraryResourceWorker: Class<gdArbitraryResourceWorker>;
   ArbitraryResourceWorkerJS: Class<gdArbitraryResourceWorkerJS>;
   ResourcesMergingHelper: Class<gdResourcesMergingHelper>;
@@ -13,13 +13,15 @@ type Props = BehaviorEditorProps;
 export default class BehaviorPropertiesEditor extends React.Component<Props> {
   render() {
     const { behavior, behaviorContent, object } = this.props;
-    const properties = behavior.getProperties(behaviorContent.getContent());
+    // Properties are kept by the behavior content until it's modified, so
+    // they are not computed again each time a value is read.
+    const properties = behaviorContent.getProperties(behavior);
 
     const propertiesSchema = propertiesMapToSchema(
       properties,
-      behaviorContent => behavior.getProperties(behaviorContent.getContent()),
+      behaviorContent => behaviorContent.getProperties(behavior),
       (behaviorContent, name, value) => {
-        behavior.updateProperty(behaviorContent.getContent(), name, value);
+        behaviorContent.updateProperty(behavior, name, value);
       },
       object
     );
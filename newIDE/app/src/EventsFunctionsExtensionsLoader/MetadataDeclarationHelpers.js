@@ -2,10 +2,6 @@
 import { type I18n as I18nType } from '@lingui/core';
 import { t } from '@lingui/macro';
 import { mapVector } from '../Utils/MapFor';
-import {
-  enumerateNamedPropertyDescriptorsList,
-  toGdPropertyDescriptor,
-} from './EnumerateProperties';
 const gd: libGDevelop = global.gd;
 
 // This file contains the logic to declare extension metadata from
@@ -70,119 +66,12 @@ export const declareBehaviorMetadata = (
   extension: gdPlatformExtension,
   eventsBasedBehavior: gdEventsBasedBehavior
 ): gdBehaviorMetadata => {
-  const generatedBehavior = new gd.BehaviorJsImplementation();
-
-  // We enumerate the properties of the behavior from a list of gdNamedPropertyDescriptor
-  // to an array of JavaScript objects. This is important to ensure that the functions
-  // below are not keeping any reference to eventsBasedBehavior.
-  //
-  // We could in theory keep a reference to eventsBasedBehavior, and avoid using
-  // `enumerateNamedPropertyDescriptorsList` and `toGdPropertyDescriptor`.
-  // This should be safe as if eventsBasedBehavior is deleted (i.e: the behavior
-  // is removed from its extension), then the extension will be re-generated.
-  //
-  // In practice, we don't want to risk keeping this references, because if at some point
-  // we delete the eventsBasedBehavior and forget to remove the extension, then the
-  // extension will use a deleted object and crash the app. Instead, we convert the
-  // properties to an array of JavaScript objects, so that we're guaranteed that the
-  // lifetime of these properties is the same as the lifetime of these functions (i.e:
-  // we use the JS garbage collector).
-  const enumeratedProperties = enumerateNamedPropertyDescriptorsList(
-    eventsBasedBehavior.getPropertyDescriptors()
-  );
-
-  // $FlowExpectedError - we're creating a behavior
-  generatedBehavior.updateProperty = function(
-    behaviorContent: gdSerializerElement,
-    propertyName: string,
-    newValue: string
-  ) {
-    const enumeratedProperty = enumeratedProperties.find(
-      enumeratedProperty => enumeratedProperty.name === propertyName
-    );
-    if (!enumeratedProperty) return false;
-
-    const element = behaviorContent.addChild(propertyName);
-    const propertyType: string = enumeratedProperty.type;
-
-    if (
-      propertyType === 'String' ||
-      propertyType === 'Choice' ||
-      propertyType === 'Color' ||
-      propertyType === 'Behavior'
-    ) {
-      element.setStringValue(newValue);
-    } else if (propertyType === 'Number') {
-      element.setDoubleValue(parseFloat(newValue));
-    } else if (propertyType === 'Boolean') {
-      element.setBoolValue(newValue === '1');
-    }
-
-    return true;
-  };
-
-  // $FlowExpectedError - we're creating a behavior
-  generatedBehavior.getProperties = function(behaviorContent) {
-    var behaviorProperties = new gd.MapStringPropertyDescriptor();
-
-    enumeratedProperties.forEach(enumeratedProperty => {
-      const propertyName = enumeratedProperty.name;
-      const propertyType = enumeratedProperty.type;
-      const newProperty = toGdPropertyDescriptor(
-        enumeratedProperty,
-        behaviorProperties.getOrCreate(propertyName)
-      );
-
-      if (behaviorContent.hasChild(propertyName)) {
-        if (
-          propertyType === 'String' ||
-          propertyType === 'Choice' ||
-          propertyType === 'Color' ||
-          propertyType === 'Behavior'
-        ) {
-          newProperty.setValue(
-            behaviorContent.getChild(propertyName).getStringValue()
-          );
-        } else if (propertyType === 'Number') {
-          newProperty.setValue(
-            '' + behaviorContent.getChild(propertyName).getDoubleValue()
-          );
-        } else if (propertyType === 'Boolean') {
-          newProperty.setValue(
-            behaviorContent.getChild(propertyName).getBoolValue()
-              ? 'true'
-              : 'false'
-          );
-        }
-      } else {
-        // No value was serialized for this property. `newProperty`
-        // will have the default value coming from `enumeratedProperty`.
-      }
-    });
-
-    return behaviorProperties;
-  };
-
-  // $FlowExpectedError - we're creating a behavior
-  generatedBehavior.initializeContent = function(behaviorContent) {
-    enumeratedProperties.forEach(enumeratedProperty => {
-      const element = behaviorContent.addChild(enumeratedProperty.name);
-      const propertyType: string = enumeratedProperty.type;
-
-      if (
-        propertyType === 'String' ||
-        propertyType === 'Choice' ||
-        propertyType === 'Color' ||
-        propertyType === 'Behavior'
-      ) {
-        element.setStringValue(enumeratedProperty.value);
-      } else if (propertyType === 'Number') {
-        element.setDoubleValue(parseFloat(enumeratedProperty.value) || 0);
-      } else if (propertyType === 'Boolean') {
-        element.setBoolValue(enumeratedProperty.value === 'true');
-      }
-    });
-  };
+  // The properties declared by the events based behavior are copied (and their
+  // types read once) by gd.CustomBehavior, which reads and updates them in C++.
+  // It's important that no reference to eventsBasedBehavior is kept: if it's
+  // deleted (i.e: the behavior is removed from its extension), the extension is
+  // re-generated, but the behavior must never use a deleted object.
+  const generatedBehavior = new gd.CustomBehavior(eventsBasedBehavior);
 
   return extension
     .addBehavior(
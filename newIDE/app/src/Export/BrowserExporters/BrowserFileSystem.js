@@ -191,6 +191,13 @@ export default class BrowserFileSystem {
     return true;
   };
 
+  appendToFile = (filePath: string, content: string) => {
+    const normalizedFilePath = pathPosix.normalize(filePath);
+    this._textFiles[normalizedFilePath] =
+      (this._textFiles[normalizedFilePath] || '') + content;
+    return true;
+  };
+
   readFile = (file: string): string => {
     if (this._textFiles[file]) return this._textFiles[file];
 
@@ -145,6 +145,16 @@ export default class BrowserS3FileSystem {
     });
     return true;
   };
+  appendToFile = (fullPath: string, contents: string) => {
+    const key = fullPath.replace(this.bucketBaseUrl, '');
+    const pendingUploadObject = this._pendingUploadObjects.find(
+      pendingUploadObject => pendingUploadObject.Key === key
+    );
+    if (!pendingUploadObject) return this.writeToFile(fullPath, contents);
+
+    pendingUploadObject.Body += contents;
+    return true;
+  };
 
   readFile = (file: string) => {
     if (!!this._indexedFilesContent[file])
@@ -3,6 +3,9 @@ import { getUID } from '../../Utils/LocalUserInfo.js';
 var fs = optionalRequire('fs-extra');
 var path = optionalRequire('path');
 var os = optionalRequire('os');
+var crypto = optionalRequire('crypto');
+const electron = optionalRequire('electron');
+const nativeImage = electron ? electron.nativeImage : null;
 const gd /* TODO: add flow in this file */ = global.gd;
 
 /**
@@ -31,6 +34,28 @@ export default {
       console.error('clearDir(' + path + ') failed: ' + e);
     }
   },
+  clearDirExcept: function(dirPath, filesToKeep) {
+    const keptFiles = new Set(filesToKeep.map(file => path.resolve(file)));
+    const clear = directory => {
+      fs.readdirSync(directory).forEach(name => {
+        const entryPath = path.join(directory, name);
+        if (fs.statSync(entryPath).isDirectory()) {
+          clear(entryPath);
+          if (fs.readdirSync(entryPath).length === 0) fs.rmdirSync(entryPath);
+        } else if (!keptFiles.has(path.resolve(entryPath))) {
+          fs.removeSync(entryPath);
+        }
+      });
+    };
+
+    try {
+      clear(dirPath);
+    } catch (e) {
+      console.error('clearDirExcept(' + dirPath + ') failed: ' + e);
+      return false;
+    }
+    return true;
+  },
   getTempDir: function() {
     return path.join(os.tmpdir(), `GDTMP-${getUID()}`);
   },
@@ -97,6 +122,15 @@ export default {
     }
     return true;
   },
+  appendToFile: function(file, contents) {
+    try {
+      fs.appendFileSync(file, contents);
+    } catch (e) {
+      console.error('appendToFile(' + file + ', ...) failed: ' + e);
+      return false;
+    }
+    return true;
+  },
   readFile: function(file) {
     try {
       var contents = fs.readFileSync(file);
@@ -106,6 +140,80 @@ export default {
       return '';
     }
   },
+  getFileStats: function(file) {
+    if (this._isExternalUrl(file)) return null;
+
+    file = this._translateUrl(file);
+    try {
+      const stat = fs.statSync(file);
+      return { size: stat.size, modificationTime: stat.mtimeMs };
+    } catch (e) {
+      return null;
+    }
+  },
+  getFileHash: function(file) {
+    if (this._isExternalUrl(file)) return '';
+
+    file = this._translateUrl(file);
+    try {
+      return crypto
+        .createHash('md5')
+        .update(fs.readFileSync(file))
+        .digest('hex');
+    } catch (e) {
+      console.error('getFileHash(' + file + ') failed: ' + e);
+      return '';
+    }
+  },
+  getImageSize: function(file) {
+    if (!nativeImage || this._isExternalUrl(file)) return null;
+
+    const image = nativeImage.createFromPath(this._translateUrl(file));
+    if (image.isEmpty()) return null;
+
+    return image.getSize();
+  },
+  writeAtlasImage: function(file, width, height, images) {
+    if (!nativeImage) return false;
+
+    try {
+      // Bitmaps are raw pixels, 4 bytes per pixel.
+      const atlasBitmap = Buffer.alloc(width * height * 4);
+      for (const { file: imageFile, x, y } of images) {
+        const image = nativeImage.createFromPath(this._translateUrl(imageFile));
+        if (image.isEmpty()) return false;
+
+        const { width: imageWidth, height: imageHeight } = image.getSize();
+        const imageBitmap = image.toBitmap();
+        for (let row = 0; row < imageHeight; row++) {
+          imageBitmap.copy(
+            atlasBitmap,
+            ((y + row) * width + x) * 4,
+            row * imageWidth * 4,
+            (row + 1) * imageWidth * 4
+          );
+        }
+      }
+
+      fs.outputFileSync(
+        file,
+        nativeImage.createFromBitmap(atlasBitmap, { width, height }).toPNG()
+      );
+    } catch (e) {
+      console.error('writeAtlasImage(' + file + ') failed: ' + e);
+      return false;
+    }
+    return true;
+  },
+  removeFile: function(file) {
+    try {
+      fs.removeSync(file);
+    } catch (e) {
+      console.error('removeFile(' + file + ') failed: ' + e);
+      return false;
+    }
+    return true;
+  },
   readDir: function(path, ext) {
     ext = ext.toUpperCase();
     var output = new gd.VectorString();
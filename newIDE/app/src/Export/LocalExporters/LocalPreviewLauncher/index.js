@@ -227,6 +227,10 @@ export default class LocalPreviewLauncher extends React.Component<
               previewOptions.fullLoadingScreen
             );
 
+            // Previews are always exported in the same folder: only copy the
+            // resources that changed since the last preview.
+            previewExportOptions.setIncrementalResourcesCopy(true);
+
             exporter.exportProjectForPixiPreview(previewExportOptions);
             previewExportOptions.delete();
             exporter.delete();